@@ -759,6 +759,13 @@ function(hpx_check_for_cxx17_if_constexpr)
     FILE ${ARGN})
 endfunction()
 
+###############################################################################
+function(hpx_check_for_cxx17_experimental_simd)
+  add_hpx_config_test(HPX_WITH_CXX17_EXPERIMENTAL_SIMD
+    SOURCE cmake/tests/cxx17_experimental_simd.cpp
+    FILE ${ARGN})
+endfunction()
+
 ###############################################################################
 function(hpx_check_for_cxx17_noexcept_functions_as_nontype_template_arguments)
   add_hpx_config_test(
@@ -114,6 +114,23 @@ function(add_hpx_test category name)
           COMMAND ${cmd} "-p" "mpi" "-r" "mpi" ${args})
       endif()
     endif()
+    if(HPX_WITH_PARCELPORT_SHMEM)
+      set(_add_test FALSE)
+      if(DEFINED ${name}_PARCELPORTS)
+        set(PP_FOUND -1)
+        list(FIND ${name}_PARCELPORTS "shmem" PP_FOUND)
+        if(NOT PP_FOUND EQUAL -1)
+          set(_add_test TRUE)
+        endif()
+      else()
+        set(_add_test TRUE)
+      endif()
+      if(_add_test)
+        add_test(
+          NAME "${category}.distributed.shmem.${name}"
+          COMMAND ${cmd} "-p" "shmem" ${args})
+      endif()
+    endif()
     if(HPX_WITH_PARCELPORT_TCP)
       set(_add_test FALSE)
       if(DEFINED ${name}_PARCELPORTS)
@@ -225,6 +225,15 @@ function(hpx_perform_cxx_feature_tests)
     hpx_check_for_cxx17_aligned_new(
       DEFINITIONS HPX_HAVE_CXX17_ALIGNED_NEW)
 
+    if(HPX_WITH_DATAPAR_STD_EXPERIMENTAL_SIMD AND NOT HPX_WITH_DATAPAR_VC)
+      hpx_check_for_cxx17_experimental_simd(
+        DEFINITIONS HPX_HAVE_DATAPAR HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+      if(HPX_WITH_CXX17_EXPERIMENTAL_SIMD)
+        set(HPX_WITH_DATAPAR ON PARENT_SCOPE)
+        hpx_info("Using std::experimental::simd for the data parallel algorithms")
+      endif()
+    endif()
+
     hpx_check_for_cxx17_std_in_place_type_t(
       DEFINITIONS HPX_HAVE_CXX17_STD_IN_PLACE_TYPE_T)
 
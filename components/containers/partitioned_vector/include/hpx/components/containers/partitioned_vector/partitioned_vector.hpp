@@ -11,6 +11,7 @@
 #define HPX_PARTITIONED_VECTOR_HPP
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_cache.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_impl.hpp>
 
 #endif
@@ -0,0 +1,297 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_cache.hpp
+
+#ifndef HPX_PARTITIONED_VECTOR_CACHE_HPP
+#define HPX_PARTITIONED_VECTOR_CACHE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx
+{
+    /// A software cache for the elements of a \a partitioned_vector which
+    /// are stored on other localities.
+    ///
+    /// Reading a remote element fetches the whole page of \a page_size
+    /// consecutive elements containing it, further reads from the same page
+    /// are served from the cache. Writes to remote elements are buffered in
+    /// the cache until \a flush is called, which writes all modified
+    /// elements back using a single action per locality. Elements stored on
+    /// this locality are always accessed directly.
+    ///
+    /// The cache does not observe modifications done through other means,
+    /// \a invalidate has to be called to drop the cached pages once the
+    /// vector may have changed. The cache is not thread safe.
+    ///
+    /// \tparam T    The type of the elements of the cached vector
+    /// \tparam Data The type of the data stored by each partition
+    ///
+    template <typename T, typename Data /*= std::vector<T> */>
+    class partitioned_vector_cache
+    {
+        HPX_NON_COPYABLE(partitioned_vector_cache);
+
+    public:
+        typedef partitioned_vector<T, Data> vector_type;
+        typedef typename vector_type::size_type size_type;
+
+        /// Construct a cache for the remote elements of the given vector
+        ///
+        /// \param v          The vector to cache the elements of. The vector
+        ///                   must outlive the cache.
+        /// \param page_size  The number of consecutive elements fetched at
+        ///                   once
+        ///
+        explicit partitioned_vector_cache(
+            vector_type& v, size_type page_size = 1024)
+          : vector_(&v)
+          , page_size_(page_size == 0 ? 1 : page_size)
+        {
+        }
+
+        /// \return Returns the number of consecutive elements fetched at
+        ///         once.
+        size_type page_size() const
+        {
+            return page_size_;
+        }
+
+        /// \return Returns the number of pages currently held by the cache.
+        std::size_t num_pages() const
+        {
+            return pages_.size();
+        }
+
+        /// Returns the element at the position \a pos of the vector. If the
+        /// element is stored on another locality and is not cached yet, this
+        /// fetches its page and waits for it to arrive.
+        ///
+        /// \param pos   Global position of the element in the vector
+        ///
+        /// \return Returns the value of the element at position \a pos.
+        ///
+        T get_value(size_type pos)
+        {
+            if (is_local(pos))
+                return vector_->get_value(launch::sync, pos);
+
+            page& p = pages_[pos / page_size_];
+            size_type offset = pos % page_size_;
+            if (p.data_.empty() || !p.valid_[offset])
+                fetch(std::vector<size_type>(1, pos / page_size_));
+
+            return p.data_[offset];
+        }
+
+        /// Returns the elements at the positions \a pos of the vector. All
+        /// pages which are missing are fetched at once, using a single
+        /// action for each of the remote localities involved.
+        ///
+        /// \param pos   Global positions of the elements in the vector
+        ///
+        /// \return Returns the values of the elements at the positions
+        ///         \a pos, in the same order as \a pos.
+        ///
+        std::vector<T> get_values(std::vector<size_type> const& pos)
+        {
+            std::vector<size_type> missing;
+            for (size_type i : pos)
+            {
+                if (is_local(i))
+                    continue;
+
+                page& p = pages_[i / page_size_];
+                if (p.data_.empty() || !p.valid_[i % page_size_])
+                    missing.push_back(i / page_size_);
+            }
+
+            if (!missing.empty())
+            {
+                std::sort(missing.begin(), missing.end());
+                missing.erase(std::unique(missing.begin(), missing.end()),
+                    missing.end());
+                fetch(missing);
+            }
+
+            std::vector<T> result;
+            result.reserve(pos.size());
+            for (size_type i : pos)
+            {
+                if (is_local(i))
+                {
+                    result.push_back(vector_->get_value(launch::sync, i));
+                }
+                else
+                {
+                    result.push_back(
+                        pages_[i / page_size_].data_[i % page_size_]);
+                }
+            }
+            return result;
+        }
+
+        /// Copy the value of \a val to the element at position \a pos of the
+        /// vector. Remote elements are modified in the cache only, the new
+        /// value becomes visible to others after the next call to \a flush.
+        ///
+        /// \param pos   Global position of the element in the vector
+        /// \param val   The value to be copied
+        ///
+        void set_value(size_type pos, T const& val)
+        {
+            if (is_local(pos))
+            {
+                vector_->set_value(launch::sync, pos, val);
+                return;
+            }
+
+            page& p = pages_[pos / page_size_];
+            if (p.data_.empty())
+                p.resize(page_size_);
+
+            size_type offset = pos % page_size_;
+            p.data_[offset] = val;
+            p.valid_[offset] = true;
+            p.dirty_[offset] = true;
+            p.has_dirty_ = true;
+        }
+
+        /// Asynchronously write all modified elements back to the vector,
+        /// using a single action for each of the remote localities involved.
+        /// The cached pages stay valid.
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once all modifications have been written.
+        ///
+        future<void> flush()
+        {
+            std::vector<size_type> pos;
+            std::vector<T> values;
+
+            for (auto& entry : pages_)
+            {
+                page& p = entry.second;
+                if (!p.has_dirty_)
+                    continue;
+
+                size_type base = entry.first * page_size_;
+                for (size_type i = 0; i != p.dirty_.size(); ++i)
+                {
+                    if (p.dirty_[i])
+                    {
+                        pos.push_back(base + i);
+                        values.push_back(p.data_[i]);
+                        p.dirty_[i] = false;
+                    }
+                }
+                p.has_dirty_ = false;
+            }
+
+            return vector_->set_values(pos, values);
+        }
+
+        /// Write all modified elements back to the vector, see \a flush.
+        void flush(launch::sync_policy)
+        {
+            flush().get();
+        }
+
+        /// Drop all cached pages, the next access to a remote element will
+        /// fetch its page again. Modifications which have not been flushed
+        /// are discarded.
+        void invalidate()
+        {
+            pages_.clear();
+        }
+
+    private:
+        /// \cond NOINTERNAL
+        struct page
+        {
+            page()
+              : has_dirty_(false)
+            {
+            }
+
+            void resize(size_type size)
+            {
+                data_.resize(size);
+                valid_.resize(size, false);
+                dirty_.resize(size, false);
+            }
+
+            std::vector<T> data_;
+            std::vector<bool> valid_;
+            std::vector<bool> dirty_;
+            bool has_dirty_;
+        };
+
+        bool is_local(size_type pos) const
+        {
+            std::size_t part = vector_->get_partition(pos);
+            HPX_ASSERT(part < vector_->partitions_.size());
+            return bool(vector_->partitions_[part].local_data_);
+        }
+
+        // Fetch the given pages with a single gather, elements modified in
+        // the cache are not overwritten.
+        void fetch(std::vector<size_type> const& page_numbers)
+        {
+            size_type size = vector_->size();
+
+            std::vector<size_type> pos;
+            for (size_type n : page_numbers)
+            {
+                size_type first = n * page_size_;
+                size_type last = (std::min)(first + page_size_, size);
+                for (size_type i = first; i != last; ++i)
+                    pos.push_back(i);
+            }
+
+            std::vector<T> values = vector_->get_values(launch::sync, pos);
+
+            std::size_t i = 0;
+            for (size_type n : page_numbers)
+            {
+                page& p = pages_[n];
+                if (p.data_.empty())
+                    p.resize(page_size_);
+
+                size_type first = n * page_size_;
+                size_type last = (std::min)(first + page_size_, size);
+                for (size_type offset = 0; offset != last - first;
+                     ++offset, ++i)
+                {
+                    if (!p.dirty_[offset])
+                    {
+                        p.data_[offset] = std::move(values[i]);
+                        p.valid_[offset] = true;
+                    }
+                }
+            }
+        }
+
+        vector_type* vector_;
+        size_type page_size_;
+        std::unordered_map<size_type, page> pages_;
+        /// \endcond
+    };
+}
+
+#endif
@@ -241,6 +241,34 @@ namespace hpx { namespace server
         void set_values(std::vector<size_type> const& pos,
             std::vector<T> const& val);
 
+        /// Return the elements at the positions \a pos in each of the
+        /// partitions \a parts. All partitions have to live on the same
+        /// locality as this partitioned_vector_partition, which allows to
+        /// gather the values from several partitions with a single action.
+        ///
+        /// \param parts The partitions to read the elements from
+        /// \param pos   For each partition the positions of the elements to
+        ///              return
+        ///
+        /// \return Return for each partition the values of the elements at
+        ///         the positions represented by \a pos.
+        ///
+        std::vector<std::vector<T> > gather_values(
+            std::vector<hpx::id_type> const& parts,
+            std::vector<std::vector<size_type> > const& pos) const;
+
+        /// Copy the values \a val to the elements at the positions \a pos in
+        /// each of the partitions \a parts. All partitions have to live on the
+        /// same locality as this partitioned_vector_partition.
+        ///
+        /// \param parts The partitions to write the elements to
+        /// \param pos   For each partition the positions of the elements
+        /// \param val   For each partition the values to be copied
+        ///
+        void scatter_values(std::vector<hpx::id_type> const& parts,
+            std::vector<std::vector<size_type> > const& pos,
+            std::vector<std::vector<T> > const& val);
+
         /// Remove all elements from the vector leaving the
         /// partitioned_vector_partition with size 0.
         ///
@@ -268,6 +296,8 @@ namespace hpx { namespace server
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_values);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, gather_values);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, scatter_values);
 
 //         HPX_DEFINE_COMPONENT_ACTION(partitioned_vector_partition, clear);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_copied_data);
@@ -294,6 +324,10 @@ namespace hpx { namespace server
         HPX_PP_CAT(__vector_set_value_action_, name));                        \
     HPX_REGISTER_ACTION_DECLARATION(type::set_values_action,                  \
         HPX_PP_CAT(__vector_set_values_action_, name));                       \
+    HPX_REGISTER_ACTION_DECLARATION(type::gather_values_action,               \
+        HPX_PP_CAT(__vector_gather_values_action_, name));                    \
+    HPX_REGISTER_ACTION_DECLARATION(type::scatter_values_action,              \
+        HPX_PP_CAT(__vector_scatter_values_action_, name));                   \
     HPX_REGISTER_ACTION_DECLARATION(type::size_action,                        \
         HPX_PP_CAT(__vector_size_action_, name));                             \
     HPX_REGISTER_ACTION_DECLARATION(type::resize_action,                      \
@@ -539,6 +573,34 @@ namespace hpx
         future<void> set_values(std::vector<std::size_t> const& pos,
             std::vector<T> const& val);
 
+        /// Return the elements at the positions \a pos in each of the
+        /// partitions \a parts, which all live on the same locality as this
+        /// partitioned_vector_partition.
+        ///
+        /// \param parts The partitions to read the elements from
+        /// \param pos   For each partition the positions of the elements
+        ///
+        /// \return This returns the values for each partition as an
+        ///         hpx::future
+        ///
+        future<std::vector<std::vector<T> > > gather_values(
+            std::vector<hpx::id_type> const& parts,
+            std::vector<std::vector<std::size_t> > const& pos) const;
+
+        /// Copy the values \a val to the elements at the positions \a pos in
+        /// each of the partitions \a parts, which all live on the same
+        /// locality as this partitioned_vector_partition.
+        ///
+        /// \param parts The partitions to write the elements to
+        /// \param pos   For each partition the positions of the elements
+        /// \param val   For each partition the values to be copied
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> scatter_values(std::vector<hpx::id_type> const& parts,
+            std::vector<std::vector<std::size_t> > const& pos,
+            std::vector<std::vector<T> > const& val);
+
 //         void clear()
 //         {
 //             HPX_ASSERT(this->get_id());
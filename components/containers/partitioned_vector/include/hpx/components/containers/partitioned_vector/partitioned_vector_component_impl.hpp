@@ -284,6 +284,46 @@ namespace hpx { namespace server
             partitioned_vector_partition_[pos[i]] = val[i];
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<std::vector<T> >
+    partitioned_vector<T, Data>::gather_values(
+        std::vector<hpx::id_type> const& parts,
+        std::vector<std::vector<size_type> > const& pos) const
+    {
+        HPX_ASSERT(parts.size() == pos.size());
+
+        std::vector<std::vector<T> > result;
+        result.reserve(parts.size());
+
+        for (std::size_t i = 0; i != parts.size(); ++i)
+        {
+            // all partitions are local, this doesn't suspend
+            std::shared_ptr<partitioned_vector> part =
+                hpx::get_ptr<partitioned_vector>(launch::sync, parts[i]);
+            result.push_back(part->get_values(pos[i]));
+        }
+
+        return result;
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::scatter_values(
+        std::vector<hpx::id_type> const& parts,
+        std::vector<std::vector<size_type> > const& pos,
+        std::vector<std::vector<T> > const& val)
+    {
+        HPX_ASSERT(parts.size() == pos.size());
+        HPX_ASSERT(parts.size() == val.size());
+
+        for (std::size_t i = 0; i != parts.size(); ++i)
+        {
+            std::shared_ptr<partitioned_vector> part =
+                hpx::get_ptr<partitioned_vector>(launch::sync, parts[i]);
+            part->set_values(pos[i], val[i]);
+        }
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::clear()
@@ -310,6 +350,10 @@ namespace hpx { namespace server
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name)); \
     HPX_REGISTER_ACTION(type::set_values_action,                               \
         HPX_PP_CAT(__vector_set_values_action_, name));                        \
+    HPX_REGISTER_ACTION(type::gather_values_action,                            \
+        HPX_PP_CAT(__vector_gather_values_action_, name));                     \
+    HPX_REGISTER_ACTION(type::scatter_values_action,                           \
+        HPX_PP_CAT(__vector_scatter_values_action_, name));                    \
     HPX_REGISTER_ACTION(                                                       \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name));           \
     HPX_REGISTER_ACTION(                                                       \
@@ -483,6 +527,30 @@ namespace hpx
             this->get_id(), pos, val);
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        hpx::future<std::vector<std::vector<T> > >
+        partitioned_vector_partition<T, Data>::gather_values(
+            std::vector<hpx::id_type> const& parts,
+            std::vector<std::vector<std::size_t> > const& pos) const
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::gather_values_action>(
+            this->get_id(), parts, pos);
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::scatter_values(
+        std::vector<hpx::id_type> const& parts,
+        std::vector<std::vector<std::size_t> > const& pos,
+        std::vector<std::vector<T> > const& val)
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::scatter_values_action>(
+            this->get_id(), parts, pos, val);
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector_partition<T, Data>::server_type::data_type
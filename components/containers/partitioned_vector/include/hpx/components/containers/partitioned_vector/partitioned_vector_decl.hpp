@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/lcos/dataflow.hpp>
 #include <hpx/lcos/wait_all.hpp>
 #include <hpx/lcos/when_all.hpp>
 #include <hpx/runtime/components/client_base.hpp>
@@ -242,6 +243,7 @@ namespace hpx
     private:
         friend class vector_iterator<T, Data>;
         friend class const_vector_iterator<T, Data>;
+        friend class partitioned_vector_cache<T, Data>;
 
         friend class segment_vector_iterator<
             T, Data, typename partitions_vector_type::iterator>;
@@ -341,6 +343,52 @@ namespace hpx
 
         struct get_ptr_helper;
 
+        // Put the values gathered from the remote localities back into the
+        // order of the positions they were requested for.
+        struct gather_values_helper
+        {
+            std::vector<T> values;
+            std::vector<std::vector<std::size_t> > indices;
+            std::vector<std::vector<std::size_t> > groups;
+
+            std::vector<T> operator()(
+                std::vector<future<std::vector<std::vector<T> > > >&& f)
+            {
+                HPX_ASSERT(f.size() == groups.size());
+
+                for (std::size_t g = 0; g != f.size(); ++g)
+                {
+                    std::vector<std::vector<T> > part_values = f[g].get();
+                    std::vector<std::size_t> const& group = groups[g];
+                    HPX_ASSERT(part_values.size() == group.size());
+
+                    for (std::size_t p = 0; p != group.size(); ++p)
+                    {
+                        std::vector<std::size_t> const& idx =
+                            indices[group[p]];
+                        HPX_ASSERT(part_values[p].size() == idx.size());
+
+                        for (std::size_t i = 0; i != idx.size(); ++i)
+                            values[idx[i]] = std::move(part_values[p][i]);
+                    }
+                }
+
+                return std::move(values);
+            }
+        };
+
+        // Bucket the given global positions by the partition they belong to.
+        // For each partition this returns the local positions and the indices
+        // of the corresponding entries in the given positions.
+        void bucket_by_partition(std::vector<size_type> const& pos,
+            std::vector<std::vector<size_type> >& local_pos,
+            std::vector<std::vector<std::size_t> >& indices) const;
+
+        // Group the remote partitions which have positions assigned by the
+        // locality they live on.
+        std::vector<std::vector<std::size_t> > group_by_locality(
+            std::vector<std::vector<size_type> > const& local_pos) const;
+
         // This function is called when we are creating the vector. It
         // initializes the partitions based on the give parameters.
         template <typename DistPolicy, typename Create>
@@ -615,83 +663,76 @@ namespace hpx
         /// Returns the elements at the positions \a pos
         /// in the vector container.
         ///
+        /// The positions may be given in any order. They are grouped by the
+        /// locality owning them, and a single action is issued for each of
+        /// the remote localities involved. Elements stored on this locality
+        /// are read directly.
+        ///
         /// \param pos   Global position of the element in the vector
         ///
-        /// \return Returns the value of the element at position represented by
-        ///         \a pos.
+        /// \return Returns the values of the elements at the positions
+        ///         represented by \a pos, in the same order as \a pos.
         ///
         future<std::vector<T> >
         get_values(std::vector<size_type> const & pos_vec) const
         {
             // check if position vector is empty
-            // the following code needs at least one element.
             if (pos_vec.empty())
                 return make_ready_future(std::vector<T>());
 
-            // current partition index of the block
-            size_type part_cur = get_partition(pos_vec[0]);
+            std::vector<std::vector<size_type> > local_pos;
+            std::vector<std::vector<std::size_t> > indices;
+            bucket_by_partition(pos_vec, local_pos, indices);
 
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator part_begin =
-                pos_vec.begin();
+            std::vector<T> values(pos_vec.size());
 
-            // vector holding futures of the values for all blocks
-            std::vector<future<std::vector<T> > > part_values_future;
-            for (typename std::vector<size_type>::const_iterator it =
-                    pos_vec.begin(); it != pos_vec.end(); ++it)
+            // the partitions on this locality are accessed directly
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
+                partition_data const& part_data = partitions_[part];
+                if (!part_data.local_data_ || local_pos[part].empty())
                     continue;
 
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // get async values for this block
-                    part_values_future.push_back(get_values(part_cur,
-                        get_local_indices(std::vector<size_type>(part_begin, it))));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    part_begin = it;
-                }
+                std::vector<T> part_values =
+                    part_data.local_data_->get_values(local_pos[part]);
+
+                std::vector<std::size_t> const& idx = indices[part];
+                for (std::size_t i = 0; i != idx.size(); ++i)
+                    values[idx[i]] = std::move(part_values[i]);
             }
 
-            // the end of the vector is also an end of a block
-            // get async values for this block
-            part_values_future.push_back(get_values(part_cur,
-                get_local_indices(std::vector<size_type>(
-                    part_begin, pos_vec.end()))));
-
-            // This helper function unwraps the vectors from each partition
-            // and merge them to one vector
-            auto merge_func =
-                [&pos_vec](std::vector<future<std::vector<T> > > && part_values_f)
-                    -> std::vector<T>
+            // issue one action for each of the remote localities
+            std::vector<std::vector<std::size_t> > groups =
+                group_by_locality(local_pos);
+            if (groups.empty())
+                return make_ready_future(std::move(values));
+
+            std::vector<future<std::vector<std::vector<T> > > >
+                locality_values;
+            locality_values.reserve(groups.size());
+
+            for (std::vector<std::size_t> const& group : groups)
+            {
+                std::vector<hpx::id_type> parts;
+                std::vector<std::vector<size_type> > pos;
+                parts.reserve(group.size());
+                pos.reserve(group.size());
+
+                for (std::size_t part : group)
                 {
-                    std::vector<T> values;
-                    values.reserve(pos_vec.size());
+                    parts.push_back(partitions_[part].partition_);
+                    pos.push_back(std::move(local_pos[part]));
+                }
 
-                    for (future<std::vector<T> >& part_f: part_values_f)
-                    {
-                        std::vector<T> part_values = part_f.get();
-                        std::move(part_values.begin(), part_values.end(),
-                            std::back_inserter(values));
-                    }
-                    return values;
-                };
+                locality_values.push_back(partitioned_vector_partition_client(
+                    parts.front()).gather_values(parts, pos));
+            }
 
-            // when all values are here merge them to one vector
-            // and return a future to this vector
-            return dataflow(launch::async, merge_func,
-                std::move(part_values_future));
+            // put the values received back into the order of the positions
+            return dataflow(launch::sync,
+                gather_values_helper{std::move(values), std::move(indices),
+                    std::move(groups)},
+                std::move(locality_values));
         }
 
         /// Returns the elements at the positions \a pos
@@ -963,6 +1004,11 @@ namespace hpx
         /// Asynchronously set the element at position \a pos
         /// to the given value \a val.
         ///
+        /// The positions may be given in any order. They are grouped by the
+        /// locality owning them, and a single action is issued for each of
+        /// the remote localities involved. Elements stored on this locality
+        /// are written directly.
+        ///
         /// \param pos   Global position of the element in the vector
         /// \param val   The value to be copied
         ///
@@ -975,59 +1021,60 @@ namespace hpx
             HPX_ASSERT(pos.size() == val.size());
 
             // check if position vector is empty
-            // the following code needs at least one element.
             if (pos.empty())
                 return make_ready_future();
 
-            // partition index of the current block
-            size_type part_cur = get_partition(pos[0]);
-
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator pos_block_begin =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_block_begin = val.begin();
-
-            // vector holding futures of the state for all blocks
-            std::vector<future<void> > part_futures;
+            std::vector<std::vector<size_type> > local_pos;
+            std::vector<std::vector<std::size_t> > indices;
+            bucket_by_partition(pos, local_pos, indices);
 
-            // going through the position vector
-            typename std::vector<size_type>::const_iterator pos_it = pos.begin();
-            typename std::vector<T>::const_iterator val_it = val.begin();
-            for (/**/; pos_it != pos.end(); ++pos_it, ++val_it)
+            // collect the values for each of the partitions
+            std::vector<std::vector<T> > part_values(partitions_.size());
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*pos_it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
+                std::vector<std::size_t> const& idx = indices[part];
+                if (idx.empty())
                     continue;
 
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
+                part_values[part].reserve(idx.size());
+                for (std::size_t i : idx)
+                    part_values[part].push_back(val[i]);
+
+                // the partitions on this locality are accessed directly
+                if (partitions_[part].local_data_)
                 {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // set asynchronous values for this block
-                    part_futures.push_back(set_values(part_cur,
-                        get_local_indices(std::vector<size_type>(
-                            pos_block_begin, pos_it)),
-                        std::vector<T>(val_block_begin, val_it)));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    pos_block_begin = pos_it;
-                    val_block_begin = val_it;
+                    partitions_[part].local_data_->set_values(
+                        local_pos[part], part_values[part]);
                 }
             }
 
-            // the end of the vector is also an end of a block
-            // get asynchronous values for this block
-            part_futures.push_back(set_values(part_cur,
-                get_local_indices(std::vector<size_type>(
-                    pos_block_begin, pos.end())),
-                std::vector<T>(val_block_begin, val.end())));
+            // issue one action for each of the remote localities
+            std::vector<std::vector<std::size_t> > groups =
+                group_by_locality(local_pos);
+
+            std::vector<future<void> > part_futures;
+            part_futures.reserve(groups.size());
+
+            for (std::vector<std::size_t> const& group : groups)
+            {
+                std::vector<hpx::id_type> parts;
+                std::vector<std::vector<size_type> > locality_pos;
+                std::vector<std::vector<T> > locality_values;
+                parts.reserve(group.size());
+                locality_pos.reserve(group.size());
+                locality_values.reserve(group.size());
+
+                for (std::size_t part : group)
+                {
+                    parts.push_back(partitions_[part].partition_);
+                    locality_pos.push_back(std::move(local_pos[part]));
+                    locality_values.push_back(std::move(part_values[part]));
+                }
+
+                part_futures.push_back(partitioned_vector_partition_client(
+                    parts.front()).scatter_values(
+                        parts, locality_pos, locality_values));
+            }
 
             return when_all(part_futures);
         }
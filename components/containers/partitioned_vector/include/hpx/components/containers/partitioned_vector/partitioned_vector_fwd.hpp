@@ -19,6 +19,9 @@ namespace hpx
     template <typename T, typename Data = std::vector<T>>
     class partitioned_vector;
 
+    template <typename T, typename Data = std::vector<T>>
+    class partitioned_vector_cache;
+
     template <typename T, typename Data> class local_vector_iterator;
     template <typename T, typename Data> class const_local_vector_iterator;
 
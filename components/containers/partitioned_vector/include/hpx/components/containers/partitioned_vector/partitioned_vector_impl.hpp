@@ -33,6 +33,7 @@
 #include <cstdint>
 #include <functional>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -204,6 +205,54 @@ namespace hpx
         return indices;
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::bucket_by_partition(
+        std::vector<size_type> const& pos,
+        std::vector<std::vector<size_type> >& local_pos,
+        std::vector<std::vector<std::size_t> >& indices) const
+    {
+        local_pos.clear();
+        local_pos.resize(partitions_.size());
+        indices.clear();
+        indices.resize(partitions_.size());
+
+        for (std::size_t i = 0; i != pos.size(); ++i)
+        {
+            std::size_t part = get_partition(pos[i]);
+            HPX_ASSERT(part < partitions_.size());
+
+            local_pos[part].push_back(get_local_index(pos[i]));
+            indices[part].push_back(i);
+        }
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        std::vector<std::vector<std::size_t> >
+        partitioned_vector<T, Data>::group_by_locality(
+            std::vector<std::vector<size_type> > const& local_pos) const
+    {
+        std::vector<std::vector<std::size_t> > groups;
+        std::map<std::uint32_t, std::size_t> localities;
+
+        for (std::size_t part = 0; part != partitions_.size(); ++part)
+        {
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_ || local_pos[part].empty())
+                continue;
+
+            auto it = localities.emplace(
+                part_data.locality_id_, groups.size());
+            if (it.second)
+                groups.emplace_back();
+
+            groups[it.first->second].push_back(part);
+        }
+
+        return groups;
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector<T, Data>::local_iterator
@@ -9,6 +9,7 @@
 #define HPX_PARTITIONED_VECTOR_PREDEF_HPP
 
 #include <hpx/components/containers/partitioned_vector/export_definitions.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_cache.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
 
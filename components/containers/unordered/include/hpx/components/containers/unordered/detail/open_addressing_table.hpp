@@ -0,0 +1,755 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/detail/open_addressing_table.hpp
+
+#if !defined(HPX_UNORDERED_OPEN_ADDRESSING_TABLE_NOV_15_2019_1025AM)
+#define HPX_UNORDERED_OPEN_ADDRESSING_TABLE_NOV_15_2019_1025AM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A single open-addressing hash table using Robin Hood hashing. The
+    // elements are stored in place, ordered by their home slot within each
+    // run of occupied slots. This class is not thread-safe, it has no
+    // knowledge about how to hash or compare keys, all of its operations are
+    // passed the (well mixed) hash of the key.
+    template <typename Key, typename T>
+    class robin_hood_table
+    {
+    public:
+        typedef std::pair<Key, T> value_type;
+
+        static constexpr std::size_t npos = std::size_t(-1);
+
+    private:
+        typedef typename std::aligned_storage<
+                sizeof(value_type), alignof(value_type)
+            >::type storage_type;
+
+        // Every slot has a 32 bit metadata word: the upper 16 bits hold a
+        // fingerprint of the hash, the lower 16 bits hold the distance of the
+        // slot from the home slot of its element plus one. Zero marks an
+        // empty slot.
+        static constexpr std::uint32_t distance_mask = 0xffff;
+        static constexpr std::uint32_t max_distance = 0xfffd;
+
+        static std::uint32_t make_meta(std::uint64_t hash)
+        {
+            return (std::uint32_t(hash >> 32) << 16) | 1;
+        }
+
+    public:
+        robin_hood_table() noexcept
+          : mask_(0), size_(0)
+        {}
+
+        // capacity has to be a power of two
+        explicit robin_hood_table(std::size_t capacity)
+          : meta_(new std::uint32_t[capacity]())
+          , slots_(new storage_type[capacity])
+          , mask_(capacity - 1)
+          , size_(0)
+        {
+            HPX_ASSERT(capacity != 0 && (capacity & mask_) == 0);
+        }
+
+        robin_hood_table(robin_hood_table && rhs) noexcept
+          : meta_(std::move(rhs.meta_))
+          , slots_(std::move(rhs.slots_))
+          , mask_(rhs.mask_)
+          , size_(rhs.size_)
+        {
+            rhs.mask_ = 0;
+            rhs.size_ = 0;
+        }
+
+        robin_hood_table& operator=(robin_hood_table && rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                clear();
+
+                meta_ = std::move(rhs.meta_);
+                slots_ = std::move(rhs.slots_);
+                mask_ = rhs.mask_;
+                size_ = rhs.size_;
+
+                rhs.mask_ = 0;
+                rhs.size_ = 0;
+            }
+            return *this;
+        }
+
+        robin_hood_table(robin_hood_table const&) = delete;
+        robin_hood_table& operator=(robin_hood_table const&) = delete;
+
+        ~robin_hood_table()
+        {
+            clear();
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return meta_ ? mask_ + 1 : 0;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        bool occupied(std::size_t pos) const noexcept
+        {
+            return meta_[pos] != 0;
+        }
+
+        value_type& get(std::size_t pos) noexcept
+        {
+            HPX_ASSERT(occupied(pos));
+            return *reinterpret_cast<value_type*>(&slots_[pos]);
+        }
+
+        value_type const& get(std::size_t pos) const noexcept
+        {
+            HPX_ASSERT(occupied(pos));
+            return *reinterpret_cast<value_type const*>(&slots_[pos]);
+        }
+
+        // Return the slot holding the given key, or npos
+        template <typename KeyEqual>
+        std::size_t find(Key const& key, std::uint64_t hash,
+            KeyEqual const& equal) const
+        {
+            if (size_ == 0)
+                return npos;
+
+            std::size_t pos = std::size_t(hash) & mask_;
+            std::uint32_t expected = make_meta(hash);
+            for (/**/; /**/; ++expected)
+            {
+                std::uint32_t const meta = meta_[pos];
+                if (meta == expected && equal(get(pos).first, key))
+                    return pos;
+
+                // all elements beyond this one have a later home slot
+                if ((meta & distance_mask) < (expected & distance_mask))
+                    return npos;
+
+                pos = (pos + 1) & mask_;
+            }
+        }
+
+        // Insert a new element, the key must not be in the table yet and the
+        // table must have at least one empty slot. Returns false and leaves
+        // the table (and the value) unchanged if this would make any element
+        // too distant from its home slot.
+        bool insert(value_type && value, std::uint64_t hash)
+        {
+            HPX_ASSERT(size_ < capacity());
+
+            // find the first element which is closer to its home slot
+            std::size_t pos = std::size_t(hash) & mask_;
+            std::uint32_t meta = make_meta(hash);
+            while ((meta_[pos] & distance_mask) >= (meta & distance_mask))
+            {
+                if ((meta & distance_mask) == max_distance)
+                    return false;
+
+                pos = (pos + 1) & mask_;
+                ++meta;
+            }
+
+            // find the end of the run of elements which have to be moved
+            std::size_t last = pos;
+            while (meta_[last] != 0)
+            {
+                if ((meta_[last] & distance_mask) == max_distance)
+                    return false;
+
+                last = (last + 1) & mask_;
+            }
+
+            // shift them up by one slot, this keeps the elements ordered by
+            // their home slots
+            while (last != pos)
+            {
+                std::size_t const prev = (last - 1) & mask_;
+                new (&slots_[last]) value_type(std::move(get(prev)));
+                get(prev).~value_type();
+                meta_[last] = meta_[prev] + 1;
+                last = prev;
+            }
+
+            new (&slots_[pos]) value_type(std::move(value));
+            meta_[pos] = meta;
+            ++size_;
+
+            return true;
+        }
+
+        // Remove the element at the given slot, the elements following it are
+        // shifted down towards their home slots.
+        void erase(std::size_t pos)
+        {
+            get(pos).~value_type();
+
+            std::size_t next = (pos + 1) & mask_;
+            while ((meta_[next] & distance_mask) > 1)
+            {
+                new (&slots_[pos]) value_type(std::move(get(next)));
+                get(next).~value_type();
+                meta_[pos] = meta_[next] - 1;
+
+                pos = next;
+                next = (next + 1) & mask_;
+            }
+
+            meta_[pos] = 0;
+            --size_;
+        }
+
+        void clear() noexcept
+        {
+            if (size_ == 0)
+                return;
+
+            for (std::size_t pos = 0; pos != mask_ + 1; ++pos)
+            {
+                if (meta_[pos] != 0)
+                {
+                    get(pos).~value_type();
+                    meta_[pos] = 0;
+                }
+            }
+            size_ = 0;
+        }
+
+        template <typename F>
+        void for_each(F && f) const
+        {
+            for (std::size_t pos = 0; size_ != 0 && pos != mask_ + 1; ++pos)
+            {
+                if (meta_[pos] != 0)
+                    f(get(pos));
+            }
+        }
+
+    private:
+        std::unique_ptr<std::uint32_t[]> meta_;
+        std::unique_ptr<storage_type[]> slots_;
+        std::size_t mask_;
+        std::size_t size_;
+    };
+
+    template <typename Key, typename T>
+    constexpr std::size_t robin_hood_table<Key, T>::npos;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A thread-safe hash table made up of a power-of-two number of shards,
+    // each of which is a robin_hood_table protected by its own spinlock. The
+    // shard of a key is selected by the upper bits of its hash.
+    //
+    // A full shard does not rehash all of its elements at once. Its table is
+    // replaced by one of twice the size and every following insertion moves
+    // the elements of a few slots of the old table over to the new one. Until
+    // this is finished, lookups have to consult both tables.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class open_addressing_table
+    {
+    private:
+        typedef robin_hood_table<Key, T> table_type;
+        typedef lcos::local::spinlock mutex_type;
+
+        // smallest capacity of the table of a shard
+        static constexpr std::size_t min_capacity = 16;
+
+        // number of slots of the old table migrated on every insertion, this
+        // has to be at least two for the migration to finish before the new
+        // table is full
+        static constexpr std::size_t migration_step = 4;
+
+        struct shard
+        {
+            shard()
+              : migrated_(0)
+            {}
+
+            mutex_type mtx_;
+            table_type current_;
+            table_type previous_;    // being migrated to current_
+            std::size_t migrated_;   // slots of previous_ already migrated
+        };
+
+        typedef hpx::util::cache_line_data<shard> shard_data;
+
+        static std::size_t default_shard_count()
+        {
+            std::size_t const count = 4 * (std::max)(
+                threads::hardware_concurrency(), std::size_t(1));
+
+            std::size_t result = 16;
+            while (result < count && result < 4096)
+                result *= 2;
+            return result;
+        }
+
+        // keep the tables at most 7/8 full
+        static std::size_t max_load(std::size_t capacity)
+        {
+            return capacity - capacity / 8;
+        }
+
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef std::size_t size_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+
+        explicit open_addressing_table(size_type bucket_count = 0,
+                Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : num_shards_(default_shard_count())
+          , shards_(new shard_data[num_shards_])
+          , hash_(hash)
+          , equal_(equal)
+        {
+            if (bucket_count != 0)
+                reserve(bucket_count);
+        }
+
+        open_addressing_table(open_addressing_table const& rhs)
+          : open_addressing_table(rhs.size(), rhs.hash_, rhs.equal_)
+        {
+            rhs.for_each([this](value_type const& value) {
+                insert_or_assign(value.first, value.second);
+            });
+        }
+
+        open_addressing_table(open_addressing_table && rhs)
+          : open_addressing_table(0, rhs.hash_, rhs.equal_)
+        {
+            swap(rhs);
+        }
+
+        open_addressing_table& operator=(open_addressing_table const& rhs)
+        {
+            if (this != &rhs)
+            {
+                open_addressing_table tmp(rhs);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        open_addressing_table& operator=(open_addressing_table && rhs)
+        {
+            if (this != &rhs)
+            {
+                open_addressing_table tmp(std::move(rhs));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        // not thread-safe
+        void swap(open_addressing_table& rhs)
+        {
+            std::swap(num_shards_, rhs.num_shards_);
+            std::swap(shards_, rhs.shards_);
+            std::swap(hash_, rhs.hash_);
+            std::swap(equal_, rhs.equal_);
+        }
+
+        hasher hash_function() const
+        {
+            return hash_;
+        }
+
+        key_equal key_eq() const
+        {
+            return equal_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        size_type size() const
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.current_.size() + s.previous_.size();
+            }
+            return result;
+        }
+
+        size_type max_size() const
+        {
+            return num_shards_ * max_load(
+                (std::numeric_limits<std::size_t>::max)() /
+                    (sizeof(value_type) + sizeof(std::uint32_t)) / num_shards_);
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        // Make room for the given number of elements, assuming they are
+        // evenly spread over the shards
+        void reserve(size_type count)
+        {
+            std::size_t const per_shard =
+                (count + num_shards_ - 1) / num_shards_;
+
+            std::size_t capacity = min_capacity;
+            while (max_load(capacity) < per_shard)
+                capacity *= 2;
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                if (s.current_.empty() && s.previous_.empty())
+                {
+                    if (s.current_.capacity() < capacity)
+                        s.current_ = table_type(capacity);
+                    continue;
+                }
+
+                while (s.current_.capacity() < capacity)
+                    grow(s);
+            }
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.current_.clear();
+                s.previous_ = table_type();
+                s.migrated_ = 0;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Copy the value stored for the given key, returns false if the key
+        // was not found.
+        bool find(Key const& key, T& value) const
+        {
+            std::uint64_t const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            value_type const* p = lookup(s, key, hash);
+            if (p == nullptr)
+                return false;
+
+            value = p->second;
+            return true;
+        }
+
+        // Look up all given keys, taking the lock of every shard only once.
+        // Returns the index of the first key which was not found or the
+        // number of keys if all of them were found.
+        size_type find(std::vector<Key> const& keys,
+            std::vector<T>& values) const
+        {
+            values.resize(keys.size());
+
+            std::size_t missing = keys.size();
+            for_each_shard(keys,
+                [&](shard& s, std::size_t i, std::uint64_t hash) {
+                    value_type const* p = lookup(s, keys[i], hash);
+                    if (p != nullptr)
+                        values[i] = p->second;
+                    else if (i < missing)
+                        missing = i;
+                });
+            return missing;
+        }
+
+        // Move the value stored for the given key out of the table and erase
+        // the key, returns false if the key was not found.
+        bool extract(Key const& key, T& value)
+        {
+            std::uint64_t const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            table_type* table = nullptr;
+            std::size_t pos = locate(s, key, hash, table);
+            if (pos == table_type::npos)
+                return false;
+
+            value = std::move(table->get(pos).second);
+            table->erase(pos);
+            return true;
+        }
+
+        // Insert the key or assign the value if it already exists, returns
+        // true if the key was inserted.
+        template <typename T_>
+        bool insert_or_assign(Key const& key, T_ && value)
+        {
+            std::uint64_t const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return insert_or_assign(s, key, hash, std::forward<T_>(value));
+        }
+
+        // Insert or assign all given elements, taking the lock of every
+        // shard only once. If a key is given more than once, the last value
+        // wins.
+        void insert_or_assign(std::vector<Key> const& keys,
+            std::vector<T> const& values)
+        {
+            HPX_ASSERT(keys.size() == values.size());
+
+            for_each_shard(keys,
+                [&](shard& s, std::size_t i, std::uint64_t hash) {
+                    insert_or_assign(s, keys[i], hash, values[i]);
+                });
+        }
+
+        // Returns the number of erased elements
+        size_type erase(Key const& key)
+        {
+            std::uint64_t const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            table_type* table = nullptr;
+            std::size_t pos = locate(s, key, hash, table);
+            if (pos == table_type::npos)
+                return 0;
+
+            table->erase(pos);
+            return 1;
+        }
+
+        // Call f for every element, one shard at a time while holding its
+        // lock. f must not access the table.
+        template <typename F>
+        void for_each(F && f) const
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.current_.for_each(f);
+                s.previous_.for_each(f);
+            }
+        }
+
+    private:
+        std::uint64_t hash_key(Key const& key) const
+        {
+            // std::hash is the identity for integral types, mix the bits to
+            // make all of them usable for selecting shards and slots
+            std::uint64_t hash =
+                std::uint64_t(hash_(key)) * 0x9e3779b97f4a7c15ull;
+            return hash ^ (hash >> 32);
+        }
+
+        std::size_t shard_index(std::uint64_t hash) const
+        {
+            return std::size_t(hash >> 48) & (num_shards_ - 1);
+        }
+
+        shard& get_shard(std::uint64_t hash) const
+        {
+            return shards_[shard_index(hash)].data_;
+        }
+
+        // Call f(shard, index, hash) for all given keys, grouped by shard
+        // and in their original order within each shard.
+        template <typename F>
+        void for_each_shard(std::vector<Key> const& keys, F && f) const
+        {
+            std::size_t const count = keys.size();
+
+            std::vector<std::uint64_t> hashes(count);
+            std::vector<std::size_t> offsets(num_shards_ + 1, 0);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                hashes[i] = hash_key(keys[i]);
+                ++offsets[shard_index(hashes[i]) + 1];
+            }
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            // counting sort of the key indices by shard
+            std::vector<std::size_t> order(count);
+            {
+                std::vector<std::size_t> next(
+                    offsets.begin(), offsets.end() - 1);
+                for (std::size_t i = 0; i != count; ++i)
+                    order[next[shard_index(hashes[i])]++] = i;
+            }
+
+            for (std::size_t k = 0; k != num_shards_; ++k)
+            {
+                if (offsets[k] == offsets[k + 1])
+                    continue;
+
+                shard& s = shards_[k].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                for (std::size_t j = offsets[k]; j != offsets[k + 1]; ++j)
+                    f(s, order[j], hashes[order[j]]);
+            }
+        }
+
+        std::size_t locate(shard& s, Key const& key, std::uint64_t hash,
+            table_type*& table) const
+        {
+            std::size_t pos = s.current_.find(key, hash, equal_);
+            if (pos != table_type::npos)
+            {
+                table = &s.current_;
+                return pos;
+            }
+
+            pos = s.previous_.find(key, hash, equal_);
+            if (pos != table_type::npos)
+                table = &s.previous_;
+            return pos;
+        }
+
+        value_type const* lookup(shard& s, Key const& key,
+            std::uint64_t hash) const
+        {
+            table_type* table = nullptr;
+            std::size_t pos = locate(s, key, hash, table);
+            if (pos == table_type::npos)
+                return nullptr;
+            return &table->get(pos);
+        }
+
+        template <typename T_>
+        bool insert_or_assign(shard& s, Key const& key, std::uint64_t hash,
+            T_ && value)
+        {
+            table_type* table = nullptr;
+            std::size_t pos = locate(s, key, hash, table);
+            if (pos != table_type::npos)
+            {
+                table->get(pos).second = std::forward<T_>(value);
+                return false;
+            }
+
+            value_type element(key, std::forward<T_>(value));
+            while (s.current_.size() + s.previous_.size() >=
+                    max_load(s.current_.capacity()) ||
+                !s.current_.insert(std::move(element), hash))
+            {
+                grow(s);
+            }
+
+            migrate(s, migration_step);
+            return true;
+        }
+
+        // Replace the table of the shard by one of twice the size, any
+        // pending migration is finished first.
+        void grow(shard& s)
+        {
+            migrate(s, std::size_t(-1));
+
+            std::size_t const capacity = s.current_.capacity();
+            table_type table(capacity == 0 ? min_capacity : 2 * capacity);
+
+            if (!s.current_.empty())
+                s.previous_ = std::move(s.current_);
+            s.current_ = std::move(table);
+            s.migrated_ = 0;
+        }
+
+        // Move the elements of the next 'count' slots of the old table of
+        // the shard over to its current table.
+        void migrate(shard& s, std::size_t count)
+        {
+            if (s.previous_.empty())
+                return;
+
+            std::size_t const capacity = s.previous_.capacity();
+            for (/**/; count != 0 && s.migrated_ != capacity;
+                 --count, ++s.migrated_)
+            {
+                // erasing an element shifts the following ones down into
+                // the same slot
+                while (s.previous_.occupied(s.migrated_))
+                {
+                    // the element is moved only if it could be inserted, it
+                    // stays in the old table otherwise
+                    value_type& element = s.previous_.get(s.migrated_);
+                    std::uint64_t const hash = hash_key(element.first);
+                    if (!s.current_.insert(std::move(element), hash))
+                    {
+                        HPX_THROW_EXCEPTION(out_of_memory,
+                            "open_addressing_table::migrate",
+                            "too many colliding keys, check the quality of "
+                            "the hash function");
+                    }
+                    s.previous_.erase(s.migrated_);
+                }
+            }
+
+            // all slots before migrated_ are empty, release the old table
+            // once it has been completely migrated
+            HPX_ASSERT(s.migrated_ != capacity || s.previous_.empty());
+            if (s.previous_.empty())
+            {
+                s.previous_ = table_type();
+                s.migrated_ = 0;
+            }
+        }
+
+    private:
+        std::size_t num_shards_;
+        std::unique_ptr<shard_data[]> shards_;
+        Hash hash_;
+        KeyEqual equal_;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    constexpr std::size_t
+        open_addressing_table<Key, T, Hash, KeyEqual>::min_capacity;
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    constexpr std::size_t
+        open_addressing_table<Key, T, Hash, KeyEqual>::migration_step;
+}}
+
+#endif
@@ -13,13 +13,15 @@
 ///
 /// \brief The partition_unordered_map as the hpx component is defined here.
 ///
-/// The partition_unordered_map is the wrapper to the stl unordered_map class
-/// except all API'are defined as component action. All the API's in client
-/// classes are asynchronous API which return the futures.
+/// The partition_unordered_map stores its elements in a concurrent
+/// open-addressing hash table, all API's are defined as component actions.
+/// All the API's in client classes are asynchronous API which return the
+/// futures.
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/collectives.hpp>
+#include <hpx/components/containers/unordered/detail/open_addressing_table.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
@@ -28,7 +30,6 @@
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/component_factory.hpp>
-#include <hpx/runtime/components/server/locking_hook.hpp>
 #include <hpx/runtime/components/server/simple_component_base.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/launch_policy.hpp>
@@ -45,31 +46,34 @@
 
 namespace hpx { namespace server
 {
-    /// \brief This is the basic wrapper class for stl unordered_map.
+    /// \brief This is the basic wrapper class for a concurrent hash table.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in an
+    /// open-addressing hash table which can be accessed concurrently, both
+    /// by the actions and by local clients calling the member functions
+    /// directly.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key> >
     class partition_unordered_map
-      : public components::locking_hook<
-            hpx::components::simple_component_base<
-                partition_unordered_map<Key, T, Hash, KeyEqual> > >
+      : public hpx::components::simple_component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual> >
     {
     public:
+        /// The type used to transfer all elements of a partition at once
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
-        typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
+        typedef hpx::detail::open_addressing_table<Key, T, Hash, KeyEqual>
+            table_type;
 
-        typedef components::locking_hook<
-                hpx::components::simple_component_base<
-                    partition_unordered_map<Key, T, Hash, KeyEqual> > >
+        typedef typename table_type::size_type size_type;
+
+        typedef hpx::components::simple_component_base<
+                partition_unordered_map<Key, T, Hash, KeyEqual> >
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        table_type partition_unordered_map_;
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -125,38 +129,23 @@ namespace hpx { namespace server
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
-        }
-        void set_copied_data(data_type && d)
-        {
-            partition_unordered_map_ = std::move(d);
-        }
+            data_type d(partition_unordered_map_.size(),
+                partition_unordered_map_.hash_function(),
+                partition_unordered_map_.key_eq());
 
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
+            partition_unordered_map_.for_each(
+                [&](typename table_type::value_type const& v) {
+                    d.emplace(v.first, v.second);
+                });
+            return d;
         }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
+        void set_copied_data(data_type && d)
         {
-            return partition_unordered_map_.cbegin();
-        }
+            table_type t(d.size(), d.hash_function(), d.key_eq());
+            for (auto& v : d)
+                t.insert_or_assign(v.first, std::move(v.second));
 
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+            partition_unordered_map_ = std::move(t);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -175,15 +164,7 @@ namespace hpx { namespace server
             return partition_unordered_map_.max_size();
         }
 
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
-        {
-            return partition_unordered_map_.capacity();
-        }
-
-        /// Checks if the container has no elements, i.e. whether
-        /// begin() == end().
+        /// Checks if the container has no elements
         bool empty() const
         {
             return partition_unordered_map_.empty();
@@ -193,72 +174,49 @@ namespace hpx { namespace server
         // Element access API's
         ///////////////////////////////////////////////////////////////////////
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the element with the given key in the
+        /// partition_unordered_map container.
         ///
-        /// \param pos Position of the element in the partition_unordered_map
+        /// \param key   Key of the element in the partition_unordered_map
+        /// \param erase Remove the element from the partition
         ///
-        /// \return Return the value of the element at position represented
-        ///         by \a pos.
+        /// \return Return the value of the element with the given key.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m), it_(it)
-            {}
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it = partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            T value;
+            bool const found = erase ?
+                partition_unordered_map_.extract(key, value) :
+                partition_unordered_map_.find(key, value);
+
+            if (!found)
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return value;
         }
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the elements with the given keys in the
+        /// partition_unordered_map container. The keys are looked up in
+        /// batches, taking the lock protecting every part of the table only
+        /// once.
         ///
-        /// \param pos Positions of the elements in the partition_unordered_map
+        /// \param keys Keys of the elements in the partition_unordered_map
         ///
-        /// \return Return the values of the elements at position represented
-        ///         by \a pos.
+        /// \return Return the values of the elements with the given keys.
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
             std::vector<T> result;
-            result.reserve(keys.size());
-
-            for (std::size_t i = 0; i != keys.size(); ++i)
+            if (partition_unordered_map_.find(keys, result) != keys.size())
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
-                {
-                    HPX_THROW_EXCEPTION(bad_parameter,
-                        "partition_unordered_map::get_values",
-                        "unable to find requested key in this partition of the "
-                        "unordered_map");
-                    break;
-                }
-                result.push_back(it->second);
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partition_unordered_map::get_values",
+                    "unable to find requested key in this partition of the "
+                    "unordered_map");
             }
             return result;
         }
@@ -267,33 +225,32 @@ namespace hpx { namespace server
         // Modifiers API's in server class
         ///////////////////////////////////////////////////////////////////////
 
-        /// Copy the value of \a val in the element at position \a pos in the
-        /// partition_unordered_map container.
+        /// Copy the value of \a val in the element with the given key in
+        /// the partition_unordered_map container, the element is inserted
+        /// if it does not exist yet.
         ///
-        /// \param pos   Position of the element in the partition_unordered_map
+        /// \param pos   Key of the element in the partition_unordered_map
         ///
         /// \param val   The value to be copied
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
         }
 
-        /// Copy the value of \a val for the elements at positions \a pos in
-        /// the partition_unordered_map container.
+        /// Copy the value of \a val for the elements with the given keys in
+        /// the partition_unordered_map container, elements are inserted if
+        /// they do not exist yet.
         ///
-        /// \param pos   Positions of the elements in the partition_unordered_map
+        /// \param keys  Keys of the elements in the partition_unordered_map
         ///
-        /// \param val   The value to be copied
+        /// \param val   The values to be copied
         ///
         void set_values(std::vector<Key> const& keys,
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
-
-            for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+            partition_unordered_map_.insert_or_assign(keys, val);
         }
 
         /// Remove all elements from the vector leaving the
@@ -5,6 +5,8 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
 #include <hpx/include/traits.hpp>
 #include <hpx/include/unordered_map.hpp>
 #include <hpx/testing.hpp>
@@ -76,6 +78,39 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST(m.size() == count);
 }
 
+// The partitions are accessed concurrently by local and remote clients,
+// the number of elements makes the partitions grow several times.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_concurrent_access(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+    std::size_t count)
+{
+    std::size_t const num_tasks = 8;
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&m, t, count]() {
+            for (std::size_t i = t; i < count; i += num_tasks)
+            {
+                std::string idx = std::to_string(i);
+                m.set_value(hpx::launch::sync, idx, Value(i));
+                if (i % 3 == 0)
+                    m.erase(hpx::launch::sync, idx);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(m.size(), count - (count + 2) / 3);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        if (i % 3 != 0)
+        {
+            HPX_TEST_EQ(m[std::to_string(i)], Value(i));
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -107,6 +142,11 @@ void trivial_tests(DistPolicy const& policy)
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
     }
+
+    {
+        hpx::unordered_map<Key, Value> m(policy);
+        test_concurrent_access(m, 10007);
+    }
 }
 
 template <typename Key, typename Value>
@@ -148,6 +188,11 @@ void trivial_tests()
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
     }
+
+    {
+        hpx::unordered_map<Key, Value> m;
+        test_concurrent_access(m, 10007);
+    }
 }
 
 int main()
@@ -12,7 +12,9 @@
 #include <hpx/parallel/executors/auto_chunk_size.hpp>
 #include <hpx/parallel/executors/dynamic_chunk_size.hpp>
 #include <hpx/parallel/executors/guided_chunk_size.hpp>
+#include <hpx/parallel/executors/lazy_binary_splitting.hpp>
 #include <hpx/parallel/executors/persistent_auto_chunk_size.hpp>
+#include <hpx/parallel/executors/single_pass_scan.hpp>
 #include <hpx/parallel/executors/static_chunk_size.hpp>
 
 #endif
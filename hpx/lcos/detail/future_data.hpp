@@ -8,6 +8,7 @@
 #define HPX_LCOS_DETAIL_FUTURE_DATA_MAR_06_2012_1055AM
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/errors.hpp>
@@ -76,6 +77,40 @@ namespace hpx { namespace lcos { namespace detail {
 
         virtual ~future_data_refcnt_base();
 
+        // Shared states are allocated and released at a high rate, recycle
+        // their memory through the per-thread cache. This applies to all
+        // derived shared states (continuations, dataflow and when_all
+        // frames, etc.) unless they are created using an explicit allocator.
+        static void* operator new(std::size_t size)
+        {
+            return util::detail::thread_local_cache_allocate(size);
+        }
+
+        static void operator delete(void* p, std::size_t size) noexcept
+        {
+            util::detail::thread_local_cache_deallocate(p, size);
+        }
+
+#if defined(__cpp_aligned_new)
+        static void* operator new(std::size_t size, std::align_val_t align)
+        {
+            return ::operator new(size, align);
+        }
+
+        static void operator delete(
+            void* p, std::size_t size, std::align_val_t align) noexcept
+        {
+            ::operator delete(p, size, align);
+        }
+#endif
+
+        static void* operator new(std::size_t, void* p) noexcept
+        {
+            return p;
+        }
+
+        static void operator delete(void*, void*) noexcept {}
+
         virtual void set_on_completed(completed_callback_type) = 0;
 
         virtual bool requires_delete()
@@ -18,6 +18,7 @@
 #include <hpx/statistics/histogram.hpp>
 #include <hpx/util/pool_timer.hpp>
 
+#include <hpx/plugins/parcel/coalescing_parameters.hpp>
 #include <hpx/plugins/parcel/message_buffer.hpp>
 
 #include <cstddef>
@@ -79,12 +80,12 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_max_latency();
 
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
-        std::size_t num_coalesced_parcels_;
-        std::size_t interval_;
+        detail::coalescing_parameters parameters_;
         detail::message_buffer buffer_;
         util::pool_timer timer_;
         bool stopped_;
@@ -102,10 +103,7 @@ namespace hpx { namespace plugins { namespace parcel
         std::int64_t reset_time_num_parcels_;
         std::int64_t last_parcel_time_;
 
-        typedef boost::accumulators::accumulator_set<
-                double,     // collects percentiles
-                boost::accumulators::features<hpx::util::tag::histogram>
-            > histogram_collector_type;
+        typedef detail::histogram_collector_type histogram_collector_type;
 
         std::unique_ptr<histogram_collector_type> time_between_parcels_;
         std::int64_t histogram_min_boundary_;
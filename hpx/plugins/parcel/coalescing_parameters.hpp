@@ -0,0 +1,224 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PLUGINS_PARCEL_COALESCING_PARAMETERS_OCT_18_2019_1015AM)
+#define HPX_PLUGINS_PARCEL_COALESCING_PARAMETERS_OCT_18_2019_1015AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/statistics/histogram.hpp>
+
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace plugins { namespace parcel { namespace detail
+{
+    typedef boost::accumulators::accumulator_set<
+            double,     // collects percentiles
+            boost::accumulators::features<hpx::util::tag::histogram>
+        > histogram_collector_type;
+
+    inline bool get_adaptive()
+    {
+        std::string value = hpx::get_config_entry(
+            "hpx.plugins.coalescing_message_handler.adaptive", "0");
+        return !value.empty() && value[0] != '0';
+    }
+
+    inline std::size_t get_max_latency(std::size_t max_latency)
+    {
+        return boost::lexical_cast<std::size_t>(hpx::get_config_entry(
+            "hpx.plugins.coalescing_message_handler.max_latency",
+            max_latency));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of parcels to coalesce into one message and the time to
+    // wait for them to arrive.
+    //
+    // If adaptive coalescing is enabled, both are derived after each flushed
+    // message from the histogram of the time between parcels and from the
+    // backlog of the parcelport. The configured number of messages and
+    // interval remain upper bounds, the parcels are not delayed by more than
+    // the maximal latency (in microseconds). Otherwise the configured values
+    // are used as is.
+    class coalescing_parameters
+    {
+    public:
+        coalescing_parameters(std::size_t num_messages, std::size_t interval)
+          : adaptive_(get_adaptive())
+          , num_messages_(num_messages)
+          , interval_(interval)
+          , max_latency_(get_max_latency(interval))
+          , batch_size_(num_messages)
+          , flush_interval_(
+                adaptive_ ? (std::min)(interval, max_latency_) : interval)
+        {
+        }
+
+        bool adaptive() const { return adaptive_; }
+        std::size_t num_messages() const { return num_messages_; }
+        std::size_t interval() const { return interval_; }
+        std::size_t max_latency() const { return max_latency_; }
+
+        // the number of parcels to coalesce into the next message
+        std::size_t batch_size() const { return batch_size_; }
+
+        // the time to wait for the next message to fill up [us]
+        std::size_t flush_interval() const { return flush_interval_; }
+
+        void set_num_messages(std::size_t num_messages)
+        {
+            num_messages_ = num_messages;
+            if (!adaptive_ || batch_size_ > num_messages_)
+                batch_size_ = num_messages_;
+        }
+
+        void set_interval(std::size_t interval)
+        {
+            interval_ = interval;
+            if (!adaptive_ || flush_interval_ > interval_)
+                flush_interval_ = interval_;
+        }
+
+        void set_max_latency(std::size_t max_latency)
+        {
+            max_latency_ = max_latency;
+            if (adaptive_ && flush_interval_ > max_latency_)
+                flush_interval_ = max_latency_;
+        }
+
+        // Called after each flushed message with the histogram of the time
+        // between parcels [ns] and the number of parcels waiting in the
+        // parcelport for the destination of the message.
+        void adjust(histogram_collector_type const& time_between_parcels,
+            std::int64_t pending_parcels)
+        {
+            if (!adaptive_)
+                return;
+
+            std::size_t const max_latency =
+                (std::min)(interval_, max_latency_) * 1000;     // [ns]
+
+            // collect as many parcels as are expected to arrive within the
+            // latency budget
+            std::int64_t const time_between =
+                get_time_between_parcels(time_between_parcels);
+
+            std::size_t batch_size = batch_size_;
+            if (time_between == 0)
+            {
+                batch_size = num_messages_;
+            }
+            else if (time_between > 0)
+            {
+                batch_size =
+                    max_latency / static_cast<std::size_t>(time_between);
+            }
+
+            // parcels queuing up in the parcelport mean that messages are not
+            // sent as fast as they are produced, coalesce more aggressively
+            // to reduce the per-message overhead
+            if (pending_parcels > std::int64_t(batch_size_))
+            {
+                batch_size = (std::max)(batch_size, 2 * batch_size_);
+            }
+
+            batch_size_ = clamp(batch_size, std::size_t(1), num_messages_);
+
+            // don't wait longer than needed for the batch to fill up
+            if (time_between >= 0)
+            {
+                std::size_t const interval = (batch_size_ *
+                    static_cast<std::size_t>(time_between)) / 1000;
+                flush_interval_ = clamp(interval, std::size_t(1),
+                    (std::max)(max_latency / 1000, std::size_t(1)));
+            }
+        }
+
+    private:
+        template <typename T>
+        static T clamp(T value, T min_value, T max_value)
+        {
+            return (std::min)((std::max)(value, min_value), max_value);
+        }
+
+        // The median of the times between the parcels which arrived since
+        // the last call, or -1 if there were none. The histogram accumulates
+        // all samples, the number of samples in each bin seen by the
+        // previous call is subtracted to track changes of the load.
+        std::int64_t get_time_between_parcels(
+            histogram_collector_type const& time_between_parcels)
+        {
+            auto histogram = hpx::util::histogram(time_between_parcels);
+            std::vector<std::pair<double, double>> const data(
+                histogram.begin(), histogram.end());
+            double const count =
+                double(boost::accumulators::count(time_between_parcels));
+
+            std::size_t const num_bins = data.size();
+            if (num_bins < 3)
+                return -1;
+
+            // the samples which arrived since the previous call
+            std::vector<double> samples(num_bins);
+            double num_samples = 0;
+            samples_in_bin_.resize(num_bins, 0.);
+            for (std::size_t i = 0; i != num_bins; ++i)
+            {
+                double const total = std::round(data[i].second * count);
+                samples[i] = total - samples_in_bin_[i];
+                samples_in_bin_[i] = total;
+                num_samples += samples[i];
+            }
+
+            if (num_samples <= 0)
+                return -1;
+
+            std::size_t i = 0;
+            for (double seen = 0; i != num_bins - 1; ++i)
+            {
+                seen += samples[i];
+                if (2 * seen >= num_samples)
+                    break;
+            }
+
+            // samples below and beyond the covered range are accounted at
+            // its bounds, all others at the center of their bin
+            double time_between = 0;
+            if (i == 0)
+                time_between = data[1].first;
+            else if (i == num_bins - 1)
+                time_between = data[num_bins - 1].first;
+            else
+                time_between = (data[i].first + data[i + 1].first) / 2;
+
+            return (std::max)(std::int64_t(time_between), std::int64_t(0));
+        }
+
+        bool adaptive_;
+        std::size_t num_messages_;
+        std::size_t interval_;
+        std::size_t max_latency_;
+        std::size_t batch_size_;
+        std::size_t flush_interval_;
+        std::vector<double> samples_in_bin_;
+    };
+}}}}
+
+#endif
+#endif
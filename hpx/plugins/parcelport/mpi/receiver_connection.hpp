@@ -15,6 +15,7 @@
 #include <hpx/plugins/parcelport/mpi/header.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -64,7 +65,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 
-            buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
+            acquire_parcel_buffer(buffer_.data_,
+                static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
         }
 
@@ -165,7 +167,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
                 std::size_t chunk_size = buffer_.transmission_chunks_[idx].second;
 
                 data_type & c = buffer_.chunks_[idx];
-                c.resize(chunk_size);
+                acquire_parcel_buffer(c, chunk_size);
                 {
                     util::mpi_environment::scoped_lock l;
                     MPI_Irecv(
@@ -0,0 +1,313 @@
+//  Copyright (c) 2019 Ste||ar Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assertion.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_timer.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Reassembles the messages written by one sender_connection into a ring.
+    template <typename Parcelport>
+    struct receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            initialized
+          , rcvd_header
+          , rcvd_data
+        };
+
+        typedef std::vector<char> data_type;
+        typedef parcel_buffer<data_type, data_type> buffer_type;
+
+        // one contiguous piece of the incoming message
+        struct piece
+        {
+            char* data_;
+            std::size_t size_;
+        };
+
+    public:
+        receiver_connection(ring r, Parcelport& pp)
+          : state_(initialized)
+          , ring_(r)
+          , piece_idx_(0)
+          , offset_(0)
+          , pp_(pp)
+        {
+            expect_header();
+        }
+
+        // No partially received message is pending.
+        bool idle() const
+        {
+            return state_ == initialized && piece_idx_ == 0 && offset_ == 0;
+        }
+
+        // Make progress on the current message, returns whether any data
+        // was consumed from the ring.
+        bool receive(std::size_t num_thread = -1)
+        {
+            bool has_work = false;
+            while (fill(has_work))
+            {
+                switch (state_)
+                {
+                case initialized:
+                    expect_data();
+                    break;
+
+                case rcvd_header:
+                    expect_chunks();
+                    break;
+
+                case rcvd_data:
+                    done(num_thread);
+                    return true;
+
+                default:
+                    HPX_ASSERT(false);
+                }
+            }
+            return has_work;
+        }
+
+    private:
+        void add_piece(void* data, std::size_t size)
+        {
+            if (size != 0)
+                pieces_.push_back(piece{static_cast<char*>(data), size});
+        }
+
+        // read data into the current pieces, returns true once all of them
+        // have been filled
+        bool fill(bool& has_work)
+        {
+            while (piece_idx_ != pieces_.size())
+            {
+                piece const& p = pieces_[piece_idx_];
+                std::size_t count =
+                    ring_.read(p.data_ + offset_, p.size_ - offset_);
+                if (count == 0)
+                    return false;
+
+                has_work = true;
+                offset_ += count;
+                if (offset_ != p.size_)
+                    return false;
+
+                offset_ = 0;
+                ++piece_idx_;
+            }
+            return true;
+        }
+
+        void reset_pieces()
+        {
+            pieces_.clear();
+            piece_idx_ = 0;
+            offset_ = 0;
+        }
+
+        void expect_header()
+        {
+            reset_pieces();
+            state_ = initialized;
+
+            add_piece(&buffer_.size_, sizeof(buffer_.size_));
+            add_piece(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_piece(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+        }
+
+        void expect_data()
+        {
+            reset_pieces();
+            state_ = rcvd_header;
+
+            performance_counters::parcels::data_point& data =
+                buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(buffer_.size_);
+
+            std::size_t num_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            std::size_t num_non_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+            if (num_zero_copy_chunks != 0)
+            {
+                buffer_.transmission_chunks_.resize(
+                    num_zero_copy_chunks + num_non_zero_copy_chunks);
+                add_piece(buffer_.transmission_chunks_.data(),
+                    buffer_.transmission_chunks_.size() *
+                        sizeof(buffer_type::transmission_chunk_type));
+            }
+
+            buffer_.data_.resize(static_cast<std::size_t>(buffer_.size_));
+            add_piece(buffer_.data_.data(), buffer_.data_.size());
+        }
+
+        void expect_chunks()
+        {
+            reset_pieces();
+            state_ = rcvd_data;
+
+            // zero-copy chunks are read from the ring directly into their
+            // final buffers
+            std::size_t num_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                std::size_t chunk_size = static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[i].second);
+                buffer_.chunks_[i].resize(chunk_size);
+                add_piece(buffer_.chunks_[i].data(), chunk_size);
+            }
+        }
+
+        void done(std::size_t num_thread)
+        {
+            performance_counters::parcels::data_point& data =
+                buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+
+            decode_parcels(pp_, std::move(buffer_), num_thread);
+            buffer_ = buffer_type();
+
+            expect_header();
+        }
+
+        util::high_resolution_timer timer_;
+
+        connection_state state_;
+        ring ring_;
+        buffer_type buffer_;
+
+        std::vector<piece> pieces_;
+        std::size_t piece_idx_;
+        std::size_t offset_;
+
+        Parcelport& pp_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Owns the inbound segment of this locality and drains all of its rings.
+    template <typename Parcelport>
+    struct receiver
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+        typedef receiver_connection<Parcelport> connection_type;
+
+        struct slot
+        {
+            mutex_type mtx_;
+            std::unique_ptr<connection_type> connection_;
+        };
+
+        receiver(Parcelport& pp)
+          : pp_(pp)
+          , next_slot_(0)
+        {}
+
+        void run(std::string const& name, std::size_t num_slots,
+            std::size_t ring_size)
+        {
+            segment_.create(name, num_slots, ring_size);
+            slots_.reset(new slot[num_slots]);
+        }
+
+        void stop()
+        {
+            segment_.close();
+        }
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            if (!segment_)
+                return false;
+
+            // start at a different slot each time to avoid starving
+            // senders which happen to have claimed a high slot number
+            std::size_t num_slots = segment_.num_slots();
+            std::size_t start = next_slot_++ % num_slots;
+
+            bool has_work = false;
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                std::size_t idx = (start + i) % num_slots;
+                has_work = receive_messages(idx, num_thread) || has_work;
+            }
+            return has_work;
+        }
+
+    private:
+        bool receive_messages(std::size_t idx, std::size_t num_thread)
+        {
+            ring r = segment_.get_ring(idx);
+            std::uint32_t state =
+                r.control().state_.data_.load(std::memory_order_acquire);
+            if (state == ring_control::slot_free)
+                return false;
+
+            slot& s = slots_[idx];
+            std::unique_lock<mutex_type> l(s.mtx_, std::try_to_lock);
+            if (!l)
+                return false;
+
+            if (!s.connection_)
+                s.connection_.reset(new connection_type(r, pp_));
+
+            bool has_work = s.connection_->receive(num_thread);
+
+            // a closed ring can be handed out again once the sender's last
+            // message has been consumed entirely
+            if (state == ring_control::slot_closed &&
+                s.connection_->idle() && r.empty())
+            {
+                s.connection_.reset();
+                segment_.recycle_slot(idx);
+            }
+            return has_work;
+        }
+
+        Parcelport& pp_;
+
+        segment segment_;
+        std::unique_ptr<slot[]> slots_;
+        std::atomic<std::size_t> next_slot_;
+    };
+}}}}
+
+#endif
+
+#endif
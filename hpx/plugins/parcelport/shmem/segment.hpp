@@ -0,0 +1,410 @@
+//  Copyright (c) 2019 Ste||ar Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/errors.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Control block of one single-producer/single-consumer byte ring living
+    // in shared memory. The producer only ever advances head_, the consumer
+    // only ever advances tail_, both are monotonically increasing byte
+    // counts. The data area (a power of two in size) follows all control
+    // blocks of a segment.
+    struct ring_control
+    {
+        enum slot_state : std::uint32_t
+        {
+            slot_free = 0,          // may be claimed by a sender
+            slot_claimed = 1,       // in use by exactly one sender
+            slot_closed = 2         // sender is gone, drain and recycle
+        };
+
+        util::cache_line_data<std::atomic<std::uint32_t> > state_;
+        util::cache_line_data<std::atomic<std::uint64_t> > head_;
+        util::cache_line_data<std::atomic<std::uint64_t> > tail_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Lightweight view of a ring inside a mapped segment.
+    class ring
+    {
+    public:
+        ring()
+          : ctrl_(nullptr), data_(nullptr), mask_(0)
+        {}
+
+        ring(ring_control* ctrl, char* data, std::uint64_t size)
+          : ctrl_(ctrl), data_(data), mask_(size - 1)
+        {
+            HPX_ASSERT((size & (size - 1)) == 0);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return ctrl_ != nullptr;
+        }
+
+        ring_control& control() const
+        {
+            return *ctrl_;
+        }
+
+        // Copy as many bytes as currently fit, returns number of bytes
+        // written (producer side only).
+        std::size_t write(void const* src, std::size_t size)
+        {
+            std::uint64_t head = ctrl_->head_.data_.load(std::memory_order_relaxed);
+            std::uint64_t tail = ctrl_->tail_.data_.load(std::memory_order_acquire);
+
+            std::size_t count = (std::min)(size,
+                static_cast<std::size_t>(mask_ + 1 - (head - tail)));
+            if (count == 0)
+                return 0;
+
+            copy_in(head, static_cast<char const*>(src), count);
+            ctrl_->head_.data_.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        // Copy as many bytes as are currently available, returns number of
+        // bytes read (consumer side only).
+        std::size_t read(void* dest, std::size_t size)
+        {
+            std::uint64_t tail = ctrl_->tail_.data_.load(std::memory_order_relaxed);
+            std::uint64_t head = ctrl_->head_.data_.load(std::memory_order_acquire);
+
+            std::size_t count = (std::min)(size,
+                static_cast<std::size_t>(head - tail));
+            if (count == 0)
+                return 0;
+
+            copy_out(tail, static_cast<char*>(dest), count);
+            ctrl_->tail_.data_.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        bool empty() const
+        {
+            return ctrl_->head_.data_.load(std::memory_order_acquire) ==
+                ctrl_->tail_.data_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void copy_in(std::uint64_t pos, char const* src, std::size_t count)
+        {
+            std::size_t offset = static_cast<std::size_t>(pos & mask_);
+            std::size_t first = (std::min)(count,
+                static_cast<std::size_t>(mask_ + 1) - offset);
+            std::memcpy(data_ + offset, src, first);
+            if (first != count)
+                std::memcpy(data_, src + first, count - first);
+        }
+
+        void copy_out(std::uint64_t pos, char* dest, std::size_t count)
+        {
+            std::size_t offset = static_cast<std::size_t>(pos & mask_);
+            std::size_t first = (std::min)(count,
+                static_cast<std::size_t>(mask_ + 1) - offset);
+            std::memcpy(dest, data_ + offset, first);
+            if (first != count)
+                std::memcpy(dest + first, data_, count - first);
+        }
+
+        ring_control* ctrl_;
+        char* data_;
+        std::uint64_t mask_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A POSIX shared memory object holding the inbound rings of one locality.
+    // The owning locality creates (and eventually unlinks) it, co-located
+    // senders open and map it to deliver parcels.
+    class segment
+    {
+        static constexpr std::uint64_t magic_value = 0x687078736d656d31ull;
+
+        struct segment_header
+        {
+            std::uint64_t magic_;
+            std::uint64_t num_slots_;
+            std::uint64_t ring_size_;
+            util::cache_line_data<std::atomic<std::uint64_t> > ready_;
+        };
+
+        static std::size_t header_size()
+        {
+            return sizeof(util::cache_line_data<segment_header>);
+        }
+
+        static std::size_t control_size(std::size_t num_slots)
+        {
+            std::size_t size = num_slots * sizeof(ring_control);
+            std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            return ((header_size() + size + page - 1) / page) * page;
+        }
+
+    public:
+        HPX_NON_COPYABLE(segment);
+
+    public:
+        segment()
+          : base_(nullptr), size_(0), owner_(false)
+        {}
+
+        ~segment()
+        {
+            close();
+        }
+
+        // Create and initialize a new segment, owned by the calling locality.
+        void create(std::string const& name, std::size_t num_slots,
+            std::size_t ring_size, error_code& ec = throws)
+        {
+            HPX_ASSERT(base_ == nullptr);
+            HPX_ASSERT(num_slots != 0);
+            HPX_ASSERT((ring_size & (ring_size - 1)) == 0);
+
+            // remove stale objects left behind by a crashed process which
+            // happened to have the same pid
+            ::shm_unlink(name.c_str());
+
+            int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd == -1)
+            {
+                HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                    "shm_open failed for " + name + ": " +
+                        std::strerror(errno));
+                return;
+            }
+
+            std::size_t size = control_size(num_slots) + num_slots * ring_size;
+            if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+            {
+                int err = errno;
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                    "ftruncate failed for " + name + ": " +
+                        std::strerror(err));
+                return;
+            }
+
+            if (!map(fd, size, name, ec))
+            {
+                ::shm_unlink(name.c_str());
+                return;
+            }
+
+            segment_header* hdr = header();
+            hdr->magic_ = magic_value;
+            hdr->num_slots_ = num_slots;
+            hdr->ring_size_ = ring_size;
+
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                ring_control* ctrl = new (controls() + i) ring_control;
+                ctrl->state_.data_.store(
+                    ring_control::slot_free, std::memory_order_relaxed);
+                ctrl->head_.data_.store(0, std::memory_order_relaxed);
+                ctrl->tail_.data_.store(0, std::memory_order_relaxed);
+            }
+
+            hdr->ready_.data_.store(1, std::memory_order_release);
+
+            name_ = name;
+            owner_ = true;
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        // Map an existing segment owned by another locality.
+        void open(std::string const& name, error_code& ec = throws)
+        {
+            HPX_ASSERT(base_ == nullptr);
+
+            int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+            if (fd == -1)
+            {
+                HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                    "shm_open failed for " + name + ": " +
+                        std::strerror(errno));
+                return;
+            }
+
+            struct stat st;
+            if (::fstat(fd, &st) == -1 ||
+                static_cast<std::size_t>(st.st_size) < header_size())
+            {
+                ::close(fd);
+                HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                    "shared memory segment " + name + " is not initialized");
+                return;
+            }
+
+            if (!map(fd, static_cast<std::size_t>(st.st_size), name, ec))
+                return;
+
+            segment_header* hdr = header();
+            if (hdr->ready_.data_.load(std::memory_order_acquire) == 0 ||
+                hdr->magic_ != magic_value)
+            {
+                close();
+                HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                    "shared memory segment " + name +
+                        " has an unexpected layout");
+                return;
+            }
+
+            name_ = name;
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        void close()
+        {
+            if (base_ != nullptr)
+            {
+                ::munmap(base_, size_);
+                base_ = nullptr;
+                size_ = 0;
+            }
+            if (owner_)
+            {
+                ::shm_unlink(name_.c_str());
+                owner_ = false;
+            }
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return base_ != nullptr;
+        }
+
+        std::string const& name() const
+        {
+            return name_;
+        }
+
+        std::size_t num_slots() const
+        {
+            return static_cast<std::size_t>(header()->num_slots_);
+        }
+
+        std::size_t ring_size() const
+        {
+            return static_cast<std::size_t>(header()->ring_size_);
+        }
+
+        ring get_ring(std::size_t slot) const
+        {
+            HPX_ASSERT(slot < num_slots());
+            char* data = static_cast<char*>(base_) +
+                control_size(num_slots()) + slot * ring_size();
+            return ring(controls() + slot, data, ring_size());
+        }
+
+        // Claim an unused slot for exclusive use by one sender, returns
+        // std::size_t(-1) if all slots are taken.
+        std::size_t claim_slot()
+        {
+            std::size_t count = num_slots();
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                std::uint32_t expected = ring_control::slot_free;
+                if (controls()[i].state_.data_.compare_exchange_strong(
+                        expected, ring_control::slot_claimed,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return i;
+                }
+            }
+            return std::size_t(-1);
+        }
+
+        void release_slot(std::size_t slot)
+        {
+            HPX_ASSERT(slot < num_slots());
+            controls()[slot].state_.data_.store(
+                ring_control::slot_closed, std::memory_order_release);
+        }
+
+        // Called by the owner once a closed slot has been fully drained.
+        void recycle_slot(std::size_t slot)
+        {
+            HPX_ASSERT(owner_ && slot < num_slots());
+            ring_control& ctrl = controls()[slot];
+            ctrl.head_.data_.store(0, std::memory_order_relaxed);
+            ctrl.tail_.data_.store(0, std::memory_order_relaxed);
+            ctrl.state_.data_.store(
+                ring_control::slot_free, std::memory_order_release);
+        }
+
+    private:
+        bool map(int fd, std::size_t size, std::string const& name,
+            error_code& ec)
+        {
+            void* base =
+                ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            int err = errno;
+            ::close(fd);
+
+            if (base == MAP_FAILED)
+            {
+                HPX_THROWS_IF(ec, network_error, "shmem::segment::map",
+                    "mmap failed for " + name + ": " + std::strerror(err));
+                return false;
+            }
+
+            base_ = base;
+            size_ = size;
+            return true;
+        }
+
+        segment_header* header() const
+        {
+            return static_cast<segment_header*>(base_);
+        }
+
+        ring_control* controls() const
+        {
+            return reinterpret_cast<ring_control*>(
+                static_cast<char*>(base_) + header_size());
+        }
+
+        void* base_;
+        std::size_t size_;
+        bool owner_;
+        std::string name_;
+    };
+}}}}
+
+#endif
+
+#endif
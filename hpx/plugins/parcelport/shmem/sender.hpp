@@ -0,0 +1,158 @@
+//  Copyright (c) 2019 Ste||ar Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assertion.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/thread_support/unlock_guard.hpp>
+
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        // Return the mapped segment of the given destination, maps it on
+        // first use. Failures are remembered so that unreachable segments
+        // (e.g. a different IPC namespace) are not retried on every parcel.
+        std::shared_ptr<segment> get_segment(
+            std::string const& name, error_code& ec = throws)
+        {
+            std::unique_lock<mutex_type> l(segments_mtx_);
+            auto it = segments_.find(name);
+            if (it == segments_.end())
+            {
+                std::shared_ptr<segment> seg = std::make_shared<segment>();
+                {
+                    util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
+                    seg->open(name, ec);
+                }
+                if (!*seg)
+                    seg.reset();
+
+                it = segments_.emplace(name, std::move(seg)).first;
+            }
+
+            if (!it->second)
+            {
+                HPX_THROWS_IF(ec, network_error,
+                    "shmem::sender::get_segment",
+                    "shared memory segment " + name + " is not accessible");
+            }
+            else if (&ec != &throws)
+            {
+                ec = make_success_code();
+            }
+            return it->second;
+        }
+
+        connection_ptr create_connection(parcelset::locality const& dest,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<segment> seg =
+                get_segment(dest.get<locality>().segment(), ec);
+            if (!seg)
+                return connection_ptr();
+
+            return std::make_shared<connection_type>(this, std::move(seg),
+                dest, pp);
+        }
+
+        void add(connection_ptr const & ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code ec;
+                util::unique_function_nonser<
+                    void(
+                        error_code const&
+                      , parcelset::locality const&
+                      , connection_ptr
+                    )
+                > postprocess_handler;
+                std::swap(postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(
+                    ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.push_back(std::move(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_, std::try_to_lock);
+                if(l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+            if(connection)
+            {
+                send_messages(std::move(connection));
+                return true;
+            }
+            return false;
+        }
+
+        void clear()
+        {
+            std::unique_lock<mutex_type> l(segments_mtx_);
+            segments_.clear();
+        }
+
+    private:
+        mutex_type connections_mtx_;
+        connection_list connections_;
+
+        mutex_type segments_mtx_;
+        std::map<std::string, std::shared_ptr<segment> > segments_;
+    };
+
+    inline void add_connection(
+        sender * s, std::shared_ptr<sender_connection> const &ptr)
+    {
+        s->add(ptr);
+    }
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,216 @@
+//  Copyright (c) 2019 Ste||ar Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assertion.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    struct sender_connection
+      : parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef std::vector<char> data_type;
+
+        typedef
+            parcelset::parcelport_connection<sender_connection, data_type>
+            base_type;
+
+        // one contiguous piece of the outgoing message
+        struct piece
+        {
+            char const* data_;
+            std::size_t size_;
+        };
+
+    public:
+        sender_connection(sender_type* s, std::shared_ptr<segment> seg,
+                parcelset::locality const& there, parcelset::parcelport* pp)
+          : sender_(s)
+          , segment_(std::move(seg))
+          , slot_(std::size_t(-1))
+          , piece_idx_(0)
+          , offset_(0)
+          , pp_(pp)
+          , there_(there)
+        {
+        }
+
+        ~sender_connection()
+        {
+            if (slot_ != std::size_t(-1))
+                segment_->release_slot(slot_);
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const & parcel_locality_id) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+            buffer_.data_point_.time_ = util::high_resolution_clock::now();
+
+            // Gather the message in the same order as the TCP parcelport
+            // does. Zero-copy chunks are copied straight from their source
+            // into the ring without being staged anywhere else.
+            pieces_.clear();
+            piece_idx_ = 0;
+            offset_ = 0;
+
+            add_piece(&buffer_.size_, sizeof(buffer_.size_));
+            add_piece(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_piece(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_piece(chunks.data(), chunks.size() *
+                    sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+
+            add_piece(buffer_.data_.data(), buffer_.data_.size());
+
+            for (serialization::serialization_chunk& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer)
+                    add_piece(c.data_.cpos_, c.size_);
+            }
+
+            handler_ = std::forward<Handler>(handler);
+
+            if (!send())
+            {
+                postprocess_handler_
+                    = std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Push as much of the pending message into the ring as fits, returns
+        // true once the whole message has been handed over.
+        bool send()
+        {
+            if (slot_ == std::size_t(-1))
+            {
+                // all rings of the destination may be taken by other
+                // senders, retry later
+                slot_ = segment_->claim_slot();
+                if (slot_ == std::size_t(-1))
+                    return false;
+                ring_ = segment_->get_ring(slot_);
+            }
+
+            while (piece_idx_ != pieces_.size())
+            {
+                piece const& p = pieces_[piece_idx_];
+                offset_ += ring_.write(p.data_ + offset_, p.size_ - offset_);
+                if (offset_ != p.size_)
+                    return false;
+
+                offset_ = 0;
+                ++piece_idx_;
+            }
+
+            return done();
+        }
+
+        bool done()
+        {
+            error_code ec;
+            handler_(ec);
+            handler_.reset();
+            buffer_.data_point_.time_ =
+                util::high_resolution_clock::now() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+            pieces_.clear();
+
+            return true;
+        }
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+    private:
+        void add_piece(void const* data, std::size_t size)
+        {
+            if (size != 0)
+                pieces_.push_back(piece{static_cast<char const*>(data), size});
+        }
+
+        sender_type* sender_;
+        std::shared_ptr<segment> segment_;
+        std::size_t slot_;
+        ring ring_;
+
+        std::vector<piece> pieces_;
+        std::size_t piece_idx_;
+        std::size_t offset_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
+
+#endif
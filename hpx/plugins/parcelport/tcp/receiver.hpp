@@ -24,7 +24,9 @@
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 #include <hpx/util/yield_while.hpp>
 
@@ -47,13 +49,24 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
 
+    // The zero-copy chunks are received into separately allocated buffers,
+    // those are handed over to the de-serialized serialize_buffer objects
+    // without copying the data again.
+    typedef std::allocator<char> receiver_chunk_allocator_type;
+    typedef serialization::serialize_buffer<char, receiver_chunk_allocator_type>
+        receiver_chunk_type;
+
     class receiver
-      : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
+      : public parcelport_connection<receiver, std::vector<char>,
+            receiver_chunk_type>
     {
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
+        typedef receiver_chunk_allocator_type chunk_allocator_type;
+
         receiver(boost::asio::io_service& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport,
+            chunk_allocator_type const& chunk_alloc = chunk_allocator_type())
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
@@ -61,6 +74,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
+          , chunk_alloc_(chunk_alloc)
         {}
 
         ~receiver()
@@ -195,7 +209,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             sizeof(transmission_chunk_type)));
 
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    acquire_parcel_buffer(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -203,7 +218,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 }
                 else {
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    acquire_parcel_buffer(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -249,7 +265,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 // receive buffers
                 std::vector<boost::asio::mutable_buffer> buffers;
 
-                // add appropriately sized chunk buffers for the zero-copy data
+                // add appropriately sized chunk buffers for the zero-copy
+                // data, the memory is left uninitialized as it is
+                // overwritten by the received data anyways
                 std::size_t num_zero_copy_chunks =
                     static_cast<std::size_t>(
                         static_cast<std::uint32_t>(buffer_.num_chunks_.first));
@@ -259,7 +277,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 {
                     std::size_t chunk_size = static_cast<std::size_t>(
                         buffer_.transmission_chunks_[i].second);
-                    buffer_.chunks_[i].resize(chunk_size);
+                    buffer_.chunks_[i] = allocate_chunk(chunk_size);
                     buffers.push_back(
                         boost::asio::buffer(buffer_.chunks_[i].data(), chunk_size));
                 }
@@ -338,6 +356,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             }
         }
 
+        receiver_chunk_type allocate_chunk(std::size_t size)
+        {
+            // the deleter holds its own copy of the allocator as the chunk
+            // may outlive this receiver
+            chunk_allocator_type alloc = chunk_alloc_;
+            return receiver_chunk_type(alloc.allocate(size), size,
+                receiver_chunk_type::take,
+                [alloc, size](char* p) mutable { alloc.deallocate(p, size); },
+                alloc);
+        }
+
         template <typename Handler>
         void handle_write_ack(boost::system::error_code const& e,
             Handler handler)
@@ -370,6 +399,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         mutex_type mtx_;
         hpx::util::atomic_count operation_in_flight_;
+
+        /// The allocator used for the buffers receiving zero-copy chunks
+        chunk_allocator_type chunk_alloc_;
     };
 }}}}
 
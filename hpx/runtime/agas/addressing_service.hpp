@@ -13,11 +13,13 @@
 #define HPX_15D904C7_CD18_46E1_A54A_65059966A34F
 
 #include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/errors.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/runtime/runtime_mode.hpp>
 #include <hpx/runtime/agas_fwd.hpp>
 #include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/gva_cache.hpp>
 #include <hpx/runtime/agas/component_namespace.hpp>
 #include <hpx/runtime/agas/locality_namespace.hpp>
 #include <hpx/runtime/agas/symbol_namespace.hpp>
@@ -27,13 +29,13 @@
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/state.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/util/interval_timer.hpp>
 #include <hpx/util_fwd.hpp>
 #include <hpx/functional/function.hpp>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -73,19 +75,13 @@ public:
     // }}}
 
     // {{{ gva cache
-    struct gva_cache_key;
-
-    typedef hpx::util::cache::lru_cache<
-        gva_cache_key
-      , gva
-      , hpx::util::cache::statistics::local_full_statistics
-    > gva_cache_type;
+    typedef agas::gva_cache gva_cache_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
+    // the cache is safe to use concurrently, lookups don't acquire any lock
     std::shared_ptr<gva_cache_type> gva_cache_;
 
     mutable mutex_type migrated_objects_mtx_;
@@ -96,11 +92,26 @@ public:
 
     std::size_t const max_refcnt_requests_;
 
-    mutex_type refcnt_requests_mtx_;
-    std::size_t refcnt_requests_count_;
-    bool enable_refcnt_caching_;
+    // The pending credit requests are spread over a number of shards by GID,
+    // each protected by its own mutex. All requests for one GID end up in the
+    // same shard, which allows increfs to be compensated by pending decrefs.
+    struct refcnt_requests_shard
+    {
+        mutex_type mtx_;
+        refcnt_requests_type requests_;
+    };
+
+    static constexpr std::size_t num_refcnt_requests_shards = 32;
+
+    std::array<util::cache_aligned_data<refcnt_requests_shard>,
+        num_refcnt_requests_shards> refcnt_requests_;
+
+    std::atomic<std::size_t> refcnt_requests_count_;
+    std::atomic<bool> enable_refcnt_caching_;
 
-    std::shared_ptr<refcnt_requests_type> refcnt_requests_;
+    // sends the pending credit requests in regular intervals, even if their
+    // number doesn't reach the configured maximum
+    util::interval_timer refcnt_requests_timer_;
 
     service_mode const service_type;
     runtime_mode const runtime_type;
@@ -259,27 +270,52 @@ protected:
         );
 
 private:
-    /// Assumes that \a refcnt_requests_mtx_ is locked.
+    refcnt_requests_shard& get_refcnt_requests_shard(
+        naming::gid_type const& gid
+        );
+
+    /// Move the pending requests of the given shard into \a requests.
+    void collect_refcnt_requests(
+        refcnt_requests_shard& shard
+      , refcnt_requests_type& requests
+        );
+
+    /// Move the pending requests of all shards into \a requests. Shards
+    /// which are locked by another thread are skipped if \a try_lock is set.
+    void collect_refcnt_requests(
+        refcnt_requests_type& requests
+      , bool try_lock
+        );
+
+    /// Account for a new pending request added to \a shard, sends all
+    /// pending requests once their number reaches the configured maximum.
+    /// During shutdown only the requests of \a shard are sent, all others
+    /// have been sent already.
     void send_refcnt_requests(
-        std::unique_lock<mutex_type>& l
+        refcnt_requests_shard& shard
       , error_code& ec = throws
         );
 
-    /// Assumes that \a refcnt_requests_mtx_ is locked.
     void send_refcnt_requests_non_blocking(
-        std::unique_lock<mutex_type>& l
+        bool try_lock
       , error_code& ec
         );
 
-    /// Assumes that \a refcnt_requests_mtx_ is locked.
+    void send_refcnt_requests_non_blocking(
+        refcnt_requests_type const& requests
+      , error_code& ec
+        );
+
+    /// Called by refcnt_requests_timer_
+    bool flush_refcnt_requests();
+
     std::vector<hpx::future<std::vector<std::int64_t> > >
     send_refcnt_requests_async(
-        std::unique_lock<mutex_type>& l
+        bool try_lock
         );
 
-    /// Assumes that \a refcnt_requests_mtx_ is locked.
     void send_refcnt_requests_sync(
-        std::unique_lock<mutex_type>& l
+        bool try_lock
       , error_code& ec
         );
 
@@ -1387,6 +1423,9 @@ public:
         error_code& ec = throws
         );
 
+    // Start sending pending credit requests periodically
+    void start_refcnt_requests_timer();
+
     // Disable refcnt caching during shutdown
     void start_shutdown(
         error_code& ec = throws
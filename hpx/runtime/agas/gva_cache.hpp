@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_AGAS_GVA_CACHE_OCT_22_2019_1105AM)
+#define HPX_AGAS_GVA_CACHE_OCT_22_2019_1105AM
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas
+{
+
+/// \brief The client side cache of the addresses of remote GID ranges.
+///
+/// The cache is organized as a set associative table of fixed size. Each slot
+/// is guarded by a sequence lock, lookups never acquire a lock and retry only
+/// if the slot they read was modified concurrently. Modifications lock the
+/// set they touch.
+///
+/// A range with a count of one is stored in the set selected by its GID,
+/// small ranges are stored in the set selected by the block of GIDs their
+/// base falls into, such that a lookup has to visit at most three sets.
+/// Larger ranges are kept in a separate fully associative list which is
+/// consulted only if the lookup fails otherwise.
+///
+/// The cached ranges never overlap, a range overlapping with any of the
+/// cached ones is not inserted. Modifications of the cache are serialized to
+/// keep the overlap check consistent across the sets.
+class HPX_EXPORT gva_cache
+{
+public:
+    typedef lcos::local::spinlock mutex_type;
+
+    // log2 of the number of consecutive GIDs forming one block
+    static constexpr std::size_t block_bits = 6;
+    static constexpr std::size_t num_ways = 4;
+    static constexpr std::size_t num_range_entries = 64;
+
+    /// The statistics are kept per worker thread to avoid contention on the
+    /// lookup path.
+    class HPX_EXPORT statistics
+    {
+    public:
+        enum method
+        {
+            method_get_entry = 0,
+            method_insert_entry = 1,
+            method_update_entry = 2,
+            method_erase_entry = 3
+        };
+
+        statistics();
+
+        void got_hit();
+        void got_miss();
+        void got_insertion();
+        void got_eviction();
+        void add_call(method m, std::uint64_t time);
+
+        std::uint64_t hits(bool reset);
+        std::uint64_t misses(bool reset);
+        std::uint64_t insertions(bool reset);
+        std::uint64_t evictions(bool reset);
+
+        std::uint64_t get_get_entry_count(bool reset);
+        std::uint64_t get_insert_entry_count(bool reset);
+        std::uint64_t get_update_entry_count(bool reset);
+        std::uint64_t get_erase_entry_count(bool reset);
+
+        std::uint64_t get_get_entry_time(bool reset);
+        std::uint64_t get_insert_entry_time(bool reset);
+        std::uint64_t get_update_entry_time(bool reset);
+        std::uint64_t get_erase_entry_time(bool reset);
+
+    private:
+        static constexpr std::size_t num_counters = 12;
+        static constexpr std::size_t num_stripes = 16;
+
+        enum counter
+        {
+            counter_hits = 0,
+            counter_misses = 1,
+            counter_insertions = 2,
+            counter_evictions = 3,
+            counter_calls = 4,      // one per method
+            counter_time = 8        // one per method
+        };
+
+        typedef std::array<std::atomic<std::uint64_t>, num_counters>
+            counters_type;
+
+        void add(std::size_t c, std::uint64_t value);
+        std::uint64_t get(std::size_t c, bool reset);
+
+        std::array<util::cache_aligned_data<counters_type>, num_stripes>
+            stripes_;
+    };
+
+    explicit gva_cache(std::size_t size = 0);
+
+    gva_cache(gva_cache const&) = delete;
+    gva_cache& operator=(gva_cache const&) = delete;
+
+    /// Replace the table by an empty one holding at least \p size entries.
+    void reserve(std::size_t size);
+
+    /// The number of entries currently held in the cache.
+    std::size_t size() const;
+
+    /// The number of entries the cache can hold.
+    std::size_t capacity() const;
+
+    /// Find the range covering \p id, returns its (stripped) base GID and
+    /// its GVA.
+    bool get_entry(naming::gid_type const& id, naming::gid_type& base,
+        gva& g);
+
+    /// Insert the range of \p count GIDs starting at \p id or update the GVA
+    /// of the range if it is cached already. Returns false if another range
+    /// overlapping with the given one is cached.
+    bool update_entry(naming::gid_type const& id, std::uint64_t count,
+        gva const& g);
+
+    /// Remove the range with the given base GID.
+    void erase(naming::gid_type const& id);
+
+    /// Remove all entries.
+    void clear();
+
+    statistics& get_statistics()
+    {
+        return statistics_;
+    }
+
+private:
+    struct slot
+    {
+        slot();
+
+        bool load(std::uint64_t msb, std::uint64_t lsb,
+            naming::gid_type& base, gva& g) const;
+        void store(naming::gid_type const& base, std::uint64_t count,
+            gva const& g);
+        void reset();
+
+        // odd while the slot is being modified
+        std::atomic<std::uint64_t> sequence_;
+
+        std::atomic<std::uint64_t> base_msb_;
+        std::atomic<std::uint64_t> base_lsb_;
+        std::atomic<std::uint64_t> count_;      // zero for empty slots
+
+        std::atomic<std::uint64_t> prefix_msb_;
+        std::atomic<std::uint64_t> prefix_lsb_;
+        std::atomic<std::int32_t> type_;
+        std::atomic<std::uint64_t> gva_count_;
+        std::atomic<std::uint64_t> lva_;
+        std::atomic<std::uint64_t> offset_;
+
+        // cleared by the replacement policy, set on each hit
+        mutable std::atomic<bool> referenced_;
+    };
+
+    template <std::size_t N>
+    struct set
+    {
+        set()
+          : hand_(0)
+        {}
+
+        std::size_t find(naming::gid_type const& base) const;
+        std::size_t victim();
+
+        mutable mutex_type mtx_;
+        std::size_t hand_;
+        std::array<slot, N> slots_;
+    };
+
+    typedef set<num_ways> small_set;
+    typedef set<num_range_entries> range_set;
+
+    struct table
+    {
+        explicit table(std::size_t num_sets);
+
+        std::size_t const mask_;
+        std::unique_ptr<util::cache_aligned_data<small_set>[]> sets_;
+        util::cache_aligned_data<range_set> ranges_;
+        std::atomic<std::size_t> size_;
+    };
+
+    static std::size_t set_index(std::uint64_t msb, std::uint64_t key,
+        std::uint64_t tag);
+
+    bool lookup(table const& t, std::uint64_t msb, std::uint64_t lsb,
+        naming::gid_type& base, gva& g) const;
+
+    bool overlaps(table const& t, naming::gid_type const& base,
+        std::uint64_t count) const;
+
+    template <std::size_t N>
+    bool update_set(table& t, set<N>& s, naming::gid_type const& base,
+        std::uint64_t count, gva const& g, statistics::method& m);
+
+    template <std::size_t N>
+    void erase_set(table& t, set<N>& s, naming::gid_type const& base);
+
+    small_set& get_set(table& t, naming::gid_type const& base,
+        std::uint64_t count) const;
+
+    std::atomic<table*> table_;
+
+    // serializes the insertion and update of entries
+    mutex_type update_mtx_;
+
+    // owns the current and all retired tables, concurrent lookups may still
+    // access a retired table
+    mutable mutex_type tables_mtx_;
+    std::vector<std::unique_ptr<table>> tables_;
+
+    statistics statistics_;
+};
+
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
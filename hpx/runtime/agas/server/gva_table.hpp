@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_AGAS_SERVER_GVA_TABLE_OCT_20_2019_0915AM)
+#define HPX_AGAS_SERVER_GVA_TABLE_OCT_20_2019_0915AM
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas { namespace server
+{
+
+/// \brief The GVA table of the primary namespace maps the base GID of each
+/// bound range to its GVA and to the locality it lives on.
+///
+/// The table is split into shards, each protected by its own lock. A range is
+/// stored in the shard of the block of GIDs its base GID falls into. Ranges
+/// never cross the MSB of their base GID and the table keeps track of the
+/// largest range currently bound, thus a lookup has to visit only the shards of
+/// the blocks which may hold the base of a range covering the given GID.
+/// With the default heap capacity of the component heaps this is at most
+/// two shards.
+///
+/// All GIDs passed to the table are expected to have their internal bits
+/// stripped.
+class HPX_EXPORT gva_table
+{
+public:
+    typedef lcos::local::spinlock mutex_type;
+
+    typedef std::pair<gva, naming::gid_type> data_type;
+    typedef std::map<naming::gid_type, data_type> map_type;
+
+    // log2 of the number of consecutive GIDs forming one block
+    static constexpr std::size_t block_bits = 12;
+    static constexpr std::size_t num_shards = 64;
+
+    gva_table();
+
+    /// Find the range with the largest base GID not larger than \p id which
+    /// may cover \p id. Returns false if there is no such range, otherwise
+    /// the caller still has to check whether the range covers \p id.
+    bool find(naming::gid_type const& id, naming::gid_type& base,
+        data_type& data) const;
+
+    /// Retrieve the range with the given base GID.
+    bool get(naming::gid_type const& id, data_type& data) const;
+
+    /// Insert a new range, returns false if it overlaps with a range in the
+    /// table.
+    bool insert(naming::gid_type const& id, data_type const& data);
+
+    /// Store a new address for the range with the given base GID, the count
+    /// is left unchanged. Returns false if there is no such range.
+    bool update(naming::gid_type const& id, gva const& g,
+        naming::gid_type const& locality);
+
+    /// Remove the range with the given base GID, returns false if there is no
+    /// such range.
+    bool erase(naming::gid_type const& id, data_type& data);
+
+private:
+    typedef std::map<std::uint64_t, std::size_t> count_map_type;
+
+    struct shard
+    {
+        mutable mutex_type mtx_;
+        map_type entries_;
+
+        // the number of ranges of each count stored in this shard
+        count_map_type counts_;
+    };
+
+    typedef std::bitset<num_shards> shard_set;
+
+    static std::size_t shard_index(std::uint64_t msb, std::uint64_t block);
+    static shard_set get_shards(std::uint64_t msb, std::uint64_t first_block,
+        std::uint64_t last_block);
+
+    void lock_shards(shard_set const& shards);
+    void unlock_shards(shard_set const& shards);
+
+    struct unlock_on_exit;
+
+    void lower_max_count();
+
+    shard& get_shard(naming::gid_type const& id);
+    shard const& get_shard(naming::gid_type const& id) const;
+
+    std::array<util::cache_aligned_data<shard>, num_shards> shards_;
+
+    // the largest count of all ranges in the table, it is raised while the
+    // shard of the new range is locked and lowered only while all shards are
+    // locked
+    std::atomic<std::uint64_t> max_count_;
+};
+
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -16,6 +16,7 @@
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/runtime/agas_fwd.hpp>
 #include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/server/gva_table.hpp>
 #include <hpx/runtime/actions/component_action.hpp>
 #include <hpx/runtime/components/server/fixed_component_base.hpp>
 #include <hpx/runtime/naming/id_type.hpp>
@@ -120,8 +121,8 @@ struct HPX_EXPORT primary_namespace
 
     typedef std::int32_t component_type;
 
-    typedef std::pair<gva, naming::gid_type> gva_table_data_type;
-    typedef std::map<naming::gid_type, gva_table_data_type> gva_table_type;
+    typedef gva_table::data_type gva_table_data_type;
+    typedef gva_table gva_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_table_type;
 
     typedef hpx::util::tuple<naming::gid_type, gva, naming::gid_type>
@@ -129,8 +130,8 @@ struct HPX_EXPORT primary_namespace
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
+    // protects the reference count and the migration tables, the GVA table
+    // is sharded and uses its own locks
     mutex_type mutex_;
 
     gva_table_type gvas_;
@@ -305,9 +306,8 @@ public:
     naming::gid_type statistics_counter(std::string const& name);
 
   private:
-    resolved_type resolve_gid_locked(
-        std::unique_lock<mutex_type>& l
-      , naming::gid_type const& gid
+    resolved_type resolve_gid_impl(
+        naming::gid_type const& gid
       , error_code& ec
         );
 
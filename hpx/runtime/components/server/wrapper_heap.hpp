@@ -18,6 +18,7 @@
 #include <hpx/util/generate_unique_ids.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -60,11 +61,20 @@ namespace hpx { namespace components { namespace detail
                 return nullptr;
             }
 
+            // allocate memory aligned to the given power of two
+            HPX_EXPORT static void* alloc_aligned(
+                std::size_t size, std::size_t alignment);
+            HPX_EXPORT static void free_aligned(void* p);
+
             HPX_EXPORT static util::internal_allocator<char> alloc_;
         };
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    // The elements are handed out in order and are never reused, as the
+    // global id of each element is derived from its address. Allocating and
+    // freeing elements does not acquire a lock, the memory is released once
+    // all elements have been handed out and freed again.
     class HPX_EXPORT wrapper_heap : public util::wrapper_heap_base
     {
     public:
@@ -98,7 +108,8 @@ namespace hpx { namespace components { namespace detail
         bool has_allocatable_slots() const;
 
         bool alloc(void** result, std::size_t count = 1) override;
-        void free(void *p, std::size_t count = 1) override;
+        bool free(void *p, std::size_t count = 1) override;
+        bool seal() override;
         bool did_alloc (void *p) const override;
 
         // Get the global id of the managed_component instance given by the
@@ -112,29 +123,33 @@ namespace hpx { namespace components { namespace detail
         void set_gid(naming::gid_type const& g);
 
     protected:
+        bool release_elements(std::size_t count);
         bool test_release(scoped_lock& lk);
-        bool ensure_pool(std::size_t count);
 
         bool init_pool();
         void tidy();
 
     protected:
-        char* pool_;
-        char* first_free_;
+        char* block_;           // aligned block holding the elements
+        char* pool_;            // first element
         heap_parameters const parameters_;
-        std::size_t free_size_;
+
+        // number of elements handed out and given back, respectively
+        std::atomic<std::size_t> allocated_;
+        std::atomic<std::size_t> freed_;
 
         // these values are used for AGAS registration of all elements of this
         // managed_component heap
         naming::gid_type base_gid_;
+        std::atomic<bool> has_base_gid_;
 
         mutable mutex_type mtx_;
 
     public:
         std::string const class_name_;
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
+        std::atomic<std::size_t> alloc_count_;
+        std::atomic<std::size_t> free_count_;
         std::size_t heap_count_;
 #endif
 
@@ -19,7 +19,9 @@
 #include <hpx/runtime/naming/resolver_client.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_route_handler.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 #include <hpx/functional/deferred_call.hpp>
@@ -30,6 +32,7 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -54,7 +57,8 @@ namespace hpx { namespace parcelset
                 static_cast<std::size_t>(
                     static_cast<std::uint32_t>(buffer.num_chunks_.second));
 
-            chunks.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+            chunks = get_parcel_chunk_buffer_pool().acquire(
+                num_zero_copy_chunks + num_non_zero_copy_chunks);
 
             // place the zero-copy chunks at their spots first
             for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
@@ -104,6 +108,56 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    namespace detail
+    {
+        template <typename Chunk>
+        std::shared_ptr<void> get_chunk_owner(Chunk&)
+        {
+            return std::shared_ptr<void>();
+        }
+
+        // Zero-copy chunks received into reference counted buffers can be
+        // handed over to the de-serialized objects instead of being copied.
+        template <typename T, typename Allocator>
+        std::shared_ptr<void> get_chunk_owner(
+            serialization::serialize_buffer<T, Allocator>& chunk)
+        {
+            return std::shared_ptr<void>(chunk.data(), [chunk](void*) {});
+        }
+    }
+
+    template <typename Buffer>
+    std::vector<std::shared_ptr<void>> decode_chunk_owners(Buffer & buffer)
+    {
+        typedef typename Buffer::transmission_chunk_type transmission_chunk_type;
+
+        std::vector<std::shared_ptr<void>> owners;
+
+        std::size_t num_zero_copy_chunks =
+            static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer.num_chunks_.first));
+        std::size_t num_non_zero_copy_chunks =
+            static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer.num_chunks_.second));
+
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+        {
+            std::shared_ptr<void> owner =
+                detail::get_chunk_owner(buffer.chunks_[i]);
+            if (!owner)
+                continue;
+
+            if (owners.empty())
+                owners.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+
+            transmission_chunk_type& c = buffer.transmission_chunks_[i];
+            owners[static_cast<std::size_t>(
+                static_cast<std::uint64_t>(c.first))] = std::move(owner);
+        }
+
+        return owners;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -112,6 +166,7 @@ namespace hpx { namespace parcelset
       , std::size_t parcel_count
       , std::vector<serialization::serialization_chunk> &chunks
       , std::size_t num_thread = -1
+      , std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr
     )
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
@@ -130,7 +185,7 @@ namespace hpx { namespace parcelset
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, chunk_owners);
 
                     if(parcel_count == 0)
                     {
@@ -268,6 +323,12 @@ namespace hpx { namespace parcelset
                 << "decode_message: caught unknown exception.";
             hpx::report_error(std::current_exception());
         }
+
+        // the received data is not referenced anymore, make its memory
+        // available to later messages
+        release_parcel_buffer(buffer.data_);
+        for (auto& chunk : buffer.chunks_)
+            release_parcel_buffer(chunk);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -281,8 +342,12 @@ namespace hpx { namespace parcelset
     {
         std::vector<serialization::serialization_chunk>
             chunks(decode_chunks(buffer));
+        std::vector<std::shared_ptr<void>>
+            chunk_owners(decode_chunk_owners(buffer));
         decode_message_with_chunks(pp, std::move(buffer),
-            parcel_count, chunks, num_thread);
+            parcel_count, chunks, num_thread,
+            chunk_owners.empty() ? nullptr : &chunk_owners);
+        release_parcel_buffer(chunks);
     }
 
     template <typename Parcelport, typename Buffer>
@@ -0,0 +1,314 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_PARCEL_BUFFER_POOL_HPP
+#define HPX_PARCELSET_PARCEL_BUFFER_POOL_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset
+{
+    namespace detail
+    {
+        // Return the stripe of a parcel_buffer_pool to be used by the calling
+        // thread. HPX worker threads use the stripe selected by their number,
+        // all other threads (e.g. the io threads of the parcelports) are
+        // assigned a stripe when they access a pool for the first time.
+        HPX_EXPORT std::size_t get_parcel_buffer_pool_stripe(
+            std::size_t num_stripes);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A cache for the buffers the parcelports send and receive messages
+    /// with, allowing to reuse the memory of a buffer for later messages.
+    ///
+    /// Buffers are binned by their capacity into power of two size classes.
+    /// A buffer is always put back into the largest size class not exceeding
+    /// its capacity, such that any buffer taken from a size class can hold
+    /// the requested number of elements without reallocating. Each thread
+    /// uses its own stripe of bins to avoid contention.
+    template <typename T>
+    class parcel_buffer_pool
+    {
+    public:
+        typedef lcos::local::spinlock mutex_type;
+        typedef std::vector<T> buffer_type;
+
+        // The size classes range from 256 bytes to 1 MByte, larger buffers
+        // are not cached.
+        static constexpr std::size_t min_size_bits = 8;
+        static constexpr std::size_t max_size_bits = 20;
+        static constexpr std::size_t num_size_classes =
+            max_size_bits - min_size_bits + 1;
+
+        // Limit the number of cached buffers per size class and stripe both
+        // by count and by the overall number of bytes held.
+        static constexpr std::size_t max_cached_buffers = 64;
+        static constexpr std::size_t max_cached_bytes = std::size_t(1) << 20;
+
+        static constexpr std::size_t num_stripes = 16;
+
+        parcel_buffer_pool() = default;
+
+        parcel_buffer_pool(parcel_buffer_pool const&) = delete;
+        parcel_buffer_pool& operator=(parcel_buffer_pool const&) = delete;
+
+        /// Return a buffer holding \a size value-initialized elements,
+        /// reusing the memory of a previously released buffer if possible.
+        buffer_type acquire(std::size_t size)
+        {
+            buffer_type buffer;
+            if (size == 0)
+                return buffer;
+
+            std::size_t const c = size_class_ceil(size * sizeof(T));
+            stripe& s = get_stripe();
+
+            if (c < num_size_classes)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                std::vector<buffer_type>& bin = s.bins_[c];
+                if (!bin.empty())
+                {
+                    buffer = std::move(bin.back());
+                    bin.pop_back();
+                    s.cached_bytes_ -= buffer.capacity() * sizeof(T);
+                }
+            }
+
+            if (buffer.capacity() != 0)
+            {
+                s.hits_.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                s.misses_.fetch_add(1, std::memory_order_relaxed);
+
+                // allocate the full size class, this allows for the buffer
+                // to be handed out again for any size mapped to this class
+                if (c < num_size_classes)
+                {
+                    std::size_t const bytes =
+                        std::size_t(1) << (c + min_size_bits);
+                    buffer.reserve((bytes + sizeof(T) - 1) / sizeof(T));
+                }
+            }
+
+            buffer.resize(size);
+            return buffer;
+        }
+
+        /// Hand the memory of the given buffer back to the pool.
+        void release(buffer_type&& buffer)
+        {
+            std::size_t const bytes = buffer.capacity() * sizeof(T);
+            if (bytes < (std::size_t(1) << min_size_bits))
+                return;
+
+            std::size_t const c = floor_log2(bytes) - min_size_bits;
+            if (c >= num_size_classes)
+                return;
+
+            buffer.clear();
+
+            stripe& s = get_stripe();
+            std::lock_guard<mutex_type> l(s.mtx_);
+
+            std::vector<buffer_type>& bin = s.bins_[c];
+            if (bin.size() >= max_buffers(c))
+                return;
+
+            bin.push_back(std::move(buffer));
+            s.cached_bytes_ += bytes;
+
+            if (s.cached_bytes_ >
+                s.high_water_mark_.load(std::memory_order_relaxed))
+            {
+                s.high_water_mark_.store(
+                    s.cached_bytes_, std::memory_order_relaxed);
+            }
+        }
+
+        /// Release all cached buffers.
+        void clear()
+        {
+            for (auto& s : stripes_)
+            {
+                std::array<std::vector<buffer_type>, num_size_classes> bins;
+                {
+                    std::lock_guard<mutex_type> l(s.data_.mtx_);
+                    std::swap(bins, s.data_.bins_);
+                    s.data_.cached_bytes_ = 0;
+                }
+            }
+        }
+
+        /// The number of requests served from a cached buffer.
+        std::uint64_t hits(bool reset)
+        {
+            std::uint64_t result = 0;
+            for (auto& s : stripes_)
+                result += get(s.data_.hits_, reset);
+            return result;
+        }
+
+        /// The number of requests which had to allocate a new buffer.
+        std::uint64_t misses(bool reset)
+        {
+            std::uint64_t result = 0;
+            for (auto& s : stripes_)
+                result += get(s.data_.misses_, reset);
+            return result;
+        }
+
+        /// The sum of the largest number of bytes held by each stripe.
+        std::uint64_t high_water_mark(bool reset)
+        {
+            std::uint64_t result = 0;
+            for (auto& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                result +=
+                    s.data_.high_water_mark_.load(std::memory_order_relaxed);
+                if (reset)
+                {
+                    s.data_.high_water_mark_.store(
+                        s.data_.cached_bytes_, std::memory_order_relaxed);
+                }
+            }
+            return result;
+        }
+
+    private:
+        struct stripe
+        {
+            stripe()
+              : cached_bytes_(0)
+              , hits_(0)
+              , misses_(0)
+              , high_water_mark_(0)
+            {}
+
+            mutex_type mtx_;
+            std::array<std::vector<buffer_type>, num_size_classes> bins_;
+            std::uint64_t cached_bytes_;
+
+            std::atomic<std::uint64_t> hits_;
+            std::atomic<std::uint64_t> misses_;
+            std::atomic<std::uint64_t> high_water_mark_;
+        };
+
+        static std::size_t floor_log2(std::size_t n)
+        {
+            std::size_t result = 0;
+            while (n >>= 1)
+                ++result;
+            return result;
+        }
+
+        // smallest size class holding buffers of at least the given size
+        static std::size_t size_class_ceil(std::size_t bytes)
+        {
+            if (bytes <= (std::size_t(1) << min_size_bits))
+                return 0;
+            return floor_log2(bytes - 1) + 1 - min_size_bits;
+        }
+
+        static std::size_t max_buffers(std::size_t c)
+        {
+            std::size_t const n = max_cached_bytes >> (c + min_size_bits);
+            return n < 1 ? 1 : (n > max_cached_buffers ? max_cached_buffers : n);
+        }
+
+        static std::uint64_t get(std::atomic<std::uint64_t>& value, bool reset)
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+        stripe& get_stripe()
+        {
+            return stripes_[detail::get_parcel_buffer_pool_stripe(num_stripes)]
+                .data_;
+        }
+
+        std::array<util::cache_aligned_data<stripe>, num_stripes> stripes_;
+    };
+
+    template <typename T>
+    constexpr std::size_t parcel_buffer_pool<T>::min_size_bits;
+    template <typename T>
+    constexpr std::size_t parcel_buffer_pool<T>::max_size_bits;
+    template <typename T>
+    constexpr std::size_t parcel_buffer_pool<T>::num_size_classes;
+    template <typename T>
+    constexpr std::size_t parcel_buffer_pool<T>::max_cached_buffers;
+    template <typename T>
+    constexpr std::size_t parcel_buffer_pool<T>::max_cached_bytes;
+    template <typename T>
+    constexpr std::size_t parcel_buffer_pool<T>::num_stripes;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The pool shared by all parcelports for the buffers holding the
+    /// serialized data of a message.
+    HPX_EXPORT parcel_buffer_pool<char>& get_parcel_data_buffer_pool();
+
+    /// The pool shared by all parcelports for the lists of chunks a received
+    /// message is de-serialized from.
+    HPX_EXPORT parcel_buffer_pool<serialization::serialization_chunk>&
+    get_parcel_chunk_buffer_pool();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Buffers of other types (e.g. using a special allocator) are not pooled.
+    template <typename Buffer>
+    void acquire_parcel_buffer(Buffer& buffer, std::size_t size)
+    {
+        buffer.resize(size);
+    }
+
+    inline void acquire_parcel_buffer(std::vector<char>& buffer,
+        std::size_t size)
+    {
+        if (buffer.capacity() < size)
+            buffer = get_parcel_data_buffer_pool().acquire(size);
+        else
+            buffer.resize(size);
+    }
+
+    template <typename Buffer>
+    void release_parcel_buffer(Buffer&)
+    {
+    }
+
+    inline void release_parcel_buffer(std::vector<char>& buffer)
+    {
+        get_parcel_data_buffer_pool().release(std::move(buffer));
+        buffer = std::vector<char>();
+    }
+
+    inline void release_parcel_buffer(
+        std::vector<serialization::serialization_chunk>& chunks)
+    {
+        get_parcel_chunk_buffer_pool().release(std::move(chunks));
+        chunks = std::vector<serialization::serialization_chunk>();
+    }
+}}
+
+#endif
+#endif
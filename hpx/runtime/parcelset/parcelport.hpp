@@ -247,6 +247,10 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        /// Return the number of parcels waiting to be sent to the given
+        /// destination
+        std::int64_t get_num_pending_parcels(locality const& dest) const;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -106,9 +106,11 @@ namespace hpx { namespace threads { namespace detail
             scheduler->create_thread(data, nullptr, initial_state, false, ec);
         }
 
-        // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
-        // thread.
-        scheduler->do_some_work(data.schedulehint.hint);
+        // Only a thread hint identifies the queue the work was added to.
+        scheduler->do_some_work(
+            data.schedulehint.mode == thread_schedule_hint_mode_thread ?
+                std::size_t(data.schedulehint.hint) :
+                std::size_t(-1));
     }
 }}}
 
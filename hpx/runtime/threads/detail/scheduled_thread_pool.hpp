@@ -239,6 +239,13 @@ namespace hpx { namespace threads { namespace detail
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_to_pending_remote(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_to_pending_remote(
+                num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool reset) override
@@ -272,9 +272,11 @@ namespace hpx { namespace threads { namespace detail
             auto thrd_data = get_thread_id_data(thrd);
             thrd_data->get_scheduler_base()->schedule_thread(thrd_data,
                 schedulehint, false, thrd_data->get_priority());
-            // NOTE: Don't care if the hint is a NUMA hint, just want to wake up
-            // a thread.
-            thrd_data->get_scheduler_base()->do_some_work(schedulehint.hint);
+            // Only a thread hint identifies the queue the work was added to.
+            thrd_data->get_scheduler_base()->do_some_work(
+                schedulehint.mode == thread_schedule_hint_mode_thread ?
+                    std::size_t(schedulehint.hint) :
+                    std::size_t(-1));
         }
 
         if (&ec != &throws)
@@ -23,6 +23,7 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
@@ -132,6 +133,7 @@ namespace hpx { namespace threads { namespace policies {
           , queues_(num_queues_)
           , high_priority_queues_(num_queues_)
           , victim_threads_(num_queues_)
+          , hierarchical_victims_(num_queues_)
         {
             if (!deferred_initialization)
             {
@@ -454,6 +456,40 @@ namespace hpx { namespace threads { namespace policies {
             }
             return num_stolen_threads;
         }
+
+        std::int64_t get_num_stolen_to_pending_remote(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_stolen_threads = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    num_stolen_threads +=
+                        high_priority_queues_[i]
+                            .data_->get_num_stolen_to_pending_remote(reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    num_stolen_threads +=
+                        queues_[i].data_->get_num_stolen_to_pending_remote(
+                            reset);
+                }
+                return num_stolen_threads;
+            }
+
+            num_stolen_threads +=
+                queues_[num_thread].data_->get_num_stolen_to_pending_remote(
+                    reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                num_stolen_threads +=
+                    high_priority_queues_[num_thread]
+                        .data_->get_num_stolen_to_pending_remote(reset);
+            }
+            return num_stolen_threads;
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -609,7 +645,12 @@ namespace hpx { namespace threads { namespace policies {
                 return false;
             }
 
-            if (enable_stealing)
+            if (enable_stealing && has_work_stealing_hierarchical())
+            {
+                if (steal_pending_hierarchical(num_thread, running, thrd))
+                    return true;
+            }
+            else if (enable_stealing)
             {
                 for (std::size_t idx : victim_threads_[num_thread].data_)
                 {
@@ -1059,7 +1100,46 @@ namespace hpx { namespace threads { namespace policies {
                 return true;
             }
 
-            if (enable_stealing)
+            if (enable_stealing && has_work_stealing_hierarchical())
+            {
+                bool stolen = for_each_victim_hierarchical(
+                    num_thread, [&](std::size_t idx, bool) {
+                        if (idx < num_high_priority_queues_ &&
+                            num_thread < num_high_priority_queues_)
+                        {
+                            thread_queue_type* q =
+                                high_priority_queues_[idx].data_;
+                            result = this_high_priority_queue->wait_or_add_new(
+                                         true, added, q) &&
+                                result;
+
+                            if (0 != added)
+                            {
+                                q->increment_num_stolen_from_staged(added);
+                                this_high_priority_queue
+                                    ->increment_num_stolen_to_staged(added);
+                                return true;
+                            }
+                        }
+
+                        thread_queue_type* q = queues_[idx].data_;
+                        result =
+                            this_queue->wait_or_add_new(true, added, q) &&
+                            result;
+
+                        if (0 != added)
+                        {
+                            q->increment_num_stolen_from_staged(added);
+                            this_queue->increment_num_stolen_to_staged(added);
+                            return true;
+                        }
+                        return false;
+                    });
+
+                if (stolen)
+                    return result;
+            }
+            else if (enable_stealing)
             {
                 for (std::size_t idx : victim_threads_[num_thread].data_)
                 {
@@ -1253,6 +1333,8 @@ namespace hpx { namespace threads { namespace policies {
                     return !any(numa_mask & numa_masks[other_num_thread]);
                 });
             }
+
+            init_hierarchical_victims(num_thread, topo, numa_masks);
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1288,6 +1370,181 @@ namespace hpx { namespace threads { namespace policies {
         }
 
     protected:
+        ///////////////////////////////////////////////////////////////////////
+        // Hierarchical work stealing: the victims of each worker thread are
+        // grouped by their distance in the machine topology. A thief visits
+        // all victims of one level (starting at a random position) before
+        // moving on to the next level. Victims running on a different NUMA
+        // domain are visited only if NUMA aware stealing is enabled.
+        enum steal_level
+        {
+            steal_level_l2_cache = 0,    // sharing the level 2 cache
+            steal_level_l3_cache = 1,    // sharing the level 3 cache
+            steal_level_numa = 2,        // on the same NUMA domain
+            steal_level_socket = 3,      // on the same socket
+            steal_level_remote = 4,      // anywhere else
+            num_steal_levels = 5
+        };
+
+        // The number of threads stolen in one go grows while stealing is
+        // successful and is reset as soon as no victim has any work left.
+        static constexpr std::int64_t max_steal_batch = 64;
+
+        struct hierarchical_victims
+        {
+            std::uint32_t next_random()
+            {
+                // xorshift32
+                seed_ ^= seed_ << 13;
+                seed_ ^= seed_ >> 17;
+                seed_ ^= seed_ << 5;
+                return seed_;
+            }
+
+            std::vector<std::size_t> victims_;
+            std::size_t level_end_[num_steal_levels] = {};
+            std::uint32_t seed_ = 1;
+            std::int64_t steal_batch_ = 1;
+        };
+
+        void init_hierarchical_victims(std::size_t num_thread,
+            topology const& topo, std::vector<mask_type> const& numa_masks)
+        {
+            std::size_t num_threads = num_queues_;
+            std::size_t num_pu = affinity_data_.get_pu_num(num_thread);
+
+            mask_cref_type l2_mask = topo.get_cache_affinity_mask(num_pu, 2);
+            mask_cref_type l3_mask = topo.get_cache_affinity_mask(num_pu, 3);
+            mask_cref_type numa_mask = numa_masks[num_thread];
+            mask_cref_type socket_mask = topo.get_socket_affinity_mask(num_pu);
+
+            auto get_level = [&](std::size_t other) -> std::size_t {
+                mask_cref_type other_pu_mask = topo.get_thread_affinity_mask(
+                    affinity_data_.get_pu_num(other));
+                if (any(l2_mask & other_pu_mask))
+                    return steal_level_l2_cache;
+                if (any(l3_mask & other_pu_mask))
+                    return steal_level_l3_cache;
+                if (any(numa_mask & numa_masks[other]))
+                    return steal_level_numa;
+                if (any(socket_mask & other_pu_mask))
+                    return steal_level_socket;
+                return steal_level_remote;
+            };
+
+            hierarchical_victims& v = hierarchical_victims_[num_thread].data_;
+            v.victims_.clear();
+            v.victims_.reserve(num_threads);
+            v.seed_ = static_cast<std::uint32_t>(num_thread) + 1;
+            v.steal_batch_ = 1;
+
+            for (std::size_t level = 0; level != num_steal_levels; ++level)
+            {
+                for (std::size_t i = 0; i != num_threads; ++i)
+                {
+                    if (i != num_thread && get_level(i) == level)
+                        v.victims_.push_back(i);
+                }
+                v.level_end_[level] = v.victims_.size();
+            }
+        }
+
+        // Invoke f(victim, remote) for all victims of the given worker thread
+        // in hierarchical order until f returns true.
+        template <typename F>
+        bool for_each_victim_hierarchical(std::size_t num_thread, F&& f)
+        {
+            hierarchical_victims& v = hierarchical_victims_[num_thread].data_;
+            std::size_t num_levels = has_work_stealing_numa() ?
+                std::size_t(num_steal_levels) :
+                std::size_t(steal_level_socket);
+
+            std::size_t begin = 0;
+            for (std::size_t level = 0; level != num_levels; ++level)
+            {
+                std::size_t end = v.level_end_[level];
+                std::size_t count = end - begin;
+                if (count != 0)
+                {
+                    bool remote = level >= steal_level_socket;
+                    std::size_t start = v.next_random() % count;
+                    for (std::size_t k = 0; k != count; ++k)
+                    {
+                        std::size_t idx =
+                            v.victims_[begin + (start + k) % count];
+                        HPX_ASSERT(idx != num_thread);
+                        if (f(idx, remote))
+                            return true;
+                    }
+                }
+                begin = end;
+            }
+            return false;
+        }
+
+        // Steal a thread to run from the closest victim which has pending
+        // work. Additional pending threads (up to half of the victim's queue)
+        // are moved to this worker's queue as well to amortize the cost of
+        // stealing from far away.
+        bool steal_pending_hierarchical(std::size_t num_thread, bool running,
+            threads::thread_data*& thrd)
+        {
+            thread_queue_type* this_queue = queues_[num_thread].data_;
+            hierarchical_victims& v = hierarchical_victims_[num_thread].data_;
+
+            bool result = for_each_victim_hierarchical(
+                num_thread, [&](std::size_t idx, bool remote) {
+                    if (idx < num_high_priority_queues_ &&
+                        num_thread < num_high_priority_queues_)
+                    {
+                        thread_queue_type* this_high_priority_queue =
+                            high_priority_queues_[num_thread].data_;
+                        thread_queue_type* q = high_priority_queues_[idx].data_;
+                        if (q->get_next_thread(thrd, running, true))
+                        {
+                            q->increment_num_stolen_from_pending();
+                            this_high_priority_queue
+                                ->increment_num_stolen_to_pending();
+                            if (remote)
+                            {
+                                this_high_priority_queue
+                                    ->increment_num_stolen_to_pending_remote();
+                            }
+                            return true;
+                        }
+                    }
+
+                    thread_queue_type* q = queues_[idx].data_;
+                    if (!q->get_next_thread(thrd, running, true))
+                        return false;
+
+                    std::int64_t num_stolen = 1;
+                    std::int64_t batch = (std::min)(
+                        q->get_pending_queue_length() / 2, v.steal_batch_);
+                    if (batch > 0)
+                    {
+                        num_stolen +=
+                            this_queue->steal_work_items_from(q, batch);
+                    }
+
+                    q->increment_num_stolen_from_pending(num_stolen);
+                    this_queue->increment_num_stolen_to_pending(num_stolen);
+                    if (remote)
+                    {
+                        this_queue->increment_num_stolen_to_pending_remote(
+                            num_stolen);
+                    }
+
+                    v.steal_batch_ = (std::min)(
+                        2 * v.steal_batch_, std::int64_t(max_steal_batch));
+                    return true;
+                });
+
+            if (!result)
+                v.steal_batch_ = 1;
+            return result;
+        }
+
         std::atomic<std::size_t> curr_queue_;
 
         detail::affinity_data const& affinity_data_;
@@ -1302,6 +1559,8 @@ namespace hpx { namespace threads { namespace policies {
             high_priority_queues_;
         std::vector<util::cache_line_data<std::vector<std::size_t>>>
             victim_threads_;
+        std::vector<util::cache_line_data<hierarchical_victims>>
+            hierarchical_victims_;
     };
 }}}    // namespace hpx::threads::policies
 
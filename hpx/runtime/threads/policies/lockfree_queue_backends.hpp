@@ -21,6 +21,12 @@
 // Does not rely on CXX11_STD_ATOMIC_128BIT
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+#include <hpx/concurrency/chase_lev_deque.hpp>
+
+#include <atomic>
+#endif
+
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -296,6 +302,141 @@ namespace hpx { namespace threads { namespace policies {
 #endif    // HPX_HAVE_ABP_SCHEDULER
 #endif    // HPX_HAVE_CXX11_STD_ATOMIC_128BIT
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+    ////////////////////////////////////////////////////////////////////////////
+    // LIFO for the owning worker thread + FIFO stealing by all others, based
+    // on a Chase-Lev work-stealing deque.
+    //
+    // The Chase-Lev deque allows for only one thread to push and pop at its
+    // bottom end. The owning thread is the worker thread which has claimed
+    // the queue during its startup (see claim_ownership() below). Work
+    // scheduled by any other thread (or to the other end) is collected in an
+    // additional multi-producer queue which is drained by everybody once the
+    // deque has run dry.
+    struct lockfree_chase_lev;
+
+    template <typename T>
+    struct lockfree_chase_lev_backend
+    {
+        using container_type = hpx::concurrency::chase_lev_deque<T>;
+        using inbox_type = moodycamel::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::uint64_t;
+
+        lockfree_chase_lev_backend(
+            size_type initial_size = 0, size_type num_thread = size_type(-1))
+          : queue_(std::size_t(initial_size))
+          , inbox_(std::size_t(initial_size))
+          , owner_(nullptr)
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push(val);
+                return true;
+            }
+            return inbox_.enqueue(val);
+        }
+
+        bool pop(reference val, bool /*steal*/ = true)
+        {
+            if (is_owner())
+            {
+                if (queue_.pop(val))
+                    return true;
+            }
+            else if (queue_.steal(val))
+            {
+                return true;
+            }
+            return inbox_.try_dequeue(val);
+        }
+
+        bool empty()
+        {
+            return queue_.empty() && inbox_.size_approx() == 0;
+        }
+
+        // The first worker thread announcing itself becomes the owner of the
+        // deque, all other threads are treated as thieves.
+        void claim_ownership()
+        {
+            void const* expected = nullptr;
+            owner_.compare_exchange_strong(expected, this_thread_token(),
+                std::memory_order_acq_rel);
+        }
+
+        void release_ownership()
+        {
+            void const* expected = this_thread_token();
+            owner_.compare_exchange_strong(
+                expected, nullptr, std::memory_order_acq_rel);
+        }
+
+    private:
+        // The address of a thread local variable uniquely identifies the
+        // calling OS thread.
+        static void const* this_thread_token()
+        {
+            static HPX_NATIVE_TLS char token = 0;
+            return &token;
+        }
+
+        bool is_owner() const
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                this_thread_token();
+        }
+
+        container_type queue_;
+        inbox_type inbox_;
+        std::atomic<void const*> owner_;
+    };
+
+    struct lockfree_chase_lev
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_chase_lev_backend<T>;
+        };
+    };
+#endif    // HPX_HAVE_CHASE_LEV_SCHEDULER
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Queue backends distinguishing between the worker thread owning a queue
+    // and all other threads are notified whenever a worker thread starts or
+    // stops using a queue.
+    template <typename Queue>
+    void claim_queue_ownership(Queue&)
+    {
+    }
+
+    template <typename Queue>
+    void release_queue_ownership(Queue&)
+    {
+    }
+
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+    template <typename T>
+    void claim_queue_ownership(lockfree_chase_lev_backend<T>& queue)
+    {
+        queue.claim_ownership();
+    }
+
+    template <typename T>
+    void release_queue_ownership(lockfree_chase_lev_backend<T>& queue)
+    {
+        queue.release_ownership();
+    }
+#endif
+
 }}}    // namespace hpx::threads::policies
 
 #endif    // HPX_FB3518C8_4493_450E_A823_A9F8A3185B2D
@@ -34,6 +34,11 @@
 
 #include <hpx/config/warnings_prefix.hpp>
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF) &&                           \
+    (defined(__linux) || defined(linux) || defined(__linux__))
+#define HPX_HAVE_THREAD_MANAGER_IDLE_FUTEX
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads { namespace policies {
     ///////////////////////////////////////////////////////////////////////////
@@ -115,6 +120,12 @@ namespace hpx { namespace threads { namespace policies {
             return (get_scheduler_mode() & policies::enable_stealing_numa);
         }
 
+        bool has_work_stealing_hierarchical() const
+        {
+            return (get_scheduler_mode() &
+                policies::enable_stealing_hierarchical);
+        }
+
         // get/set scheduler mode
         scheduler_mode get_scheduler_mode() const
         {
@@ -179,6 +190,14 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // schedulers not distinguishing between local and remote victims
+        // don't report any remote steals
+        virtual std::int64_t get_num_stolen_to_pending_remote(
+            std::size_t num_thread, bool reset)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -194,6 +213,15 @@ namespace hpx { namespace threads { namespace policies {
         void increment_background_thread_count();
         void decrement_background_thread_count();
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // return whether the given worker thread is parked waiting for work
+        bool is_parked(std::size_t num_thread) const
+        {
+            return wait_counts_[num_thread].data_.parked_.load(
+                std::memory_order_acquire);
+        }
+#endif
+
         // Enumerate all matching threads
         virtual bool enumerate_threads(
             util::function_nonser<bool(thread_id_type)> const& f,
@@ -280,15 +308,27 @@ namespace hpx { namespace threads { namespace policies {
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
+        // support for parking worker threads on idle queues, each worker
+        // sleeps on its own event count (a futex on Linux) which is signaled
+        // by do_some_work
         struct idle_backoff_data
         {
-            std::uint32_t wait_count_;
-            double max_idle_backoff_time_;
+            std::uint32_t wait_count_ = 0;
+            double max_idle_backoff_time_ = 0;
+
+            // incremented on each wake up, this is the futex word
+            std::atomic<std::uint32_t> epoch_{0};
+            std::atomic<bool> parked_{false};
+#if !defined(HPX_HAVE_THREAD_MANAGER_IDLE_FUTEX)
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+#endif
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+        util::cache_line_data<std::atomic<std::size_t>> parked_threads_;
+
+        bool unpark(std::size_t num_thread);
+        void unpark_all();
 #endif
 
         // support for suspension of pus
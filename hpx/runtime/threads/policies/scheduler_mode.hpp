@@ -52,6 +52,11 @@ namespace hpx { namespace threads { namespace policies
             ///< queues are empty
         enable_idle_backoff       = 0x800,     ///< This option allows for certain
             ///< schedulers to explicitly disable exponential idle-back off
+        enable_stealing_hierarchical = 0x1000, ///< This option tells
+            ///< schedulers that support it to select victims based on their
+            ///< distance in the machine topology (sharing the L2 cache, the
+            ///< L3 cache, the NUMA domain, the socket), picking victims
+            ///< randomly on each level and stealing batches of work
         default_mode =
                 do_background_work |
                 reduce_thread_priority |
@@ -74,7 +79,8 @@ namespace hpx { namespace threads { namespace policies
                 assign_work_thread_parent |
                 steal_high_priority_first |
                 steal_after_local |
-                enable_idle_backoff
+                enable_idle_backoff |
+                enable_stealing_hierarchical
     };
 }}}
 
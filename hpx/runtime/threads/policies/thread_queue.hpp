@@ -12,6 +12,7 @@
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/coroutines/detail/stack_cache.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/errors.hpp>
 #include <hpx/format.hpp>
@@ -489,6 +490,7 @@ namespace hpx { namespace threads { namespace policies {
           , stolen_from_staged_(0)
           , stolen_to_pending_(0)
           , stolen_to_staged_(0)
+          , stolen_to_pending_remote_(0)
 #endif
         {
             new_tasks_count_.data_ = 0;
@@ -628,6 +630,17 @@ namespace hpx { namespace threads { namespace policies {
         {
             stolen_to_staged_.fetch_add(num, std::memory_order_relaxed);
         }
+
+        std::int64_t get_num_stolen_to_pending_remote(bool reset)
+        {
+            return util::get_and_reset_value(stolen_to_pending_remote_, reset);
+        }
+
+        void increment_num_stolen_to_pending_remote(std::size_t num = 1)
+        {
+            stolen_to_pending_remote_.fetch_add(
+                num, std::memory_order_relaxed);
+        }
 #else
         HPX_CXX14_CONSTEXPR void increment_num_pending_misses(
             std::size_t num = 1)
@@ -653,6 +666,10 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num = 1)
         {
         }
+        HPX_CXX14_CONSTEXPR void increment_num_stolen_to_pending_remote(
+            std::size_t num = 1)
+        {
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -752,6 +769,34 @@ namespace hpx { namespace threads { namespace policies {
             }
         }
 
+        // Move up to count pending threads from the given queue to this one,
+        // returns the number of threads actually moved.
+        std::int64_t steal_work_items_from(
+            thread_queue* src, std::int64_t count)
+        {
+            std::int64_t moved = 0;
+            thread_description* trd;
+            while (moved != count && src->work_items_.pop(trd, true))
+            {
+                --src->work_items_count_.data_;
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                if (maintain_queue_wait_times)
+                {
+                    std::uint64_t now = util::high_resolution_clock::now();
+                    src->work_items_wait_ += now - util::get<1>(*trd);
+                    ++src->work_items_wait_count_;
+                    util::get<1>(*trd) = now;
+                }
+#endif
+
+                ++work_items_count_.data_;
+                work_items_.push(trd);
+                ++moved;
+            }
+            return moved;
+        }
+
         void move_task_items_from(thread_queue* src, std::int64_t count)
         {
             task_description* task;
@@ -1017,6 +1062,10 @@ namespace hpx { namespace threads { namespace policies {
                 bool added_new = add_new_always(added, addfrom, lk, steal);
                 if (!added_new)
                 {
+                    // give memory of idle thread stacks back to the system,
+                    // this is a no-op unless the decommit delay has expired
+                    coroutines::detail::trim_stack_cache();
+
                     // Before exiting each of the OS threads deletes the
                     // remaining terminated HPX threads
                     // REVIEW: Should we be doing this if we are stealing?
@@ -1064,8 +1113,14 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
-        void on_stop_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            claim_queue_ownership(work_items_);
+        }
+        void on_stop_thread(std::size_t num_thread)
+        {
+            release_queue_ownership(work_items_);
+        }
         void on_error(std::size_t num_thread, std::exception_ptr const& e) {}
 
     private:
@@ -1126,6 +1181,9 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<std::int64_t> stolen_to_pending_;
         // count of new_tasks stolen to this queue from other queues
         std::atomic<std::int64_t> stolen_to_staged_;
+        // count of work_items stolen to this queue from queues of worker
+        // threads running on a different NUMA domain
+        std::atomic<std::int64_t> stolen_to_pending_remote_;
 #endif
         // count of new tasks to run, separate to new cache line to avoid false
         // sharing
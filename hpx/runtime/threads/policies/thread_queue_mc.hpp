@@ -1058,8 +1058,14 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
-        void on_stop_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            claim_queue_ownership(work_items_);
+        }
+        void on_stop_thread(std::size_t num_thread)
+        {
+            release_queue_ownership(work_items_);
+        }
         void on_error(std::size_t num_thread, std::exception_ptr const& e) {}
 
     private:
@@ -285,6 +285,8 @@ namespace hpx { namespace threads
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_stolen_to_pending_remote(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
 #endif
 
         virtual std::int64_t get_thread_count(thread_state_enum /*state*/,
@@ -10,20 +10,28 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <hpx/config/warnings_prefix.hpp>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util
 {
+    // Each worker thread allocates from its own heap, no lock is acquired
+    // unless that heap is exhausted. The heap owning an element is found
+    // from the element's address, which allows to free elements without
+    // acquiring a lock either.
     class HPX_EXPORT one_size_heap_list
     {
     public:
@@ -61,6 +69,8 @@ namespace hpx { namespace util
 #endif
             , create_heap_(nullptr)
             , parameters_({0, 0, 0})
+            , block_size_(0)
+            , num_thread_heaps_(0)
         {
             HPX_ASSERT(false); // shouldn't ever be called
         }
@@ -76,7 +86,9 @@ namespace hpx { namespace util
             , max_alloc_count_(0L)
 #endif
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
-            , parameters_(parameters)
+            , parameters_(wrapper_heap_base::fill_block(parameters))
+            , block_size_(wrapper_heap_base::block_size(parameters_))
+            , num_thread_heaps_(0)
         {}
 
         template <typename Heap>
@@ -90,7 +102,9 @@ namespace hpx { namespace util
             , max_alloc_count_(0L)
 #endif
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
-            , parameters_(parameters)
+            , parameters_(wrapper_heap_base::fill_block(parameters))
+            , block_size_(wrapper_heap_base::block_size(parameters_))
+            , num_thread_heaps_(0)
         {}
 
         ~one_size_heap_list() noexcept;
@@ -107,6 +121,25 @@ namespace hpx { namespace util
 
         std::string name() const;
 
+    protected:
+        // Return the heap owning the given element, the element must have
+        // been allocated from this heap list.
+        wrapper_heap_base* get_heap(void* p) const
+        {
+            return wrapper_heap_base::owner(p, block_size_);
+        }
+
+        // Return the heap owning the given element, or an empty pointer if
+        // the element was not allocated from this heap list.
+        std::shared_ptr<util::wrapper_heap_base> find_heap(void* p) const;
+
+    private:
+        typedef std::shared_ptr<util::wrapper_heap_base> heap_ptr_type;
+
+        heap_ptr_type* get_thread_heap() const;
+        heap_ptr_type& get_current_heap(unique_lock_type& l);
+        void remove_heap(wrapper_heap_base* heap);
+
     protected:
         mutable mutex_type mtx_;
         list_type heap_list_;
@@ -116,15 +149,29 @@ namespace hpx { namespace util
 
     public:
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
+        std::atomic<std::size_t> alloc_count_;
+        std::atomic<std::size_t> free_count_;
         std::size_t heap_count_;
-        std::size_t max_alloc_count_;
+        std::atomic<std::size_t> max_alloc_count_;
 #endif
         std::shared_ptr<util::wrapper_heap_base> (*create_heap_)(
             char const*, std::size_t, heap_parameters);
 
         heap_parameters const parameters_;
+
+    private:
+        std::size_t const block_size_;
+
+        // the heaps which have not released their memory yet, indexed by the
+        // address of their block
+        std::unordered_map<std::uintptr_t, heap_ptr_type> heap_blocks_;
+
+        // the heap each worker thread allocates from, threads not having a
+        // heap of their own share the one below
+        std::unique_ptr<util::cache_aligned_data<heap_ptr_type>[]>
+            thread_heaps_;
+        std::atomic<std::size_t> num_thread_heaps_;
+        heap_ptr_type shared_heap_;
     };
 }}
 
@@ -85,6 +85,8 @@ namespace hpx { namespace util
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        std::size_t get_agas_refcnt_requests_flush_interval() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(char const* filename,
@@ -142,6 +144,7 @@ namespace hpx { namespace util
         std::ptrdiff_t init_medium_stack_size() const;
         std::ptrdiff_t init_large_stack_size() const;
         std::ptrdiff_t init_huge_stack_size() const;
+        void init_stack_cache() const;
 
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         bool init_use_stack_guard_pages() const;
@@ -13,6 +13,7 @@
 #include <hpx/util/generate_unique_ids.hpp>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace hpx { namespace util
 {
@@ -27,9 +28,62 @@ namespace hpx { namespace util
 
         virtual ~wrapper_heap_base() {}
 
+        // A heap places its elements into a block of memory which is aligned
+        // to its (power of two) size. The first bytes of the block refer
+        // back to the heap, which allows to find the heap owning an element
+        // without searching.
+        static std::size_t block_header_size(heap_parameters const& p)
+        {
+            return p.element_alignment < sizeof(wrapper_heap_base*) ?
+                sizeof(wrapper_heap_base*) : p.element_alignment;
+        }
+
+        static std::size_t block_size(heap_parameters const& p)
+        {
+            std::size_t const size =
+                block_header_size(p) + p.capacity * p.element_size;
+
+            std::size_t result = 1;
+            while (result < size)
+                result <<= 1;
+            return result;
+        }
+
+        // The block is rounded up to a power of two, grow the capacity to
+        // use the memory at its end as well. This doesn't change the size of
+        // the block.
+        static heap_parameters fill_block(heap_parameters p)
+        {
+            p.capacity = (block_size(p) - block_header_size(p)) /
+                p.element_size;
+            return p;
+        }
+
+        // Return the address of the block the given element belongs to
+        static std::uintptr_t block_of(void* p, std::size_t block_size)
+        {
+            return reinterpret_cast<std::uintptr_t>(p) &
+                ~std::uintptr_t(block_size - 1);
+        }
+
+        // Return the heap the given element was allocated from. The element
+        // must have been allocated by a heap using the given block size.
+        static wrapper_heap_base* owner(void* p, std::size_t block_size)
+        {
+            return *reinterpret_cast<wrapper_heap_base* const*>(
+                block_of(p, block_size));
+        }
+
         virtual bool alloc(void** result, std::size_t count = 1) = 0;
         virtual bool did_alloc (void *p) const = 0;
-        virtual void free(void *p, std::size_t count = 1) = 0;
+
+        // Returns true if this was the last element allocated from the heap
+        // and the heap has released its memory.
+        virtual bool free(void *p, std::size_t count = 1) = 0;
+
+        // Stop allocating from this heap, returns true if the heap has
+        // released its memory as a consequence.
+        virtual bool seal() = 0;
 
         virtual naming::gid_type get_gid(util::unique_id_ranges& ids, void* p,
             components::component_type type) = 0;
@@ -55,7 +55,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     ExPolicy&& policy, FwdIter first, FwdIter last, Pred&& op)
             {
                 typedef hpx::util::zip_iterator<FwdIter, FwdIter> zip_iterator;
-                typedef typename zip_iterator::reference reference;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
@@ -73,12 +72,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [HPX_CAPTURE_FORWARD(op), tok](zip_iterator it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&op, &tok](reference t, std::size_t i) {
-                            using hpx::util::get;
-                            if (op(get<0>(t), get<1>(t)))
-                                tok.cancel(i);
-                        });
+                    util::find_first_idx_n<ExPolicy>(base_idx, it, part_size,
+                        tok, detail::make_fused_predicate(op));
                 };
 
                 auto f2 =
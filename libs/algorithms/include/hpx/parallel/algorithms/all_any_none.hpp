@@ -15,6 +15,7 @@
 #include <hpx/type_support/void_guard.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/traits/projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -68,14 +69,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [HPX_CAPTURE_FORWARD(op), tok,
                               HPX_CAPTURE_FORWARD(proj)](FwdIter part_begin,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(part_begin, part_count, tok,
-                        [&op, &tok, &proj](FwdIter const& curr) {
-                            if (hpx::util::invoke(
-                                    op, hpx::util::invoke(proj, *curr)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    util::find_any_n<ExPolicy>(part_begin, part_count, tok,
+                        util::invoke_projected<F, Proj>(op, proj));
 
                     return !tok.was_cancelled();
                 };
@@ -232,14 +227,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [HPX_CAPTURE_FORWARD(op), tok,
                               HPX_CAPTURE_FORWARD(proj)](FwdIter part_begin,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(part_begin, part_count, tok,
-                        [&op, &tok, &proj](FwdIter const& curr) {
-                            if (hpx::util::invoke(
-                                    op, hpx::util::invoke(proj, *curr)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    util::find_any_n<ExPolicy>(part_begin, part_count, tok,
+                        util::invoke_projected<F, Proj>(op, proj));
 
                     return tok.was_cancelled();
                 };
@@ -396,14 +385,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [HPX_CAPTURE_FORWARD(op), tok,
                               HPX_CAPTURE_FORWARD(proj)](FwdIter part_begin,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(part_begin, part_count, tok,
-                        [&op, &tok, &proj](FwdIter const& curr) {
-                            if (!hpx::util::invoke(
-                                    op, hpx::util::invoke(proj, *curr)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    util::find_any_n<ExPolicy>(part_begin, part_count, tok,
+                        detail::make_not_predicate(
+                            util::invoke_projected<F, Proj>(op, proj)));
 
                     return !tok.was_cancelled();
                 };
@@ -0,0 +1,339 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_OCT_19_2019_1020AM)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_OCT_19_2019_1020AM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/result_of.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map arithmetic keys onto unsigned integers of the same size such that
+    // the unsigned order of the encoded keys matches operator<() on the keys.
+    template <typename T, typename Enable = void>
+    struct radix_key_traits
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        typename std::enable_if<std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value>::type>
+    {
+        static constexpr bool value = true;
+
+        typedef typename std::make_unsigned<T>::type type;
+
+        static type encode(T key)
+        {
+            // flip the sign bit of signed keys
+            return type(key) ^
+                (std::is_signed<T>::value ? type(type(1) << (8 * sizeof(T) - 1)) :
+                                            type(0));
+        }
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        typename std::enable_if<std::is_floating_point<T>::value &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>::type>
+    {
+        static constexpr bool value = true;
+
+        typedef typename std::conditional<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>::type type;
+
+        static type encode(T key)
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(type));
+
+            // negative numbers have all bits flipped, positive numbers only
+            // the sign bit
+            type const sign_bit = type(1) << (8 * sizeof(type) - 1);
+            return (bits & sign_bit) ? type(~bits) : type(bits | sign_bit);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The radix sort replaces the comparison sort only if it is guaranteed to
+    // produce the same ordering, i.e. for arithmetic keys compared using
+    // operator<().
+    template <typename Compare, typename Key>
+    struct is_radix_sort_compare
+      : std::integral_constant<bool,
+            std::is_same<Compare, detail::less>::value ||
+                std::is_same<Compare, std::less<Key>>::value ||
+                std::is_same<Compare, std::less<>>::value>
+    {
+    };
+
+    template <typename RandomIt, typename Proj>
+    struct radix_sort_key_type
+      : std::decay<typename hpx::util::invoke_result<
+            typename std::decay<Proj>::type&,
+            typename std::iterator_traits<RandomIt>::reference>::type>
+    {
+    };
+
+    template <typename RandomIt, typename Compare, typename Proj,
+        typename Enable = void>
+    struct is_radix_sortable : std::false_type
+    {
+    };
+
+    template <typename RandomIt, typename Compare, typename Proj>
+    struct is_radix_sortable<RandomIt, Compare, Proj,
+        typename std::enable_if<hpx::traits::is_random_access_iterator<
+            RandomIt>::value>::type>
+      : std::integral_constant<bool,
+            radix_key_traits<
+                typename radix_sort_key_type<RandomIt, Proj>::type>::value &&
+                is_radix_sort_compare<typename std::decay<Compare>::type,
+                    typename radix_sort_key_type<RandomIt, Proj>::type>::value &&
+                std::is_default_constructible<typename std::iterator_traits<
+                    RandomIt>::value_type>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of bits sorted in each pass
+    static constexpr std::size_t radix_sort_bits = 8;
+    static constexpr std::size_t radix_sort_buckets =
+        std::size_t(1) << radix_sort_bits;
+
+    // Elements are scattered through per-bucket buffers holding one cache
+    // line worth of elements. This turns the random writes of the scatter
+    // into writes of whole cache lines.
+    template <typename T>
+    struct radix_sort_scatter_buffer_size
+      : std::integral_constant<std::size_t,
+            threads::get_cache_line_size() / sizeof(T)>
+    {
+    };
+
+    template <typename Iter, typename Proj>
+    auto radix_sort_key(Iter it, Proj& proj)
+        -> decltype(hpx::util::invoke(proj, *it))
+    {
+        return hpx::util::invoke(proj, *it);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the elements in [src, src + count) on the digit at the given
+    // shift, storing the result in [dest, dest + count). Each chunk is
+    // handled by one task which builds its own histogram.
+    template <typename ExPolicy, typename Traits, typename SrcIter,
+        typename DestIter, typename Proj>
+    void radix_sort_pass(ExPolicy const& policy, SrcIter src, DestIter dest,
+        std::size_t count, std::size_t shift, Proj& proj,
+        std::vector<std::size_t> const& chunk_sizes,
+        std::vector<std::size_t> const& chunks,
+        std::vector<std::size_t>& histograms)
+    {
+        typedef typename std::iterator_traits<SrcIter>::value_type value_type;
+        typedef util::detail::static_partitioner<ExPolicy, void, void>
+            partitioner;
+
+        std::size_t const chunk_size = chunk_sizes[0];
+        std::size_t const num_chunks = chunks.size();
+
+        // build the histogram of each chunk
+        partitioner::call_with_data(
+            policy, src, count,
+            [&](std::size_t chunk, SrcIter it, std::size_t size) -> void {
+                std::array<std::size_t, radix_sort_buckets> local = {};
+                for (std::size_t i = 0; i != size; ++i, ++it)
+                {
+                    ++local[(Traits::encode(radix_sort_key(it, proj)) >>
+                                shift) &
+                        (radix_sort_buckets - 1)];
+                }
+                std::copy(local.begin(), local.end(),
+                    histograms.begin() + chunk * radix_sort_buckets);
+            },
+            [](std::vector<hpx::future<void>>&&) {}, chunk_sizes, chunks);
+
+        // turn the histograms into the start offset of each bucket of each
+        // chunk: buckets are laid out one after the other, inside each
+        // bucket the elements of the chunks follow each other
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket != radix_sort_buckets; ++bucket)
+        {
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t& h = histograms[chunk * radix_sort_buckets + bucket];
+                std::size_t n = h;
+                h = offset;
+                offset += n;
+            }
+        }
+        HPX_ASSERT(offset == count);
+
+        // scatter the elements to their buckets
+        partitioner::call_with_data(
+            policy, src, count,
+            [&](std::size_t chunk, SrcIter it, std::size_t size) -> void {
+                std::size_t* offsets =
+                    histograms.data() + chunk * radix_sort_buckets;
+
+                std::size_t const buffer_size =
+                    radix_sort_scatter_buffer_size<value_type>::value;
+                if (buffer_size < 2 || size < chunk_size / 4)
+                {
+                    for (std::size_t i = 0; i != size; ++i, ++it)
+                    {
+                        std::size_t bucket =
+                            (Traits::encode(radix_sort_key(it, proj)) >>
+                                shift) &
+                            (radix_sort_buckets - 1);
+                        dest[offsets[bucket]++] = std::move(*it);
+                    }
+                    return;
+                }
+
+                std::vector<value_type> buffer(
+                    radix_sort_buckets * buffer_size);
+                std::array<std::uint8_t, radix_sort_buckets> fill = {};
+
+                for (std::size_t i = 0; i != size; ++i, ++it)
+                {
+                    std::size_t bucket =
+                        (Traits::encode(radix_sort_key(it, proj)) >> shift) &
+                        (radix_sort_buckets - 1);
+
+                    auto b = buffer.begin() + bucket * buffer_size;
+                    b[fill[bucket]] = std::move(*it);
+                    if (++fill[bucket] == buffer_size)
+                    {
+                        std::move(b, b + buffer_size, dest + offsets[bucket]);
+                        offsets[bucket] += buffer_size;
+                        fill[bucket] = 0;
+                    }
+                }
+
+                // flush the remaining elements
+                for (std::size_t bucket = 0; bucket != radix_sort_buckets;
+                     ++bucket)
+                {
+                    auto b = buffer.begin() + bucket * buffer_size;
+                    std::move(b, b + fill[bucket], dest + offsets[bucket]);
+                }
+            },
+            [](std::vector<hpx::future<void>>&&) {}, chunk_sizes, chunks);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel least significant digit radix sort. Digits which are equal
+    // for all keys are skipped.
+    template <typename ExPolicy, typename RandomIt, typename Proj>
+    RandomIt radix_sort_thread(ExPolicy policy, RandomIt first, RandomIt last,
+        Proj proj, std::size_t chunk_size)
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+        typedef typename std::decay<decltype(
+            radix_sort_key(first, proj))>::type key_type;
+        typedef radix_key_traits<key_type> traits;
+        typedef typename traits::type bits_type;
+        typedef util::detail::static_partitioner<ExPolicy, void, void>
+            partitioner;
+
+        std::size_t const count = last - first;
+        std::size_t const num_chunks = (count + chunk_size - 1) / chunk_size;
+
+        std::vector<std::size_t> chunk_sizes(num_chunks, chunk_size);
+        std::vector<std::size_t> chunks(num_chunks);
+        std::iota(chunks.begin(), chunks.end(), std::size_t(0));
+
+        // find the bits which differ between the keys
+        bits_type const reference = traits::encode(radix_sort_key(first, proj));
+        std::vector<bits_type> differences(num_chunks);
+
+        partitioner::call_with_data(
+            policy, first, count,
+            [&](std::size_t chunk, RandomIt it, std::size_t size) -> void {
+                bits_type diff = 0;
+                for (std::size_t i = 0; i != size; ++i, ++it)
+                    diff |= traits::encode(radix_sort_key(it, proj)) ^ reference;
+                differences[chunk] = diff;
+            },
+            [](std::vector<hpx::future<void>>&&) {}, chunk_sizes, chunks);
+
+        bits_type diff = 0;
+        for (bits_type d : differences)
+            diff |= d;
+
+        if (diff == 0)
+            return last;
+
+        // sort by each digit, alternating between the input and a
+        // temporary buffer
+        std::vector<value_type> buffer(count);
+        std::vector<std::size_t> histograms(num_chunks * radix_sort_buckets);
+
+        bool in_buffer = false;
+        for (std::size_t shift = 0; shift < 8 * sizeof(bits_type);
+             shift += radix_sort_bits)
+        {
+            if (((diff >> shift) & (radix_sort_buckets - 1)) == 0)
+                continue;
+
+            if (in_buffer)
+            {
+                radix_sort_pass<ExPolicy, traits>(policy, buffer.begin(), first,
+                    count, shift, proj, chunk_sizes, chunks, histograms);
+            }
+            else
+            {
+                radix_sort_pass<ExPolicy, traits>(policy, first, buffer.begin(),
+                    count, shift, proj, chunk_sizes, chunks, histograms);
+            }
+            in_buffer = !in_buffer;
+        }
+
+        // move the result back to the input sequence
+        if (in_buffer)
+        {
+            partitioner::call_with_data(
+                policy, buffer.begin(), count,
+                [&](std::size_t chunk,
+                    typename std::vector<value_type>::iterator it,
+                    std::size_t size) -> void {
+                    std::move(it, it + size, first + chunk * chunk_size);
+                },
+                [](std::vector<hpx::future<void>>&&) {}, chunk_sizes, chunks);
+        }
+
+        return last;
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
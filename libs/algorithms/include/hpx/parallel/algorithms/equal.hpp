@@ -107,20 +107,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
                 auto f1 = [f, tok](zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(f, hpx::util::get<0>(t),
-                                    hpx::util::get<1>(t)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    util::find_any_n<ExPolicy>(it, part_count, tok,
+                        detail::make_not_predicate(
+                            detail::make_fused_predicate(f)));
                     return !tok.was_cancelled();
                 };
 
@@ -267,20 +260,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
                 auto f1 = [f, tok](zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(f, hpx::util::get<0>(t),
-                                    hpx::util::get<1>(t)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    util::find_any_n<ExPolicy>(it, part_count, tok,
+                        detail::make_not_predicate(
+                            detail::make_fused_predicate(f)));
                     return !tok.was_cancelled();
                 };
 
@@ -59,7 +59,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter>
                     result;
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
@@ -71,11 +70,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [val, tok](FwdIter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&val, &tok](type& v, std::size_t i) -> void {
-                            if (v == val)
-                                tok.cancel(i);
-                        });
+                    util::find_first_idx_n<ExPolicy>(base_idx, it, part_size,
+                        tok, detail::compare_to<T>(val));
                 };
 
                 auto f2 =
@@ -200,7 +196,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter>
                     result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -213,11 +208,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [HPX_CAPTURE_FORWARD(f), tok](FwdIter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(f, v))
-                                tok.cancel(i);
-                        });
+                    util::find_first_idx_n<ExPolicy>(
+                        base_idx, it, part_size, tok, f);
                 };
 
                 auto f2 =
@@ -362,7 +354,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter>
                     result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -375,11 +366,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [HPX_CAPTURE_FORWARD(f), tok](FwdIter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &tok](type& v, std::size_t i) -> void {
-                            if (!hpx::util::invoke(f, v))
-                                tok.cancel(i);
-                        });
+                    util::find_first_idx_n<ExPolicy>(base_idx, it, part_size,
+                        tok, detail::make_not_predicate(f));
                 };
 
                 auto f2 =
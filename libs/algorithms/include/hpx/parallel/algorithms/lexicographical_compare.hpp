@@ -36,6 +36,28 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // lexicographical_compare
     namespace detail {
         /// \cond NOINTERNAL
+
+        // The elements of both sequences at a given position differ if
+        // either of them compares less than the other one
+        template <typename Pred>
+        struct lexicographical_compare_differs
+        {
+            Pred& pred_;
+
+            template <typename Tuple>
+            HPX_HOST_DEVICE HPX_FORCEINLINE auto operator()(Tuple&& t)
+                -> decltype(hpx::util::invoke(pred_, hpx::util::get<0>(t),
+                                hpx::util::get<1>(t)) ||
+                    hpx::util::invoke(
+                        pred_, hpx::util::get<1>(t), hpx::util::get<0>(t)))
+            {
+                using hpx::util::get;
+                using hpx::util::invoke;
+                return invoke(pred_, get<0>(t), get<1>(t)) ||
+                    invoke(pred_, get<1>(t), get<0>(t));
+            }
+        };
+
         struct lexicographical_compare
           : public detail::algorithm<lexicographical_compare, bool>
         {
@@ -61,7 +83,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 std::size_t count1 = std::distance(first1, last1);
                 std::size_t count2 = std::distance(first2, last2);
@@ -85,16 +106,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [tok, pred](zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&pred, &tok](reference t, std::size_t i) -> void {
-                            using hpx::util::get;
-                            using hpx::util::invoke;
-                            if (invoke(pred, get<0>(t), get<1>(t)) ||
-                                invoke(pred, get<1>(t), get<0>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    util::find_first_idx_n<ExPolicy>(base_idx, it,
+                        part_count, tok,
+                        lexicographical_compare_differs<Pred>{pred});
                 };
 
                 auto f2 =
@@ -41,6 +41,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // min_element
     namespace detail {
         /// \cond NOINTERNAL
+
+        // The position of the extremal element is tracked while iterating,
+        // the elements are therefore inspected one at a time even for the
+        // vector-pack execution policies.
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
         FwdIter sequential_min_element(ExPolicy&& policy, FwdIter it,
@@ -50,7 +54,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return it;
 
             FwdIter smallest = it;
-            util::loop_n<ExPolicy>(++it, count - 1,
+            util::loop_n<execution::sequenced_policy>(++it, count - 1,
                 [&f, &smallest, &proj](FwdIter const& curr) -> void {
                     if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
                             hpx::util::invoke(proj, *smallest)))
@@ -81,7 +85,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type smallest =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<execution::sequenced_policy>(++it, count - 1,
                     [&f, &smallest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, **curr),
@@ -267,7 +271,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return it;
 
             FwdIter greatest = it;
-            util::loop_n<ExPolicy>(++it, count - 1,
+            util::loop_n<execution::sequenced_policy>(++it, count - 1,
                 [&f, &greatest, &proj](FwdIter const& curr) -> void {
                     if (hpx::util::invoke(f, hpx::util::invoke(proj, *greatest),
                             hpx::util::invoke(proj, *curr)))
@@ -298,7 +302,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type greatest =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<execution::sequenced_policy>(++it, count - 1,
                     [&f, &greatest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *greatest),
@@ -486,7 +490,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             if (count == 0 || count == 1)
                 return result;
 
-            util::loop_n<ExPolicy>(++it, count - 1,
+            util::loop_n<execution::sequenced_policy>(++it, count - 1,
                 [&f, &result, &proj](FwdIter const& curr) -> void {
                     if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
                             hpx::util::invoke(proj, *result.first)))
@@ -524,7 +528,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<PairIter>::value_type result =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<execution::sequenced_policy>(++it, count - 1,
                     [&f, &result, &proj](PairIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *curr->first),
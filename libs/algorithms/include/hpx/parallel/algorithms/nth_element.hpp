@@ -0,0 +1,416 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_OCT_18_2019_0340PM)
+#define HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_OCT_18_2019_0340PM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/stable_sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Number of elements sampled to select the splitters, the splitters
+        // are chosen nth_element_sample_distance samples away from the
+        // estimated position of the nth element.
+        static const std::size_t nth_element_sample_size = 1024ul;
+        static const std::size_t nth_element_sample_distance = 32ul;
+
+        // Number of elements in each of the three parts of a chunk.
+        struct nth_element_counts
+        {
+            std::size_t less_ = 0;
+            std::size_t middle_ = 0;
+            std::size_t greater_ = 0;
+        };
+
+        //------------------------------------------------------------------------
+        //  function : nth_element_thread
+        /// \brief Select two splitters from a sample of the input which most
+        ///        likely enclose the nth element and partition the input
+        ///        into three parts (less than the lower splitter, between
+        ///        both, greater than the upper splitter) in parallel. The
+        ///        selection continues in the part holding the nth element
+        ///        until that part is small enough to be handled sequentially.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        RandomIt nth_element_thread(ExPolicy policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare comp, std::size_t chunk_size)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            RandomIt const end = last;
+
+            std::vector<value_type> buffer;
+            std::vector<std::uint8_t> parts;
+            std::vector<hpx::future<void>> futures;
+
+            bool done = false;
+            while (!done && std::size_t(last - first) > chunk_size)
+            {
+                std::size_t count = last - first;
+                std::size_t rank = nth - first;
+
+                // select the splitters from an evenly spaced sample
+                std::vector<value_type> sample;
+                sample.reserve(nth_element_sample_size);
+                for (std::size_t i = 0; i != nth_element_sample_size; ++i)
+                {
+                    sample.push_back(
+                        *(first + i * count / nth_element_sample_size));
+                }
+                std::sort(sample.begin(), sample.end(), comp);
+
+                std::size_t pos = rank * nth_element_sample_size / count;
+                value_type const& lower = sample[pos >
+                            nth_element_sample_distance ?
+                        pos - nth_element_sample_distance :
+                        0];
+                value_type const& upper = sample[(std::min)(
+                    pos + nth_element_sample_distance,
+                    nth_element_sample_size - 1)];
+
+                // classify the elements and count them per chunk
+                std::size_t num_chunks = (count + chunk_size - 1) / chunk_size;
+                std::vector<nth_element_counts> counts(num_chunks);
+                parts.resize(count);
+
+                futures.clear();
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    std::size_t base = chunk * chunk_size;
+                    std::size_t size = (std::min)(count - base, chunk_size);
+                    nth_element_counts* c = &counts[chunk];
+                    std::uint8_t* p = parts.data() + base;
+                    RandomIt it = first + base;
+
+                    futures.push_back(
+                        execution::async_execute(policy.executor(),
+                            [=, &lower, &upper, &comp]() mutable -> void {
+                                nth_element_counts local;
+                                for (std::size_t i = 0; i != size; ++i, ++it)
+                                {
+                                    if (comp(*it, lower))
+                                    {
+                                        p[i] = 0;
+                                        ++local.less_;
+                                    }
+                                    else if (comp(upper, *it))
+                                    {
+                                        p[i] = 2;
+                                        ++local.greater_;
+                                    }
+                                    else
+                                    {
+                                        p[i] = 1;
+                                        ++local.middle_;
+                                    }
+                                }
+                                *c = local;
+                            }));
+                }
+                wait_for_sort_tasks<ExPolicy>(futures);
+
+                // compute the start offset of each part of each chunk
+                nth_element_counts total;
+                for (nth_element_counts const& c : counts)
+                {
+                    total.less_ += c.less_;
+                    total.middle_ += c.middle_;
+                }
+
+                nth_element_counts offset;
+                offset.middle_ = total.less_;
+                offset.greater_ = total.less_ + total.middle_;
+                for (nth_element_counts& c : counts)
+                {
+                    nth_element_counts next = offset;
+                    next.less_ += c.less_;
+                    next.middle_ += c.middle_;
+                    next.greater_ += c.greater_;
+                    c = offset;
+                    offset = next;
+                }
+
+                // move the elements to their part in the buffer and back
+                if (buffer.size() < count)
+                    buffer.resize(count);
+
+                futures.clear();
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    std::size_t base = chunk * chunk_size;
+                    std::size_t size = (std::min)(count - base, chunk_size);
+                    nth_element_counts c = counts[chunk];
+                    std::uint8_t const* p = parts.data() + base;
+                    RandomIt it = first + base;
+                    auto dest = buffer.begin();
+
+                    futures.push_back(execution::async_execute(
+                        policy.executor(), [=]() mutable -> void {
+                            for (std::size_t i = 0; i != size; ++i, ++it)
+                            {
+                                std::size_t& target = p[i] == 0 ?
+                                    c.less_ :
+                                    (p[i] == 1 ? c.middle_ : c.greater_);
+                                dest[target++] = std::move(*it);
+                            }
+                        }));
+                }
+                wait_for_sort_tasks<ExPolicy>(futures);
+
+                futures.clear();
+                for (std::size_t base = 0; base < count; base += chunk_size)
+                {
+                    auto src_first = buffer.begin() + base;
+                    auto src_last =
+                        buffer.begin() + (std::min)(count, base + chunk_size);
+                    RandomIt dest = first + base;
+
+                    futures.push_back(
+                        execution::async_execute(policy.executor(),
+                            [src_first, src_last, dest]() -> void {
+                                std::move(src_first, src_last, dest);
+                            }));
+                }
+                wait_for_sort_tasks<ExPolicy>(futures);
+
+                // continue with the part holding the nth element
+                if (rank < total.less_)
+                {
+                    last = first + total.less_;
+                }
+                else if (rank >= total.less_ + total.middle_)
+                {
+                    first += total.less_ + total.middle_;
+                }
+                else if (!comp(lower, upper))
+                {
+                    // all elements in the middle part are equivalent
+                    done = true;
+                }
+                else if (total.middle_ == count)
+                {
+                    // no progress was made, finish sequentially
+                    break;
+                }
+                else
+                {
+                    last = first + (total.less_ + total.middle_);
+                    first += total.less_;
+                }
+            }
+
+            if (!done)
+                std::nth_element(first, nth, last, comp);
+
+            return end;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_nth_element_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> parallel_nth_element_async(ExPolicy&& policy,
+            RandomIt first, RandomIt nth, RandomIt last, Compare comp)
+        {
+            std::ptrdiff_t N = last - first;
+            HPX_ASSERT(N >= 0);
+
+            if (nth == last)
+                return hpx::make_ready_future(last);
+
+            // figure out the chunk size to use
+            std::size_t chunk_size = sort_chunk_size(policy, std::size_t(N));
+
+            if (std::size_t(N) <= chunk_size)
+            {
+                std::nth_element(first, nth, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            return execution::async_execute(policy.executor(),
+                &nth_element_thread<typename std::decay<ExPolicy>::type,
+                    RandomIt, Compare>,
+                std::forward<ExPolicy>(policy), first, nth, last, comp,
+                chunk_size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // nth_element
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, RandomIt>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                if (nth != last)
+                {
+                    std::nth_element(first, nth, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(parallel_nth_element_async(
+                        std::forward<ExPolicy>(policy), first, nth, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed at by \a nth is changed to whatever element would occur
+    /// in that position if [first, last) were sorted. All of the elements
+    /// before this new \a nth element are less than or equal to the elements
+    /// after the new \a nth element. The function uses the given comparison
+    /// function object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(N) on average, where
+    ///                     N = std::distance(first, last) applications of
+    ///                     the predicate \a comp and the projection \a proj.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which should end up at its
+    ///                     sorted position.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel versions of this algorithm require the value type of the
+    /// sequence to be default constructible and copyable as they use a
+    /// temporary buffer of the size of the input sequence.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt>::value&&
+                    traits::is_projected<Proj, RandomIt>::value&&
+                        traits::is_indirect_callable<ExPolicy, Compare,
+                            traits::projected<Proj, RandomIt>,
+                            traits::projected<Proj, RandomIt>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    nth_element(ExPolicy&& policy, RandomIt first, RandomIt nth, RandomIt last,
+        Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::nth_element<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
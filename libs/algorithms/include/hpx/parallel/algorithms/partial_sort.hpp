@@ -0,0 +1,514 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_OCT_18_2019_0455PM)
+#define HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_OCT_18_2019_0455PM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/stable_sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        //------------------------------------------------------------------------
+        //  function : partial_sort_thread
+        /// \brief Move the smallest elements to the front using a parallel
+        ///        nth_element and sort those in parallel afterwards.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        RandomIt partial_sort_thread(ExPolicy policy, RandomIt first,
+            RandomIt middle, RandomIt last, Compare comp,
+            std::size_t chunk_size)
+        {
+            if (middle == first)
+                return last;
+
+            if (middle != last)
+            {
+                nth_element_thread(
+                    policy, first, middle, last, comp, chunk_size);
+            }
+
+            if (std::size_t(middle - first) <= chunk_size)
+            {
+                std::sort(first, middle, comp);
+            }
+            else if (!detail::is_sorted_sequential(first, middle, comp))
+            {
+                sort_thread(policy, first, middle, comp, chunk_size).get();
+            }
+            return last;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_partial_sort_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> parallel_partial_sort_async(ExPolicy&& policy,
+            RandomIt first, RandomIt middle, RandomIt last, Compare comp)
+        {
+            std::ptrdiff_t N = last - first;
+            HPX_ASSERT(N >= 0);
+
+            // figure out the chunk size to use
+            std::size_t chunk_size = sort_chunk_size(policy, std::size_t(N));
+
+            if (std::size_t(N) <= chunk_size)
+            {
+                std::partial_sort(first, middle, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            return execution::async_execute(policy.executor(),
+                &partial_sort_thread<typename std::decay<ExPolicy>::type,
+                    RandomIt, Compare>,
+                std::forward<ExPolicy>(policy), first, middle, last, comp,
+                chunk_size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // partial_sort
+        template <typename RandomIt>
+        struct partial_sort
+          : public detail::algorithm<partial_sort<RandomIt>, RandomIt>
+        {
+            partial_sort()
+              : partial_sort::algorithm("partial_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first,
+                RandomIt middle, RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                std::partial_sort(first, middle, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(parallel_partial_sort_async(
+                        std::forward<ExPolicy>(policy), first, middle, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges elements such that the range [first, middle) contains the
+    /// sorted middle - first smallest elements in the range [first, last).
+    /// The order of equal elements is not guaranteed to be preserved. The
+    /// order of the remaining elements in the range [middle, last) is
+    /// unspecified. The function uses the given comparison function object
+    /// comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: Approximately (last - first) * log(middle - first)
+    ///                     comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param middle       Refers to the end of the range which will hold the
+    ///                     sorted elements.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel versions of this algorithm require the value type of the
+    /// sequence to be default constructible and copyable (see
+    /// \a nth_element).
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt>::value&&
+                    traits::is_projected<Proj, RandomIt>::value&&
+                        traits::is_indirect_callable<ExPolicy, Compare,
+                            traits::projected<Proj, RandomIt>,
+                            traits::projected<Proj, RandomIt>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort(ExPolicy&& policy, RandomIt first, RandomIt middle,
+        RandomIt last, Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, middle, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        //------------------------------------------------------------------------
+        //  function : partial_sort_copy_thread
+        /// \brief Each chunk of the input contributes its smallest elements
+        ///        to a candidate buffer, the smallest of those are selected
+        ///        and sorted using partial_sort_thread.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt1, typename RandomIt2,
+            typename Compare>
+        RandomIt2 partial_sort_copy_thread(ExPolicy policy, RandomIt1 first,
+            RandomIt1 last, RandomIt2 d_first, RandomIt2 d_last, Compare comp,
+            std::size_t chunk_size)
+        {
+            typedef typename std::iterator_traits<RandomIt1>::value_type
+                value_type;
+
+            std::size_t count = last - first;
+            std::size_t result_size =
+                (std::min)(count, std::size_t(d_last - d_first));
+
+            // collect the candidates of all chunks
+            std::vector<std::size_t> bounds;
+            bounds.reserve(count / chunk_size + 2);
+
+            std::size_t num_candidates = 0;
+            for (std::size_t base = 0; base < count; base += chunk_size)
+            {
+                bounds.push_back(num_candidates);
+                num_candidates += (std::min)(
+                    result_size, (std::min)(count - base, chunk_size));
+            }
+            bounds.push_back(num_candidates);
+
+            std::vector<value_type> candidates(num_candidates);
+
+            std::vector<hpx::future<void>> futures;
+            futures.reserve(bounds.size());
+
+            for (std::size_t i = 0; i + 1 < bounds.size(); ++i)
+            {
+                std::size_t base = i * chunk_size;
+                RandomIt1 chunk_first = first + base;
+                RandomIt1 chunk_last =
+                    first + (std::min)(count, base + chunk_size);
+                auto dest_first = candidates.begin() + bounds[i];
+                auto dest_last = candidates.begin() + bounds[i + 1];
+
+                futures.push_back(execution::async_execute(policy.executor(),
+                    [=]() -> void {
+                        if (dest_last - dest_first < chunk_last - chunk_first)
+                        {
+                            std::partial_sort_copy(chunk_first, chunk_last,
+                                dest_first, dest_last, comp);
+                        }
+                        else
+                        {
+                            std::copy(chunk_first, chunk_last, dest_first);
+                        }
+                    }));
+            }
+            wait_for_sort_tasks<ExPolicy>(futures);
+
+            // select and sort the smallest candidates
+            partial_sort_thread(policy, candidates.begin(),
+                candidates.begin() + result_size, candidates.end(), comp,
+                chunk_size);
+
+            // copy the result to the destination
+            futures.clear();
+            for (std::size_t base = 0; base < result_size; base += chunk_size)
+            {
+                auto src_first = candidates.begin() + base;
+                auto src_last = candidates.begin() +
+                    (std::min)(result_size, base + chunk_size);
+                RandomIt2 dest = d_first + base;
+
+                futures.push_back(execution::async_execute(policy.executor(),
+                    [src_first, src_last, dest]() -> void {
+                        std::move(src_first, src_last, dest);
+                    }));
+            }
+            wait_for_sort_tasks<ExPolicy>(futures);
+
+            return d_first + result_size;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_partial_sort_copy_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt1, typename RandomIt2,
+            typename Compare>
+        hpx::future<RandomIt2> parallel_partial_sort_copy_async(
+            ExPolicy&& policy, RandomIt1 first, RandomIt1 last,
+            RandomIt2 d_first, RandomIt2 d_last, Compare comp)
+        {
+            std::ptrdiff_t N = last - first;
+            HPX_ASSERT(N >= 0);
+
+            // figure out the chunk size to use
+            std::size_t chunk_size = sort_chunk_size(policy, std::size_t(N));
+
+            if (std::size_t(N) <= chunk_size || d_first == d_last)
+            {
+                return hpx::make_ready_future(std::partial_sort_copy(
+                    first, last, d_first, d_last, comp));
+            }
+
+            return execution::async_execute(policy.executor(),
+                &partial_sort_copy_thread<typename std::decay<ExPolicy>::type,
+                    RandomIt1, RandomIt2, Compare>,
+                std::forward<ExPolicy>(policy), first, last, d_first, d_last,
+                comp, chunk_size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // partial_sort_copy
+        template <typename RandomIt>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<RandomIt>, RandomIt>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Compare,
+                typename Proj>
+            static RandomIt sequential(ExPolicy, InIter first, InIter last,
+                RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj)
+            {
+                return std::partial_sort_copy(first, last, d_first, d_last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+            }
+
+            template <typename ExPolicy, typename InIter, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, InIter first, InIter last,
+                RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(
+                        parallel_partial_sort_copy_async(
+                            std::forward<ExPolicy>(policy), first, last,
+                            d_first, d_last,
+                            util::compare_projected<Compare, Proj>(
+                                std::forward<Compare>(comp),
+                                std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal elements
+    /// is not guaranteed to be preserved. The function uses the given
+    /// comparison function object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(min(D,N))), where
+    ///                     N = std::distance(first, last) and
+    ///                     D = std::distance(d_first, d_last) comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt1   The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandomIt2   The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel versions of this algorithm require the value type of the
+    /// source sequence to be default constructible and copyable as they use
+    /// a temporary buffer holding the candidates for the result.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandomIt2> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt2
+    ///           otherwise.
+    ///           The algorithm returns an iterator to the element defining
+    ///           the upper boundary of the sorted range i.e.
+    ///           d_first + min(last - first, d_last - d_first).
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt1, typename RandomIt2,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt1>::value&&
+                    hpx::traits::is_iterator<RandomIt2>::value&&
+                        traits::is_projected<Proj, RandomIt1>::value&&
+                            traits::is_indirect_callable<ExPolicy, Compare,
+                                traits::projected<Proj, RandomIt1>,
+                                traits::projected<Proj, RandomIt1>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt2>::type
+    partial_sort_copy(ExPolicy&& policy, RandomIt1 first, RandomIt1 last,
+        RandomIt2 d_first, RandomIt2 d_last, Compare&& comp = Compare(),
+        Proj&& proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt1>::value),
+            "Requires a random access iterator.");
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt2>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort_copy<RandomIt2>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last, d_first,
+            d_last, std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -16,10 +16,12 @@
 #include <hpx/dataflow.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/type_support/decay.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/exception_list.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/executors/execution.hpp>
@@ -163,6 +165,28 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::move(left), std::move(right));
         }
 
+        // Determine the number of elements to be handled by one task, this
+        // is never less than sort_limit_per_task.
+        template <typename ExPolicy>
+        std::size_t sort_chunk_size(ExPolicy const& policy, std::size_t count)
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+
+            std::size_t max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(), [] { return 0; }, cores,
+                count);
+
+            util::detail::adjust_chunk_size_and_max_chunks(
+                cores, count, max_chunks, chunk_size);
+
+            // we should not get smaller than our sort_limit_per_task
+            return (std::max)(chunk_size, sort_limit_per_task);
+        }
+
         //------------------------------------------------------------------------
         //  function : parallel_sort_async
         //------------------------------------------------------------------------
@@ -180,21 +204,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             std::size_t count = last - first;
 
             // figure out the chunk size to use
-            std::size_t const cores = execution::processing_units_count(
-                policy.executor(), policy.parameters());
-
-            std::size_t max_chunks = execution::maximal_number_of_chunks(
-                policy.parameters(), policy.executor(), cores, count);
-
-            std::size_t chunk_size = execution::get_chunk_size(
-                policy.parameters(), policy.executor(), [] { return 0; }, cores,
-                count);
-
-            util::detail::adjust_chunk_size_and_max_chunks(
-                cores, count, max_chunks, chunk_size);
-
-            // we should not get smaller than our sort_limit_per_task
-            chunk_size = (std::max)(chunk_size, sort_limit_per_task);
+            std::size_t chunk_size = sort_chunk_size(policy, count);
 
             std::ptrdiff_t N = last - first;
             HPX_ASSERT(N >= 0);
@@ -215,6 +225,58 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::forward<ExPolicy>(policy), first, last, comp, chunk_size);
         }
 
+        //------------------------------------------------------------------------
+        //  function : parallel_radix_sort_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Proj>
+        hpx::future<RandomIt> parallel_radix_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last, Proj proj)
+        {
+            // number of elements to sort
+            std::size_t count = last - first;
+
+            // figure out the chunk size to use
+            std::size_t chunk_size = sort_chunk_size(policy, count);
+
+            if (count < chunk_size)
+            {
+                std::sort(first, last,
+                    util::compare_projected<detail::less, Proj>(
+                        detail::less(), proj));
+                return hpx::make_ready_future(last);
+            }
+
+            return execution::async_execute(policy.executor(),
+                &radix_sort_thread<typename std::decay<ExPolicy>::type,
+                    RandomIt, Proj>,
+                std::forward<ExPolicy>(policy), first, last, proj, chunk_size);
+        }
+
+        // Arithmetic keys compared using operator<() are sorted using a radix
+        // sort, everything else is handled by the comparison based sort.
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<RandomIt> parallel_sort_dispatch(std::false_type,
+            ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj)
+        {
+            return parallel_sort_async(std::forward<ExPolicy>(policy), first,
+                last,
+                util::compare_projected<Compare, Proj>(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj)));
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<RandomIt> parallel_sort_dispatch(std::true_type,
+            ExPolicy&& policy, RandomIt first, RandomIt last, Compare&&,
+            Proj&& proj)
+        {
+            return parallel_radix_sort_async(std::forward<ExPolicy>(policy),
+                first, last,
+                typename std::decay<Proj>::type(std::forward<Proj>(proj)));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -248,11 +310,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 {
                     // call the sort routine and return the right type,
                     // depending on execution policy
-                    return algorithm_result::get(parallel_sort_async(
+                    return algorithm_result::get(parallel_sort_dispatch(
+                        is_radix_sortable<RandomIt, Compare, Proj>(),
                         std::forward<ExPolicy>(policy), first, last,
-                        util::compare_projected<Compare, Proj>(
-                            std::forward<Compare>(comp),
-                            std::forward<Proj>(proj))));
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)));
                 }
                 catch (...)
                 {
@@ -262,6 +324,26 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
             }
         };
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return sort<RandomIt>().call(std::forward<ExPolicy>(policy),
+                is_seq(), first, last, std::forward<Compare>(comp),
+                std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        sort_(ExPolicy&& policy, SegIter first, SegIter last, Compare&& comp,
+            Proj&& proj, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -312,6 +394,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// The parallel versions of this algorithm sort arithmetic elements which
+    /// are compared using the default comparison or \a std::less with a
+    /// radix sort.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
@@ -348,11 +434,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
         static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
             "Requires a random access iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<RandomIt> is_segmented;
 
-        return detail::sort<RandomIt>().call(std::forward<ExPolicy>(policy),
-            is_seq(), first, last, std::forward<Compare>(comp),
-            std::forward<Proj>(proj));
+        return detail::sort_(std::forward<ExPolicy>(policy), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj),
+            is_segmented());
     }
 }}}    // namespace hpx::parallel::v1
 
@@ -89,6 +89,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// The parallel versions of this algorithm sort arithmetic keys which
+    /// are compared using the default comparison or \a std::less with a
+    /// radix sort.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
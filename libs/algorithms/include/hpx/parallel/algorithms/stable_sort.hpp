@@ -0,0 +1,445 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stable_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_STABLE_SORT_OCT_18_2019_0215PM)
+#define HPX_PARALLEL_ALGORITHM_STABLE_SORT_OCT_18_2019_0215PM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/lcos/wait_all.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Wait for all given futures and rethrow any exceptions as an
+        // exception_list.
+        template <typename ExPolicy>
+        void wait_for_sort_tasks(std::vector<hpx::future<void>>& futures)
+        {
+            hpx::wait_all(futures);
+
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                futures, errors);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Merge the sorted ranges [first1, last1) and [first2, last2) into
+        // dest by moving the elements. Elements from the first range precede
+        // equivalent elements from the second range.
+        template <typename Iter1, typename Iter2, typename Compare>
+        Iter2 sequential_move_merge(Iter1 first1, Iter1 last1, Iter1 first2,
+            Iter1 last2, Iter2 dest, Compare& comp)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                if (comp(*first2, *first1))
+                {
+                    *dest = std::move(*first2);
+                    ++first2;
+                }
+                else
+                {
+                    *dest = std::move(*first1);
+                    ++first1;
+                }
+                ++dest;
+            }
+            dest = std::move(first1, last1, dest);
+            return std::move(first2, last2, dest);
+        }
+
+        // Parallel version of sequential_move_merge. The larger of both ranges
+        // is split in the middle, the split position in the other range is
+        // chosen such that equivalent elements keep their relative order.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Compare>
+        void parallel_move_merge(ExPolicy policy, Iter1 first1, Iter1 last1,
+            Iter1 first2, Iter1 last2, Iter2 dest, Compare comp)
+        {
+            std::size_t size1 = last1 - first1;
+            std::size_t size2 = last2 - first2;
+
+            if (size1 + size2 <= sort_limit_per_task)
+            {
+                sequential_move_merge(first1, last1, first2, last2, dest, comp);
+                return;
+            }
+
+            Iter1 mid1, mid2;
+            if (size1 >= size2)
+            {
+                mid1 = first1 + size1 / 2;
+                mid2 = std::lower_bound(first2, last2, *mid1, comp);
+            }
+            else
+            {
+                mid2 = first2 + size2 / 2;
+                mid1 = std::upper_bound(first1, last1, *mid2, comp);
+            }
+            Iter2 dest_mid = dest + (mid1 - first1) + (mid2 - first2);
+
+            hpx::future<void> fut =
+                execution::async_execute(policy.executor(), [&]() -> void {
+                    parallel_move_merge(
+                        policy, first1, mid1, first2, mid2, dest, comp);
+                });
+
+            try
+            {
+                parallel_move_merge(
+                    policy, mid1, last1, mid2, last2, dest_mid, comp);
+            }
+            catch (...)
+            {
+                fut.wait();
+
+                std::vector<hpx::future<void>> futures(2);
+                futures[0] = std::move(fut);
+                futures[1] = hpx::make_exceptional_future<void>(
+                    std::current_exception());
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    futures, errors);
+
+                // Not reachable.
+                HPX_ASSERT(false);
+                return;
+            }
+
+            fut.get();
+        }
+
+        // Merge neighboring pairs of the sorted runs delimited by bounds
+        // from src to dest, returns the bounds of the merged runs.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Compare>
+        std::vector<std::size_t> merge_sorted_runs(ExPolicy const& policy,
+            Iter1 src, Iter2 dest, std::vector<std::size_t> const& bounds,
+            Compare const& comp)
+        {
+            std::vector<std::size_t> merged_bounds;
+            merged_bounds.reserve(bounds.size() / 2 + 2);
+
+            std::vector<hpx::future<void>> futures;
+            futures.reserve(bounds.size() / 2 + 1);
+
+            std::size_t i = 0;
+            for (/**/; i + 2 < bounds.size(); i += 2)
+            {
+                Iter1 first1 = src + bounds[i];
+                Iter1 first2 = src + bounds[i + 1];
+                Iter1 last2 = src + bounds[i + 2];
+                Iter2 d = dest + bounds[i];
+
+                futures.push_back(execution::async_execute(policy.executor(),
+                    [=]() -> void {
+                        parallel_move_merge(
+                            policy, first1, first2, first2, last2, d, comp);
+                    }));
+                merged_bounds.push_back(bounds[i]);
+            }
+
+            // move a possibly remaining run
+            if (i + 1 < bounds.size())
+            {
+                Iter1 first = src + bounds[i];
+                Iter1 last = src + bounds[i + 1];
+                Iter2 d = dest + bounds[i];
+
+                futures.push_back(execution::async_execute(policy.executor(),
+                    [=]() -> void { std::move(first, last, d); }));
+                merged_bounds.push_back(bounds[i]);
+            }
+            merged_bounds.push_back(bounds.back());
+
+            wait_for_sort_tasks<ExPolicy>(futures);
+            return merged_bounds;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : stable_sort_thread
+        /// \brief Sort chunks of the input in parallel and merge the sorted
+        ///        runs pairwise (each merge is parallelized as well) while
+        ///        moving the elements back and forth between the input range
+        ///        and a temporary buffer.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        RandomIt stable_sort_thread(ExPolicy policy, RandomIt first,
+            RandomIt last, Compare comp, std::size_t chunk_size)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            std::size_t count = last - first;
+
+            // sort the chunks
+            std::vector<std::size_t> bounds;
+            bounds.reserve(count / chunk_size + 2);
+
+            std::vector<hpx::future<void>> futures;
+            futures.reserve(count / chunk_size + 1);
+
+            for (std::size_t base = 0; base < count; base += chunk_size)
+            {
+                RandomIt chunk_first = first + base;
+                RandomIt chunk_last =
+                    first + (std::min)(count, base + chunk_size);
+
+                futures.push_back(execution::async_execute(policy.executor(),
+                    [chunk_first, chunk_last, comp]() -> void {
+                        std::stable_sort(chunk_first, chunk_last, comp);
+                    }));
+                bounds.push_back(base);
+            }
+            bounds.push_back(count);
+
+            wait_for_sort_tasks<ExPolicy>(futures);
+
+            // merge the sorted runs
+            std::vector<value_type> buffer(count);
+            bool in_buffer = false;
+
+            while (bounds.size() > 2)
+            {
+                if (in_buffer)
+                {
+                    bounds = merge_sorted_runs(
+                        policy, buffer.begin(), first, bounds, comp);
+                }
+                else
+                {
+                    bounds = merge_sorted_runs(
+                        policy, first, buffer.begin(), bounds, comp);
+                }
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                futures.clear();
+                for (std::size_t base = 0; base < count; base += chunk_size)
+                {
+                    auto chunk_first = buffer.begin() + base;
+                    auto chunk_last =
+                        buffer.begin() + (std::min)(count, base + chunk_size);
+                    RandomIt dest = first + base;
+
+                    futures.push_back(
+                        execution::async_execute(policy.executor(),
+                            [chunk_first, chunk_last, dest]() -> void {
+                                std::move(chunk_first, chunk_last, dest);
+                            }));
+                }
+
+                wait_for_sort_tasks<ExPolicy>(futures);
+            }
+
+            return last;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_stable_sort_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> parallel_stable_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last, Compare comp)
+        {
+            std::ptrdiff_t N = last - first;
+            HPX_ASSERT(N >= 0);
+
+            // figure out the chunk size to use
+            std::size_t chunk_size = sort_chunk_size(policy, std::size_t(N));
+
+            if (std::size_t(N) <= chunk_size)
+            {
+                std::stable_sort(first, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            // check if already sorted
+            if (detail::is_sorted_sequential(first, last, comp))
+                return hpx::make_ready_future(last);
+
+            return execution::async_execute(policy.executor(),
+                &stable_sort_thread<typename std::decay<ExPolicy>::type,
+                    RandomIt, Compare>,
+                std::forward<ExPolicy>(policy), first, last, comp, chunk_size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // stable_sort
+        template <typename RandomIt>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandomIt>, RandomIt>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(parallel_stable_sort_async(
+                        std::forward<ExPolicy>(policy), first, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// relative order of equal elements is preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// A sequence is sorted with respect to a comparator \a comp and a
+    /// projection \a proj if for every iterator i pointing to the sequence and
+    /// every non-negative integer n such that i + n is a valid iterator
+    /// pointing to an element of the sequence, and
+    /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel versions of this algorithm require the value type of the
+    /// sequence to be default constructible as they use a temporary buffer
+    /// of the size of the input sequence.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt>::value&&
+                    traits::is_projected<Proj, RandomIt>::value&&
+                        traits::is_indirect_callable<ExPolicy, Compare,
+                            traits::projected<Proj, RandomIt>,
+                            traits::projected<Proj, RandomIt>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    stable_sort(ExPolicy&& policy, RandomIt first, RandomIt last,
+        Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
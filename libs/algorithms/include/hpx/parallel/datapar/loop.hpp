@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_DATAPAR)
+#include <hpx/functional/invoke.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/datapar/execution_policy_fwd.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
@@ -215,6 +216,12 @@ namespace hpx { namespace parallel { namespace util {
         template <typename Iter1, typename Iter2>
         struct loop2;
 
+        template <typename Iterator>
+        struct loop_n;
+
+        template <typename IterCat>
+        struct loop_idx_n;
+
         template <typename Iter1, typename Iter2>
         struct datapar_loop2<std::false_type, Iter1, Iter2>
         {
@@ -277,6 +284,163 @@ namespace hpx { namespace parallel { namespace util {
                 }
                 return first;
             }
+
+            // The overloads taking a cancellation token are used by the
+            // algorithms which only inspect the elements. The function is
+            // invoked with a pointer to a loaded vector pack which is not
+            // written back to the sequence.
+            template <typename InIter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                iterator_datapar_compatible<InIter>::value, InIter>::type
+            call(InIter first, std::size_t count, CancelToken& tok, F&& f)
+            {
+                typedef typename traits::vector_pack_type<value_type, 1>::type
+                    V1;
+
+                static std::size_t HPX_CONSTEXPR_OR_CONST size =
+                    traits::vector_pack_size<V>::value;
+
+                for (/* */; detail::is_data_aligned(first) && count != 0;
+                     (void) --count, ++first)
+                {
+                    if (tok.was_cancelled())
+                        return first;
+
+                    V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(
+                        first));
+                    hpx::util::invoke(f, &tmp);
+                }
+
+                for (/* */; count >= size; count -= size)
+                {
+                    if (tok.was_cancelled())
+                        return first;
+
+                    V tmp(traits::vector_pack_load<V, value_type>::aligned(
+                        first));
+                    hpx::util::invoke(f, &tmp);
+                    std::advance(first, size);
+                }
+
+                for (/* */; count != 0; (void) --count, ++first)
+                {
+                    if (tok.was_cancelled())
+                        return first;
+
+                    V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(
+                        first));
+                    hpx::util::invoke(f, &tmp);
+                }
+
+                return first;
+            }
+
+            template <typename InIter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                !iterator_datapar_compatible<InIter>::value, InIter>::type
+            call(InIter first, std::size_t count, CancelToken& tok, F&& f)
+            {
+                return util::detail::loop_n<InIter>::call(
+                    first, count, tok, std::forward<F>(f));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Helper class to repeatedly call a function with the elements
+        // starting at a given iterator position and their index. The
+        // function is invoked with vector packs of elements and the index of
+        // the first element of each pack, it is expected to cancel the token
+        // with the index of the element it is looking for (if any). The
+        // elements are not written back to the sequence.
+        template <typename Iterator>
+        struct datapar_loop_idx_n
+        {
+            typedef typename hpx::util::decay<Iterator>::type iterator_type;
+            typedef typename std::iterator_traits<iterator_type>::value_type
+                value_type;
+
+            typedef typename traits::vector_pack_type<value_type, 1>::type V1;
+            typedef typename traits::vector_pack_type<value_type>::type V;
+
+            template <typename Iter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                iterator_datapar_compatible<Iter>::value, Iter>::type
+            call(std::size_t base_idx, Iter it, std::size_t count,
+                CancelToken& tok, F&& f)
+            {
+                static std::size_t HPX_CONSTEXPR_OR_CONST size =
+                    traits::vector_pack_size<V>::value;
+
+                // handle the leading elements one by one until the data is
+                // aligned, zipped sequences may never be aligned at the same
+                // time (think of adjacent_find), those are handled using
+                // unaligned loads
+                for (std::size_t peel = 0; peel != size && count != 0 &&
+                     detail::is_data_aligned(it);
+                     (void) ++peel, --count, ++it, ++base_idx)
+                {
+                    if (tok.was_cancelled(base_idx))
+                        return it;
+
+                    V1 tmp(
+                        traits::vector_pack_load<V1, value_type>::unaligned(it));
+                    hpx::util::invoke(f, tmp, base_idx);
+                }
+
+                if (detail::is_data_aligned(it))
+                {
+                    for (/* */; count >= size;
+                         (void) (count -= size), base_idx += size)
+                    {
+                        if (tok.was_cancelled(base_idx))
+                            return it;
+
+                        V tmp(traits::vector_pack_load<V,
+                            value_type>::unaligned(it));
+                        hpx::util::invoke(f, tmp, base_idx);
+                        std::advance(it, size);
+                    }
+                }
+                else
+                {
+                    for (/* */; count >= size;
+                         (void) (count -= size), base_idx += size)
+                    {
+                        if (tok.was_cancelled(base_idx))
+                            return it;
+
+                        V tmp(
+                            traits::vector_pack_load<V, value_type>::aligned(
+                                it));
+                        hpx::util::invoke(f, tmp, base_idx);
+                        std::advance(it, size);
+                    }
+                }
+
+                for (/* */; count != 0; (void) --count, ++it, ++base_idx)
+                {
+                    if (tok.was_cancelled(base_idx))
+                        return it;
+
+                    V1 tmp(
+                        traits::vector_pack_load<V1, value_type>::unaligned(it));
+                    hpx::util::invoke(f, tmp, base_idx);
+                }
+
+                return it;
+            }
+
+            template <typename Iter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                !iterator_datapar_compatible<Iter>::value, Iter>::type
+            call(std::size_t base_idx, Iter it, std::size_t count,
+                CancelToken& tok, F&& f)
+            {
+                typedef typename std::iterator_traits<Iter>::iterator_category
+                    category;
+                return util::detail::loop_idx_n<category>::call(
+                    base_idx, it, count, tok, std::forward<F>(f));
+            }
         };
     }    // namespace detail
 
@@ -352,6 +516,28 @@ namespace hpx { namespace parallel { namespace util {
         return detail::datapar_loop_n<Iter>::call(
             it, count, std::forward<F>(f));
     }
+
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        execution::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
+    loop_n(Iter it, std::size_t count, CancelToken& tok, F&& f)
+    {
+        return detail::datapar_loop_n<Iter>::call(
+            it, count, tok, std::forward<F>(f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        execution::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
+    loop_idx_n(std::size_t base_idx, Iter it, std::size_t count,
+        CancelToken& tok, F&& f)
+    {
+        return detail::datapar_loop_idx_n<Iter>::call(
+            base_idx, it, count, tok, std::forward<F>(f));
+    }
 }}}    // namespace hpx::parallel::util
 
 #endif
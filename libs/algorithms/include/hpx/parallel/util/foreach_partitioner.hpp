@@ -13,7 +13,13 @@
 #endif
 #include <hpx/assertion.hpp>
 #include <hpx/errors.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/lcos/future.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/threads/register_thread.hpp>
+#include <hpx/runtime/threads/thread_pool_base.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
@@ -28,9 +34,12 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -64,6 +73,156 @@ namespace hpx { namespace parallel { namespace util {
             return std::make_pair(std::move(inititems), std::move(workitems));
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Lazy binary splitting is used if the executor parameters ask for it
+        // and the iterations do not produce any intermediate results.
+        template <typename ExPolicy, typename Result>
+        struct is_lazy_splitting
+          : std::integral_constant<bool,
+                std::is_void<Result>::value &&
+                    execution::extract_has_lazy_splitting<
+                        typename std::decay<ExPolicy>::type::
+                            executor_parameters_type>::type::value>
+        {
+        };
+
+        // Shared between all tasks working on the same range: each task runs
+        // blocks of 'grain' iterations and splits off the second half of the
+        // remaining range into a new task whenever it finds the scheduler
+        // running out of work.
+        template <typename Executor, typename FwdIter, typename F>
+        struct lazy_splitting_state
+          : std::enable_shared_from_this<
+                lazy_splitting_state<Executor, FwdIter, F>>
+        {
+            using mutex_type = lcos::local::spinlock;
+
+            template <typename Executor_, typename F_>
+            lazy_splitting_state(Executor_&& exec, F_&& f, std::size_t grain)
+              : exec_(std::forward<Executor_>(exec))
+              , f_(std::forward<F_>(f))
+              , grain_(grain)
+              , pool_(threads::detail::get_self_or_default_pool())
+            {
+                HPX_ASSERT(grain_ != 0);
+            }
+
+            // Fewer tasks are waiting to be run than there are cores, i.e.
+            // some of the cores are about to go idle.
+            bool has_idle_workers() const
+            {
+                return pool_->get_queue_length(std::size_t(-1), false) <
+                    std::int64_t(pool_->get_os_thread_count());
+            }
+
+            void run(FwdIter first, std::size_t count, std::size_t base_idx)
+            {
+                while (count > grain_)
+                {
+                    if (count >= 2 * grain_ && has_idle_workers())
+                    {
+                        std::size_t const half = count / 2;
+                        spawn(parallel::v1::detail::next(first, half),
+                            count - half, base_idx + half);
+                        count = half;
+                        continue;
+                    }
+
+                    hpx::util::invoke(f_, first, grain_, base_idx);
+
+                    first = parallel::v1::detail::next(first, grain_);
+                    count -= grain_;
+                    base_idx += grain_;
+                }
+
+                if (count != 0)
+                    hpx::util::invoke(f_, first, count, base_idx);
+            }
+
+            // Wait for all spawned tasks, including the ones spawned while
+            // waiting. Every task stores the futures of its children before
+            // it finishes, so nothing new can show up once all futures seen
+            // so far have become ready.
+            void join(std::vector<hpx::future<void>>& workitems)
+            {
+                for (;;)
+                {
+                    std::vector<hpx::future<void>> spawned;
+                    {
+                        std::lock_guard<mutex_type> l(mtx_);
+                        std::swap(spawned, spawned_);
+                    }
+
+                    if (spawned.empty())
+                        break;
+
+                    hpx::wait_all(spawned);
+                    std::move(spawned.begin(), spawned.end(),
+                        std::back_inserter(workitems));
+                }
+            }
+
+        private:
+            void spawn(FwdIter first, std::size_t count, std::size_t base_idx)
+            {
+                auto this_ = this->shared_from_this();
+                hpx::future<void> f = execution::async_execute(exec_,
+                    [this_, first, count, base_idx]() {
+                        this_->run(first, count, base_idx);
+                    });
+
+                std::lock_guard<mutex_type> l(mtx_);
+                spawned_.push_back(std::move(f));
+            }
+
+            Executor exec_;
+            F f_;
+            std::size_t const grain_;
+            threads::thread_pool_base* pool_;
+
+            mutex_type mtx_;
+            std::vector<hpx::future<void>> spawned_;
+        };
+
+        // Run the whole range on the calling thread, handing parts of it to
+        // new tasks on demand, and return once all of those have finished.
+        template <typename ExPolicy, typename FwdIter, typename F>
+        std::vector<hpx::future<void>> foreach_lazy_partition(
+            ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
+        {
+            using executor_type =
+                typename std::decay<ExPolicy>::type::executor_type;
+            using state_type = lazy_splitting_state<executor_type, FwdIter,
+                typename std::decay<F>::type>;
+
+            std::size_t grain = policy.parameters().get_grain_size();
+            if (grain == 0)
+            {
+                std::size_t const cores = execution::processing_units_count(
+                    policy.executor(), policy.parameters());
+                grain = (std::max)(std::size_t(1), count / (64 * cores));
+            }
+
+            auto state = std::make_shared<state_type>(
+                policy.executor(), std::forward<F>(f), grain);
+
+            std::vector<hpx::future<void>> workitems;
+            try
+            {
+                state->run(first, count, 0);
+                workitems.push_back(hpx::make_ready_future());
+            }
+            catch (...)
+            {
+                workitems.push_back(
+                    hpx::make_exceptional_future<void>(std::current_exception()));
+            }
+
+            // the spawned tasks may still refer to the input range
+            state->join(workitems);
+            return workitems;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -95,10 +254,9 @@ namespace hpx { namespace parallel { namespace util {
                 std::list<std::exception_ptr> errors;
                 try
                 {
-                    std::tie(inititems, workitems) =
-                        detail::foreach_partition<Result>(
-                            std::forward<ExPolicy_>(policy), first, count,
-                            std::forward<F1>(f1));
+                    partition(is_lazy_splitting<ExPolicy_, Result>(),
+                        inititems, workitems, std::forward<ExPolicy_>(policy),
+                        first, count, std::forward<F1>(f1));
 
                     scoped_params.mark_end_of_scheduling();
                 }
@@ -112,6 +270,29 @@ namespace hpx { namespace parallel { namespace util {
             }
 
         private:
+            template <typename ExPolicy_, typename FwdIter, typename F>
+            static void partition(std::false_type,
+                std::vector<hpx::future<Result>>& inititems,
+                std::vector<hpx::future<Result>>& workitems,
+                ExPolicy_&& policy, FwdIter first, std::size_t count, F&& f)
+            {
+                std::tie(inititems, workitems) =
+                    detail::foreach_partition<Result>(
+                        std::forward<ExPolicy_>(policy), first, count,
+                        std::forward<F>(f));
+            }
+
+            template <typename ExPolicy_, typename FwdIter, typename F>
+            static void partition(std::true_type,
+                std::vector<hpx::future<Result>>&,
+                std::vector<hpx::future<Result>>& workitems,
+                ExPolicy_&& policy, FwdIter first, std::size_t count, F&& f)
+            {
+                workitems = detail::foreach_lazy_partition(
+                    std::forward<ExPolicy_>(policy), first, count,
+                    std::forward<F>(f));
+            }
+
             template <typename F, typename FwdIter>
             static FwdIter reduce(std::vector<hpx::future<Result>>&& inititems,
                 std::vector<hpx::future<Result>>&& workitems,
@@ -158,6 +339,38 @@ namespace hpx { namespace parallel { namespace util {
                 typename F2>
             static hpx::future<FwdIter> call(ExPolicy_&& policy, FwdIter first,
                 std::size_t count, F1&& f1, F2&& f2)
+            {
+                return call(is_lazy_splitting<ExPolicy_, Result>(),
+                    std::forward<ExPolicy_>(policy), first, count,
+                    std::forward<F1>(f1), std::forward<F2>(f2));
+            }
+
+        private:
+            // Lazy splitting runs the range on a single task which spawns
+            // more tasks on demand, run the synchronous partitioner there.
+            template <typename ExPolicy_, typename FwdIter, typename F1,
+                typename F2>
+            static hpx::future<FwdIter> call(std::true_type,
+                ExPolicy_&& policy, FwdIter first, std::size_t count, F1&& f1,
+                F2&& f2)
+            {
+                using policy_type = typename std::decay<ExPolicy_>::type;
+
+                return execution::async_execute(policy.executor(),
+                    [first, count, HPX_CAPTURE_FORWARD(policy),
+                        HPX_CAPTURE_FORWARD(f1),
+                        HPX_CAPTURE_FORWARD(f2)]() mutable -> FwdIter {
+                        return foreach_static_partitioner<policy_type,
+                            Result>::call(std::move(policy), first, count,
+                            std::move(f1), std::move(f2));
+                    });
+            }
+
+            template <typename ExPolicy_, typename FwdIter, typename F1,
+                typename F2>
+            static hpx::future<FwdIter> call(std::false_type,
+                ExPolicy_&& policy, FwdIter first, std::size_t count, F1&& f1,
+                F2&& f2)
             {
                 // inform parameter traits
                 std::shared_ptr<scoped_executor_parameters> scoped_params =
@@ -192,7 +405,6 @@ namespace hpx { namespace parallel { namespace util {
                     std::forward<F2>(f2), std::move(last));
             }
 
-        private:
             template <typename F, typename FwdIter>
             static hpx::future<FwdIter> reduce(
                 std::shared_ptr<scoped_executor_parameters>&& scoped_params,
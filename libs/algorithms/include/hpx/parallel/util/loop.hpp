@@ -15,6 +15,7 @@
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/functional/result_of.hpp>
+#include <hpx/parallel/traits/vector_pack_find.hpp>
 #include <hpx/parallel/util/cancellation_token.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/traits/is_execution_policy.hpp>
@@ -523,6 +524,91 @@ namespace hpx { namespace parallel { namespace util {
             base_idx, it, count, tok, std::forward<F>(f));
     }
 
+    // The execution policy aware version invokes the function with vector
+    // packs of elements for the vector-pack execution policies.
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename F>
+    HPX_FORCEINLINE typename std::enable_if<
+        !execution::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
+    loop_idx_n(std::size_t base_idx, Iter it, std::size_t count,
+        CancelToken& tok, F&& f)
+    {
+        typedef typename std::iterator_traits<Iter>::iterator_category cat;
+        return detail::loop_idx_n<cat>::call(
+            base_idx, it, count, tok, std::forward<F>(f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Invoke the predicate for an element (or a vector pack of elements)
+        // and cancel the token with the index of the first element the
+        // predicate holds for.
+        template <typename Pred, typename CancelToken>
+        struct find_first_iteration
+        {
+            Pred& pred_;
+            CancelToken& tok_;
+
+            template <typename T>
+            HPX_HOST_DEVICE HPX_FORCEINLINE void operator()(
+                T&& t, std::size_t base_idx)
+            {
+                int const idx = traits::find_first_set(
+                    hpx::util::invoke(pred_, std::forward<T>(t)));
+                if (idx != -1)
+                    tok_.cancel(base_idx + idx);
+            }
+        };
+
+        // Cancel the token if the predicate holds for the element (or any
+        // of the elements of the vector pack) referred to by the iterator.
+        template <typename Pred, typename CancelToken>
+        struct find_any_iteration
+        {
+            Pred& pred_;
+            CancelToken& tok_;
+
+            template <typename Iter>
+            HPX_HOST_DEVICE HPX_FORCEINLINE void operator()(Iter const& curr)
+            {
+                if (traits::any_of(hpx::util::invoke(pred_, *curr)))
+                    tok_.cancel();
+            }
+        };
+    }    // namespace detail
+
+    // Find the index of the first element in [it, it + count) the predicate
+    // holds for, the result is stored in the cancellation token. For
+    // vector-pack execution policies the predicate is invoked with vector
+    // packs of elements and returns a mask.
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename Pred>
+    HPX_FORCEINLINE Iter find_first_idx_n(std::size_t base_idx, Iter it,
+        std::size_t count, CancelToken& tok, Pred&& pred)
+    {
+        typedef detail::find_first_iteration<
+            typename std::remove_reference<Pred>::type, CancelToken>
+            iteration_type;
+
+        return loop_idx_n<ExPolicy>(
+            base_idx, it, count, tok, iteration_type{pred, tok});
+    }
+
+    // Cancel the token if the predicate holds for any of the elements in
+    // [it, it + count). For vector-pack execution policies the predicate is
+    // invoked with vector packs of elements and returns a mask.
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename Pred>
+    HPX_FORCEINLINE Iter find_any_n(
+        Iter it, std::size_t count, CancelToken& tok, Pred&& pred)
+    {
+        typedef detail::find_any_iteration<
+            typename std::remove_reference<Pred>::type, CancelToken>
+            iteration_type;
+
+        return loop_n<ExPolicy>(it, count, tok, iteration_type{pred, tok});
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
         // Helper class to repeatedly call a function a given number of times
@@ -16,6 +16,7 @@
 #endif
 #include <hpx/errors.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/synchronization/detail/yield_k.hpp>
 
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/executors/execution.hpp>
@@ -27,6 +28,7 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <list>
@@ -46,6 +48,38 @@ namespace hpx { namespace parallel { namespace util {
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // Default number of elements handled by one chunk of the single-pass
+        // scan, chosen such that input and output of a chunk stay in the
+        // cache between the first and the third step.
+        static constexpr std::size_t single_pass_scan_chunk_size = 16384;
+
+        // Descriptor of one chunk of the single-pass scan. The status is set
+        // after the corresponding result has been stored, the results are
+        // never modified afterwards.
+        template <typename T>
+        struct scan_chunk_descriptor
+        {
+            enum status_type
+            {
+                invalid = 0,
+                aggregate_available = 1,
+                prefix_available = 2
+            };
+
+            scan_chunk_descriptor()
+              : status_(invalid)
+              , finished_(false)
+            {
+            }
+
+            std::atomic<int> status_;
+            std::atomic<bool> finished_;    // step 3 has been performed
+
+            hpx::shared_future<T> aggregate_;    // result of this chunk
+            hpx::shared_future<T> prefix_;       // result up to this chunk
+        };
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -286,6 +320,22 @@ namespace hpx { namespace parallel { namespace util {
                 typename F1, typename F2, typename F3, typename F4>
             static R call(ExPolicy_&& policy, FwdIter first, std::size_t count,
                 T&& init, F1&& f1, F2&& f2, F3&& f3, F4&& f4)
+            {
+                typedef typename execution::extract_has_single_pass_scan<
+                    parameters_type>::type has_single_pass_scan;
+
+                return call(has_single_pass_scan(), ScanPartTag{},
+                    std::forward<ExPolicy_>(policy), first, count,
+                    std::forward<T>(init), std::forward<F1>(f1),
+                    std::forward<F2>(f2), std::forward<F3>(f3),
+                    std::forward<F4>(f4));
+            }
+
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(std::false_type, ScanPartTag, ExPolicy_&& policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
             {
                 return call(ScanPartTag{}, std::forward<ExPolicy_>(policy),
                     first, count, std::forward<T>(init), std::forward<F1>(f1),
@@ -293,6 +343,205 @@ namespace hpx { namespace parallel { namespace util {
                     std::forward<F4>(f4));
             }
 
+            // Single-pass scan using decoupled look-back: the chunks are
+            // claimed in order by a fixed number of tasks. Each chunk
+            // publishes the result of step 1 and combines it with the results
+            // published by its predecessors, which replaces the sequential
+            // chain of step 2. Step 3 is performed right away while the data
+            // of the chunk is still in the cache.
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(std::true_type, ScanPartTag, ExPolicy_ policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                typedef scan_chunk_descriptor<Result1> descriptor;
+                typedef typename std::decay<F1>::type f1_type;
+
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                HPX_ASSERT(count > 0);
+
+                std::size_t chunk_size =
+                    policy.parameters().get_scan_chunk_size();
+                if (chunk_size == 0)
+                    chunk_size = single_pass_scan_chunk_size;
+
+                std::size_t const num_chunks =
+                    (count + chunk_size - 1) / chunk_size;
+
+                std::vector<FwdIter> chunks;
+                chunks.reserve(num_chunks);
+                for (std::size_t i = 0; i != num_chunks; ++i)
+                {
+                    chunks.push_back(first);
+                    if (i + 1 != num_chunks)
+                        std::advance(first, chunk_size);
+                }
+
+                hpx::shared_future<Result1> init_item =
+                    hpx::make_ready_future(std::forward<T>(init));
+
+                std::vector<descriptor> descriptors(num_chunks);
+                std::vector<hpx::future<Result2>> finalitems(num_chunks);
+
+                // combine the results of all chunks before the given one
+                auto look_back = [&](std::size_t chunk) {
+                    hpx::shared_future<Result1> acc;
+                    for (std::size_t j = chunk - 1; /**/; --j)
+                    {
+                        descriptor& pred = descriptors[j];
+
+                        int status = descriptor::invalid;
+                        for (std::size_t k = 0;
+                             (status = pred.status_.load(
+                                  std::memory_order_acquire)) ==
+                             descriptor::invalid;
+                             ++k)
+                        {
+                            hpx::util::detail::yield_k(
+                                k, "scan_partitioner::look_back");
+                        }
+
+                        hpx::shared_future<Result1> const& value =
+                            status == descriptor::prefix_available ?
+                            pred.prefix_ :
+                            pred.aggregate_;
+
+                        if (acc.valid())
+                        {
+                            acc = dataflow(hpx::launch::sync, f2, value, acc);
+                        }
+                        else
+                        {
+                            acc = value;
+                        }
+
+                        if (status == descriptor::prefix_available)
+                            return acc;
+
+                        // the first chunk always publishes its prefix
+                        HPX_ASSERT(j != 0);
+                    }
+                };
+
+                auto process_chunk = [&](std::size_t chunk, f1_type& f) {
+                    descriptor& d = descriptors[chunk];
+                    FwdIter it = chunks[chunk];
+                    std::size_t size =
+                        (std::min)(chunk_size, count - chunk * chunk_size);
+
+                    // step 1, exceptions are propagated through the results
+                    hpx::shared_future<Result1> curr;
+                    try
+                    {
+                        curr = hpx::make_ready_future(Result1(f(it, size)));
+                    }
+                    catch (...)
+                    {
+                        curr = hpx::make_exceptional_future<Result1>(
+                            std::current_exception());
+                    }
+
+                    // step 2
+                    hpx::shared_future<Result1> prev = init_item;
+                    if (chunk != 0)
+                    {
+                        d.aggregate_ = curr;
+                        d.status_.store(descriptor::aggregate_available,
+                            std::memory_order_release);
+
+                        prev = look_back(chunk);
+                    }
+
+                    hpx::shared_future<Result1> next =
+                        dataflow(hpx::launch::sync, f2, prev, curr);
+
+                    d.prefix_ = next;
+                    d.status_.store(descriptor::prefix_available,
+                        std::memory_order_release);
+
+                    // step 3, wait for the previous chunk if required
+                    if (std::is_same<ScanPartTag,
+                            scan_partitioner_sequential_f3_tag>::value &&
+                        chunk != 0)
+                    {
+                        std::atomic<bool>& finished =
+                            descriptors[chunk - 1].finished_;
+                        for (std::size_t k = 0;
+                             !finished.load(std::memory_order_acquire); ++k)
+                        {
+                            hpx::util::detail::yield_k(
+                                k, "scan_partitioner::process_chunk");
+                        }
+                    }
+
+                    finalitems[chunk] =
+                        dataflow(hpx::launch::sync, f3, it, size, prev, next);
+                    finalitems[chunk].wait();
+
+                    d.finished_.store(true, std::memory_order_release);
+                };
+
+                // the chunks are claimed in order, a chunk waits only for
+                // chunks which are being processed already
+                std::atomic<std::size_t> next_chunk(0);
+                auto worker = [&, f1]() mutable -> void {
+                    for (std::size_t chunk = next_chunk++; chunk < num_chunks;
+                         chunk = next_chunk++)
+                    {
+                        process_chunk(chunk, f1);
+                    }
+                };
+
+                std::size_t const cores = execution::processing_units_count(
+                    policy.executor(), policy.parameters());
+                std::size_t const num_tasks =
+                    (std::min)(num_chunks, (std::max)(cores, std::size_t(1)));
+
+                std::vector<hpx::future<void>> workers;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    workers.reserve(num_tasks - 1);
+                    for (std::size_t i = 1; i < num_tasks; ++i)
+                    {
+                        workers.push_back(
+                            execution::async_execute(policy.executor(), worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+
+                // the calling thread participates, this guarantees progress
+                // even if no tasks could be created
+                worker();
+
+                hpx::wait_all(workers);
+                handle_local_exceptions::call(workers, errors);
+
+                std::vector<hpx::shared_future<Result1>> workitems;
+                workitems.reserve(num_chunks + 1);
+                workitems.push_back(std::move(init_item));
+                for (descriptor& d : descriptors)
+                    workitems.push_back(std::move(d.prefix_));
+
+                return reduce(std::move(workitems), std::move(finalitems),
+                    std::move(errors), std::forward<F4>(f4));
+#endif
+            }
+
         private:
             template <typename F>
             static R reduce(
@@ -343,7 +592,7 @@ namespace hpx { namespace parallel { namespace util {
                         using partitioner_type =
                             scan_static_partitioner<ExPolicy, ScanPartTag, R,
                                 Result1, Result2>;
-                        return partitioner_type::call(ScanPartTag{},
+                        return partitioner_type::call(
                             std::forward<ExPolicy_>(policy), first, count,
                             std::move(init), f1, f2, f3, f4);
                     });
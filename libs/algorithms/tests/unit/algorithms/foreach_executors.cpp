@@ -46,6 +46,13 @@ void for_each_executors_test()
         test_executors_async(execution::par(execution::task).on(exec));
     }
 
+    {
+        execution::fork_join_executor exec;
+
+        test_executors(execution::par.on(exec));
+        test_executors_async(execution::par(execution::task).on(exec));
+    }
+
     {
         execution::sequenced_executor exec;
 
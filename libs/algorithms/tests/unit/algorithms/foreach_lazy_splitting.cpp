@@ -0,0 +1,230 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The algorithms iterating over their input split the range lazily if the
+// executor parameters include lazy_binary_splitting, this verifies that every
+// element is visited exactly once, also for very irregular iterations.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_transform.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_for_each(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand());
+
+    std::vector<std::atomic<std::size_t>> visited(c.size());
+    for (auto& v : visited)
+        v.store(0);
+
+    iterator result = hpx::parallel::for_each(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), [&](std::size_t& v) {
+            std::size_t i = &v - c.data();
+            ++visited[i];
+
+            // a few of the iterations are much more expensive than the rest
+            if (i % 1000 == 0)
+                hpx::this_thread::yield();
+        });
+
+    HPX_TEST(result == iterator(std::end(c)));
+    HPX_TEST(std::all_of(std::begin(visited), std::end(visited),
+        [](std::atomic<std::size_t> const& v) { return v.load() == 1; }));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_for_each_async(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007, 0);
+
+    auto f = hpx::parallel::for_each(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), [](std::size_t& v) { ++v; });
+
+    HPX_TEST(f.get() == iterator(std::end(c)));
+    HPX_TEST(std::all_of(
+        std::begin(c), std::end(c), [](std::size_t v) { return v == 1; }));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_transform(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::vector<int> d(c.size());
+    std::iota(std::begin(c), std::end(c), std::rand());
+
+    auto result = hpx::parallel::transform(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), [](int v) { return v + 1; });
+
+    HPX_TEST(hpx::util::get<1>(result) == std::end(d));
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        HPX_TEST_EQ(d[i], c[i] + 1);
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_for_each_exception(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::size_t(0));
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::for_each(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), [](std::size_t v) {
+                if (v == 5000)
+                    throw std::runtime_error("test");
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), std::size_t(1));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+// Return the number of distinct tasks which ran the iterations
+template <typename ExPolicy, typename IteratorTag>
+std::size_t count_tasks(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007);
+
+    // the calling task is alive until all iterations have been run, its id
+    // can't be reused by any of the tasks split off from it
+    hpx::lcos::local::spinlock mtx;
+    std::set<hpx::threads::thread_id_type> tasks;
+
+    hpx::parallel::for_each(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), [&](std::size_t&) {
+            hpx::threads::thread_id_type const id =
+                hpx::threads::get_self_id();
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+            tasks.insert(id);
+        });
+
+    return tasks.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_lazy_binary_splitting()
+{
+    using namespace hpx::parallel;
+
+    for (std::size_t grain_size : {0, 1, 7, 100, 10007})
+    {
+        execution::lazy_binary_splitting lbs(grain_size);
+
+        test_for_each(execution::par.with(lbs), IteratorTag());
+        test_for_each_async(
+            execution::par(execution::task).with(lbs), IteratorTag());
+        test_transform(execution::par.with(lbs), IteratorTag());
+        test_for_each_exception(execution::par.with(lbs), IteratorTag());
+
+        // the chunk size given by other parameters is not used
+        test_for_each(
+            execution::par.with(lbs, execution::static_chunk_size(3)),
+            IteratorTag());
+    }
+
+    // the workers are idle when the loop starts, the range is split as soon
+    // as it holds at least two blocks
+    HPX_TEST_LTE(std::size_t(2), hpx::get_os_thread_count());
+    for (std::size_t grain_size : {0, 1, 7, 100})
+    {
+        execution::lazy_binary_splitting lbs(grain_size);
+        HPX_TEST_LT(std::size_t(1),
+            count_tasks(execution::par.with(lbs), IteratorTag()));
+    }
+
+    // a single block is never split
+    execution::lazy_binary_splitting lbs(10007);
+    HPX_TEST_EQ(
+        std::size_t(1), count_tasks(execution::par.with(lbs), IteratorTag()));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_lazy_binary_splitting<std::random_access_iterator_tag>();
+    test_lazy_binary_splitting<std::forward_iterator_tag>();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,183 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_NTH_ELEMENT_TEST_SIZE 100000
+#else
+#define HPX_NTH_ELEMENT_TEST_SIZE 1000000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_input(std::size_t size, int max_value)
+{
+    std::vector<int> c(size);
+    for (int& v : c)
+        v = std::rand() % max_value;
+    return c;
+}
+
+template <typename Compare>
+void verify_nth_element(std::vector<int> const& orig,
+    std::vector<int> const& c, std::size_t n, Compare comp)
+{
+    std::vector<int> sorted = orig;
+    std::sort(sorted.begin(), sorted.end(), comp);
+
+    HPX_TEST_EQ(c[n], sorted[n]);
+    HPX_TEST(std::all_of(c.begin(), c.begin() + n,
+        [&](int v) { return !comp(c[n], v); }));
+    HPX_TEST(std::all_of(c.begin() + n, c.end(),
+        [&](int v) { return !comp(v, c[n]); }));
+
+    // the result has to be a permutation of the input
+    std::vector<int> result = c;
+    std::sort(result.begin(), result.end(), comp);
+    HPX_TEST(result == sorted);
+}
+
+template <typename ExPolicy>
+void test_nth_element(ExPolicy&& policy, std::size_t size, int max_value)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> const orig = make_input(size, max_value);
+
+    std::size_t positions[] = {0, size / 3, size / 2, size - 1};
+    for (std::size_t n : positions)
+    {
+        std::vector<int> c = orig;
+        auto result =
+            hpx::parallel::nth_element(policy, c.begin(), c.begin() + n, c.end());
+        HPX_TEST(result == c.end());
+        verify_nth_element(orig, c, n, std::less<int>());
+
+        c = orig;
+        hpx::parallel::nth_element(
+            policy, c.begin(), c.begin() + n, c.end(), std::greater<int>());
+        verify_nth_element(orig, c, n, std::greater<int>());
+    }
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy&& policy, std::size_t size, int max_value)
+{
+    std::vector<int> const orig = make_input(size, max_value);
+    std::vector<int> c = orig;
+
+    std::size_t n = size / 4;
+    auto f = hpx::parallel::nth_element(
+        policy, c.begin(), c.begin() + n, c.end());
+    HPX_TEST(f.get() == c.end());
+
+    verify_nth_element(orig, c, n, std::less<int>());
+}
+
+template <typename ExPolicy>
+void test_nth_element_exception(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c = make_input(size, 1000);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::nth_element(policy, c.begin(), c.begin() + size / 2,
+            c.end(), [](int lhs, int rhs) -> bool {
+                throw std::runtime_error("test");
+                return lhs < rhs;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void nth_element_test()
+{
+    using namespace hpx::parallel;
+
+    // a large range of values as well as many duplicates
+    for (int max_value : {RAND_MAX, 10})
+    {
+        for (std::size_t size : {std::size_t(1), std::size_t(1000),
+                 std::size_t(HPX_NTH_ELEMENT_TEST_SIZE)})
+        {
+            test_nth_element(execution::seq, size, max_value);
+            test_nth_element(execution::par, size, max_value);
+            test_nth_element(execution::par_unseq, size, max_value);
+
+            test_nth_element_async(
+                execution::seq(execution::task), size, max_value);
+            test_nth_element_async(
+                execution::par(execution::task), size, max_value);
+        }
+    }
+
+    // all elements are equal
+    test_nth_element(execution::par, HPX_NTH_ELEMENT_TEST_SIZE, 1);
+
+    test_nth_element_exception(execution::seq, HPX_NTH_ELEMENT_TEST_SIZE);
+    test_nth_element_exception(execution::par, HPX_NTH_ELEMENT_TEST_SIZE);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    nth_element_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,175 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_PARTIAL_SORT_COPY_TEST_SIZE 100000
+#else
+#define HPX_PARTIAL_SORT_COPY_TEST_SIZE 1000000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_input(std::size_t size, int max_value)
+{
+    std::vector<int> c(size);
+    for (int& v : c)
+        v = std::rand() % max_value;
+    return c;
+}
+
+template <typename ExPolicy, typename Compare>
+void test_partial_sort_copy(ExPolicy&& policy, std::size_t size,
+    std::size_t dest_size, int max_value, Compare comp)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> const c = make_input(size, max_value);
+    std::vector<int> d(dest_size, -1);
+
+    auto result = hpx::parallel::partial_sort_copy(
+        policy, c.begin(), c.end(), d.begin(), d.end(), comp);
+
+    std::vector<int> expected(dest_size, -1);
+    auto expected_result = std::partial_sort_copy(
+        c.begin(), c.end(), expected.begin(), expected.end(), comp);
+
+    HPX_TEST(result - d.begin() == expected_result - expected.begin());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> const c = make_input(size, RAND_MAX);
+    std::vector<int> d(size / 10);
+
+    auto f = hpx::parallel::partial_sort_copy(
+        policy, c.begin(), c.end(), d.begin(), d.end());
+    HPX_TEST(f.get() == d.end());
+
+    std::vector<int> expected(size / 10);
+    std::partial_sort_copy(
+        c.begin(), c.end(), expected.begin(), expected.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_exception(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c = make_input(size, 1000);
+    std::vector<int> d(size / 2);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::partial_sort_copy(policy, c.begin(), c.end(),
+            d.begin(), d.end(), [](int lhs, int rhs) -> bool {
+                throw std::runtime_error("test");
+                return lhs < rhs;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partial_sort_copy(ExPolicy&& policy, std::size_t size, int max_value)
+{
+    std::size_t dest_sizes[] = {0, 1, size / 100, size / 2, size, size + 10};
+    for (std::size_t dest_size : dest_sizes)
+    {
+        test_partial_sort_copy(
+            policy, size, dest_size, max_value, std::less<int>());
+        test_partial_sort_copy(
+            policy, size, dest_size, max_value, std::greater<int>());
+    }
+}
+
+void partial_sort_copy_test()
+{
+    using namespace hpx::parallel;
+
+    for (int max_value : {RAND_MAX, 10})
+    {
+        for (std::size_t size : {std::size_t(0), std::size_t(1000),
+                 std::size_t(HPX_PARTIAL_SORT_COPY_TEST_SIZE)})
+        {
+            test_partial_sort_copy(execution::seq, size, max_value);
+            test_partial_sort_copy(execution::par, size, max_value);
+            test_partial_sort_copy(execution::par_unseq, size, max_value);
+        }
+    }
+
+    test_partial_sort_copy_async(
+        execution::seq(execution::task), HPX_PARTIAL_SORT_COPY_TEST_SIZE);
+    test_partial_sort_copy_async(
+        execution::par(execution::task), HPX_PARTIAL_SORT_COPY_TEST_SIZE);
+
+    test_partial_sort_copy_exception(
+        execution::seq, HPX_PARTIAL_SORT_COPY_TEST_SIZE);
+    test_partial_sort_copy_exception(
+        execution::par, HPX_PARTIAL_SORT_COPY_TEST_SIZE);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    partial_sort_copy_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,229 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The scan based algorithms use the single-pass scan if the executor
+// parameters include single_pass_scan, this verifies the results for small
+// chunk sizes, i.e. for many chunks looking back on each other.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_remove.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/include/parallel_unique.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_inclusive_scan(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007);
+    std::vector<std::size_t> d(c.size());
+    std::vector<std::size_t> e(c.size());
+    std::generate(c.begin(), c.end(), []() { return std::rand() % 100; });
+
+    hpx::parallel::inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), std::plus<std::size_t>(),
+        std::size_t(10));
+
+    std::partial_sum(std::begin(c), std::end(c), std::begin(e));
+    for (std::size_t& v : e)
+        v += 10;
+
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_exclusive_scan(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c(10007);
+    std::vector<std::size_t> d(c.size());
+    std::vector<std::size_t> e(c.size());
+    std::generate(c.begin(), c.end(), []() { return std::rand() % 100; });
+
+    auto f = hpx::parallel::exclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), std::size_t(10),
+        std::plus<std::size_t>());
+    f.wait();
+
+    std::size_t sum = 10;
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        e[i] = sum;
+        sum += c[i];
+    }
+
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> e;
+    std::generate(c.begin(), c.end(), []() { return std::rand(); });
+
+    auto pred = [](int v) { return v % 3 == 0; };
+
+    auto result = hpx::parallel::copy_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), pred);
+
+    std::copy_if(std::begin(c), std::end(c), std::back_inserter(e), pred);
+
+    HPX_TEST(hpx::util::get<0>(result) == iterator(std::end(c)));
+    HPX_TEST(hpx::util::get<1>(result) == std::begin(d) + e.size());
+    HPX_TEST(std::equal(std::begin(e), std::end(e), std::begin(d)));
+}
+
+// remove_if and unique require the last step to run in order
+template <typename ExPolicy, typename IteratorTag>
+void test_remove_if_unique(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::generate(c.begin(), c.end(), []() { return std::rand() % 4; });
+    std::vector<int> d = c;
+
+    auto pred = [](int v) { return v == 0; };
+
+    auto result = hpx::parallel::remove_if(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), pred);
+    auto expected = std::remove_if(std::begin(d), std::end(d), pred);
+
+    HPX_TEST(result.base() - std::begin(c) == expected - std::begin(d));
+    HPX_TEST(std::equal(std::begin(d), expected, std::begin(c)));
+
+    c.erase(result.base(), std::end(c));
+    d.erase(expected, std::end(d));
+
+    result = hpx::parallel::unique(
+        policy, iterator(std::begin(c)), iterator(std::end(c)));
+    expected = std::unique(std::begin(d), std::end(d));
+
+    HPX_TEST(result.base() - std::begin(c) == expected - std::begin(d));
+    HPX_TEST(std::equal(std::begin(d), expected, std::begin(c)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_exception(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::decorated_iterator<base_iterator, IteratorTag>
+        decorated_iterator;
+
+    std::vector<std::size_t> c(10007);
+    std::vector<std::size_t> d(c.size());
+    std::fill(std::begin(c), std::end(c), std::size_t(1));
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::inclusive_scan(policy,
+            decorated_iterator(
+                std::begin(c), []() { throw std::runtime_error("test"); }),
+            decorated_iterator(std::end(c)), std::begin(d),
+            std::plus<std::size_t>(), std::size_t(0));
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        // every chunk reports its exception, the number of chunks is not
+        // limited by the number of cores
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_single_pass_scan()
+{
+    using namespace hpx::parallel;
+
+    for (std::size_t chunk_size : {0, 1, 7, 100, 10007})
+    {
+        execution::single_pass_scan sps(chunk_size);
+
+        test_inclusive_scan(execution::par.with(sps), IteratorTag());
+        test_exclusive_scan(
+            execution::par(execution::task).with(sps), IteratorTag());
+        test_copy_if(execution::par.with(sps), IteratorTag());
+        test_remove_if_unique(execution::par.with(sps), IteratorTag());
+        test_scan_exception(execution::par.with(sps), IteratorTag());
+
+        // the chunk size given by other parameters is not used
+        test_inclusive_scan(
+            execution::par.with(sps, execution::static_chunk_size(3)),
+            IteratorTag());
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_single_pass_scan<std::random_access_iterator_tag>();
+    test_single_pass_scan<std::forward_iterator_tag>();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
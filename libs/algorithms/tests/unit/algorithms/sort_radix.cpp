@@ -0,0 +1,208 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Arithmetic keys compared using std::less are sorted using a radix sort,
+// this verifies the handling of the key encodings and of sort_by_key.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_SORT_RADIX_TEST_SIZE 200000
+#else
+#define HPX_SORT_RADIX_TEST_SIZE 2000000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T random_value(std::true_type)
+{
+    // integral keys, fill all bytes
+    std::uint64_t value = 0;
+    for (int i = 0; i != 4; ++i)
+        value = (value << 16) ^ std::uint64_t(std::rand());
+    return T(value);
+}
+
+template <typename T>
+T random_value(std::false_type)
+{
+    // floating point keys of both signs and a wide range of exponents
+    T value = T(std::rand()) / T(RAND_MAX) - T(0.5);
+    return value * std::pow(T(10), T(std::rand() % 20 - 10));
+}
+
+template <typename T>
+std::vector<T> make_input(std::size_t size)
+{
+    std::vector<T> c(size);
+    for (T& v : c)
+        v = random_value<T>(std::is_integral<T>());
+    return c;
+}
+
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort_radix(ExPolicy&& policy, std::vector<T> c, Compare comp)
+{
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::parallel::sort(policy, c.begin(), c.end(), comp);
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_sort_radix(ExPolicy&& policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<T> c = make_input<T>(HPX_SORT_RADIX_TEST_SIZE);
+
+    test_sort_radix(policy, c, hpx::parallel::v1::detail::less());
+    test_sort_radix(policy, c, std::less<T>());
+
+    // few distinct keys, most passes are skipped
+    for (T& v : c)
+        v = T(std::rand() % 100);
+    test_sort_radix(policy, c, std::less<T>());
+
+    // all keys are equal
+    std::fill(c.begin(), c.end(), T(42));
+    test_sort_radix(policy, c, std::less<T>());
+}
+
+template <typename ExPolicy>
+void test_sort_radix_special_values(ExPolicy&& policy)
+{
+    std::vector<double> c = make_input<double>(HPX_SORT_RADIX_TEST_SIZE);
+    for (std::size_t i = 0; i < c.size(); i += 7)
+        c[i] = -0.0;
+    for (std::size_t i = 1; i < c.size(); i += 101)
+        c[i] = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 2; i < c.size(); i += 103)
+        c[i] = -std::numeric_limits<double>::infinity();
+    for (std::size_t i = 3; i < c.size(); i += 107)
+        c[i] = (std::numeric_limits<double>::min)();
+
+    hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(std::is_sorted(c.begin(), c.end()));
+}
+
+template <typename ExPolicy>
+void test_sort_by_key_radix(ExPolicy&& policy)
+{
+    std::vector<std::int64_t> keys =
+        make_input<std::int64_t>(HPX_SORT_RADIX_TEST_SIZE);
+    std::vector<std::size_t> values(keys.size());
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        keys[i] %= 100000;
+        values[i] = i;
+    }
+    std::vector<std::int64_t> const orig = keys;
+
+    hpx::parallel::sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        HPX_TEST_EQ(orig[values[i]], keys[i]);
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_radix_async(ExPolicy&& policy)
+{
+    std::vector<std::uint32_t> c =
+        make_input<std::uint32_t>(HPX_SORT_RADIX_TEST_SIZE);
+    std::vector<std::uint32_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(c == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sort_radix_policy(ExPolicy&& policy)
+{
+    test_sort_radix<ExPolicy, std::int8_t>(policy);
+    test_sort_radix<ExPolicy, std::uint16_t>(policy);
+    test_sort_radix<ExPolicy, int>(policy);
+    test_sort_radix<ExPolicy, std::uint64_t>(policy);
+    test_sort_radix<ExPolicy, std::int64_t>(policy);
+    test_sort_radix<ExPolicy, float>(policy);
+    test_sort_radix<ExPolicy, double>(policy);
+
+    test_sort_radix_special_values(policy);
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    test_sort_by_key_radix(policy);
+#endif
+}
+
+void sort_radix_test()
+{
+    using namespace hpx::parallel;
+
+    test_sort_radix_policy(execution::par);
+    test_sort_radix_policy(execution::par_unseq);
+
+    test_sort_radix_async(execution::par(execution::task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    sort_radix_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
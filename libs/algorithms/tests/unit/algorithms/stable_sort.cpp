@@ -0,0 +1,195 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_STABLE_SORT_TEST_SIZE 100000
+#else
+#define HPX_STABLE_SORT_TEST_SIZE 1000000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// The keys are drawn from a small range to produce many equal elements, the
+// second member records the original position of the element.
+typedef std::pair<int, std::size_t> element;
+
+std::vector<element> make_input(std::size_t size)
+{
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = element(std::rand() % 1000, i);
+    return c;
+}
+
+template <typename Compare>
+bool is_stably_sorted(std::vector<element> const& c, Compare comp)
+{
+    for (std::size_t i = 1; i < c.size(); ++i)
+    {
+        if (comp(c[i].first, c[i - 1].first))
+            return false;
+        if (!comp(c[i - 1].first, c[i].first) && c[i - 1].second > c[i].second)
+            return false;
+    }
+    return true;
+}
+
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy&& policy, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element> c = make_input(size);
+
+    auto result = hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+        std::less<int>(), [](element const& e) { return e.first; });
+
+    HPX_TEST(result == c.end());
+    HPX_TEST(is_stably_sorted(c, std::less<int>()));
+}
+
+template <typename ExPolicy>
+void test_stable_sort_comp(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c = make_input(size);
+
+    hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.first > rhs.first;
+        });
+
+    HPX_TEST(is_stably_sorted(c, std::greater<int>()));
+}
+
+template <typename ExPolicy>
+void test_stable_sort_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c = make_input(size);
+
+    auto f = hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+        std::less<int>(), [](element const& e) { return e.first; });
+    HPX_TEST(f.get() == c.end());
+
+    HPX_TEST(is_stably_sorted(c, std::less<int>()));
+}
+
+template <typename ExPolicy>
+void test_stable_sort_sorted(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::string> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::to_string(i);
+    std::sort(c.begin(), c.end());
+
+    std::vector<std::string> expected = c;
+    hpx::parallel::stable_sort(policy, c.begin(), c.end());
+
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_exception(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c = make_input(size);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+            [](element const& lhs, element const& rhs) -> bool {
+                throw std::runtime_error("test");
+                return lhs.first < rhs.first;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void stable_sort_test()
+{
+    using namespace hpx::parallel;
+
+    for (std::size_t size : {std::size_t(0), std::size_t(1),
+             std::size_t(1000), std::size_t(HPX_STABLE_SORT_TEST_SIZE)})
+    {
+        test_stable_sort(execution::seq, size);
+        test_stable_sort(execution::par, size);
+        test_stable_sort(execution::par_unseq, size);
+
+        test_stable_sort_comp(execution::seq, size);
+        test_stable_sort_comp(execution::par, size);
+        test_stable_sort_comp(execution::par_unseq, size);
+
+        test_stable_sort_async(execution::seq(execution::task), size);
+        test_stable_sort_async(execution::par(execution::task), size);
+    }
+
+    test_stable_sort_sorted(execution::par, HPX_STABLE_SORT_TEST_SIZE);
+
+    test_stable_sort_exception(execution::seq, HPX_STABLE_SORT_TEST_SIZE);
+    test_stable_sort_exception(execution::par, HPX_STABLE_SORT_TEST_SIZE);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    stable_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_NTH_ELEMENT_TEST_SIZE 100000
+#else
+#define HPX_NTH_ELEMENT_TEST_SIZE 1000000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_input(std::size_t size)
+{
+    std::vector<int> c(size);
+    for (int& v : c)
+        v = std::rand();
+    return c;
+}
+
+void verify_nth_element(
+    std::vector<int> const& orig, std::vector<int> const& c, std::size_t n)
+{
+    std::vector<int> sorted = orig;
+    std::sort(sorted.begin(), sorted.end());
+
+    HPX_TEST_EQ(c[n], sorted[n]);
+    HPX_TEST(std::all_of(
+        c.begin(), c.begin() + n, [&](int v) { return v <= c[n]; }));
+    HPX_TEST(
+        std::all_of(c.begin() + n, c.end(), [&](int v) { return v >= c[n]; }));
+}
+
+template <typename ExPolicy>
+void test_nth_element(ExPolicy&& policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> const orig = make_input(HPX_NTH_ELEMENT_TEST_SIZE);
+    std::vector<int> c = orig;
+
+    std::size_t n = c.size() / 3;
+    auto result = hpx::parallel::nth_element(policy, c, c.begin() + n);
+
+    HPX_TEST(result == c.end());
+    verify_nth_element(orig, c, n);
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy&& policy)
+{
+    std::vector<int> const orig = make_input(HPX_NTH_ELEMENT_TEST_SIZE);
+    std::vector<int> c = orig;
+
+    std::size_t n = c.size() / 3;
+    auto f = hpx::parallel::nth_element(policy, c, c.begin() + n);
+    HPX_TEST(f.get() == c.end());
+
+    verify_nth_element(orig, c, n);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void nth_element_test()
+{
+    using namespace hpx::parallel;
+
+    test_nth_element(execution::seq);
+    test_nth_element(execution::par);
+    test_nth_element(execution::par_unseq);
+
+    test_nth_element_async(execution::seq(execution::task));
+    test_nth_element_async(execution::par(execution::task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    nth_element_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
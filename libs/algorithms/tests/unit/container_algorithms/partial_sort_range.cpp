@@ -0,0 +1,152 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_PARTIAL_SORT_TEST_SIZE 100000
+#else
+#define HPX_PARTIAL_SORT_TEST_SIZE 1000000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_input(std::size_t size)
+{
+    std::vector<int> c(size);
+    for (int& v : c)
+        v = std::rand();
+    return c;
+}
+
+template <typename ExPolicy>
+void test_partial_sort(ExPolicy&& policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_input(HPX_PARTIAL_SORT_TEST_SIZE);
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    std::size_t m = c.size() / 10;
+    auto result = hpx::parallel::partial_sort(
+        policy, c, c.begin() + m, std::greater<int>());
+
+    HPX_TEST(result == c.end());
+    HPX_TEST(std::equal(c.begin(), c.begin() + m, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy&& policy)
+{
+    std::vector<int> c = make_input(HPX_PARTIAL_SORT_TEST_SIZE);
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t m = c.size() / 10;
+    auto f = hpx::parallel::partial_sort(policy, c, c.begin() + m);
+    HPX_TEST(f.get() == c.end());
+
+    HPX_TEST(std::equal(c.begin(), c.begin() + m, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy(ExPolicy&& policy)
+{
+    std::vector<int> const c = make_input(HPX_PARTIAL_SORT_TEST_SIZE);
+    std::vector<int> d(c.size() / 10);
+
+    auto result = hpx::parallel::partial_sort_copy(policy, c, d);
+    HPX_TEST(result == d.end());
+
+    std::vector<int> expected(d.size());
+    std::partial_sort_copy(
+        c.begin(), c.end(), expected.begin(), expected.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_async(ExPolicy&& policy)
+{
+    std::vector<int> const c = make_input(HPX_PARTIAL_SORT_TEST_SIZE);
+    std::vector<int> d(c.size() / 10);
+
+    auto f = hpx::parallel::partial_sort_copy(policy, c, d);
+    HPX_TEST(f.get() == d.end());
+
+    std::vector<int> expected(d.size());
+    std::partial_sort_copy(
+        c.begin(), c.end(), expected.begin(), expected.end());
+    HPX_TEST(d == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void partial_sort_test()
+{
+    using namespace hpx::parallel;
+
+    test_partial_sort(execution::seq);
+    test_partial_sort(execution::par);
+    test_partial_sort(execution::par_unseq);
+
+    test_partial_sort_async(execution::seq(execution::task));
+    test_partial_sort_async(execution::par(execution::task));
+
+    test_partial_sort_copy(execution::seq);
+    test_partial_sort_copy(execution::par);
+    test_partial_sort_copy(execution::par_unseq);
+
+    test_partial_sort_copy_async(execution::seq(execution::task));
+    test_partial_sort_copy_async(execution::par(execution::task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    partial_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
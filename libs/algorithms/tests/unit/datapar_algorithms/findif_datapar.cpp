@@ -0,0 +1,110 @@
+//  Copyright (c) 2014 Grant Mercer
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../algorithms/findif_tests.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_find_if()
+{
+    using namespace hpx::parallel;
+
+    test_find_if(execution::dataseq, IteratorTag());
+    test_find_if(execution::datapar, IteratorTag());
+
+    test_find_if_async(execution::dataseq(execution::task), IteratorTag());
+    test_find_if_async(execution::datapar(execution::task), IteratorTag());
+}
+
+void find_if_test()
+{
+    test_find_if<std::random_access_iterator_tag>();
+    test_find_if<std::forward_iterator_tag>();
+}
+
+////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_find_if_exception()
+{
+    using namespace hpx::parallel;
+
+    test_find_if_exception(execution::dataseq, IteratorTag());
+    test_find_if_exception(execution::datapar, IteratorTag());
+
+    test_find_if_exception_async(
+        execution::dataseq(execution::task), IteratorTag());
+    test_find_if_exception_async(
+        execution::datapar(execution::task), IteratorTag());
+}
+
+void find_if_exception_test()
+{
+    test_find_if_exception<std::random_access_iterator_tag>();
+    test_find_if_exception<std::forward_iterator_tag>();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_find_if_bad_alloc()
+{
+    using namespace hpx::parallel;
+
+    test_find_if_bad_alloc(execution::dataseq, IteratorTag());
+    test_find_if_bad_alloc(execution::datapar, IteratorTag());
+
+    test_find_if_bad_alloc_async(
+        execution::dataseq(execution::task), IteratorTag());
+    test_find_if_bad_alloc_async(
+        execution::datapar(execution::task), IteratorTag());
+}
+
+void find_if_bad_alloc_test()
+{
+    test_find_if_bad_alloc<std::random_access_iterator_tag>();
+    test_find_if_bad_alloc<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    find_if_test();
+    find_if_exception_test();
+    find_if_bad_alloc_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
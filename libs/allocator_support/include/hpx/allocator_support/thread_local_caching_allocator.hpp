@@ -0,0 +1,154 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_THREAD_LOCAL_CACHING_ALLOCATOR_NOV_04_2019_0912AM)
+#define HPX_UTIL_THREAD_LOCAL_CACHING_ALLOCATOR_NOV_04_2019_0912AM
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // Small blocks are binned into size classes of 16 bytes each. Every
+        // (operating system) thread keeps a bounded list of the blocks it has
+        // freed for each size class, which are handed out again by later
+        // allocations of the same size class on that thread. Larger blocks
+        // are forwarded to the system allocator.
+        static constexpr std::size_t thread_local_cache_granularity = 16;
+        static constexpr std::size_t thread_local_cache_max_size = 512;
+
+        HPX_EXPORT void* thread_local_cache_allocate(std::size_t size);
+        HPX_EXPORT void thread_local_cache_deallocate(
+            void* p, std::size_t size) noexcept;
+
+        // Blocks returned by the cache are aligned for any fundamental type
+        template <typename T>
+        struct is_thread_local_cacheable
+          : std::integral_constant<bool,
+                alignof(T) <= thread_local_cache_granularity>
+        {
+        };
+    }    // namespace detail
+
+    /// Release all blocks cached by the calling thread.
+    HPX_EXPORT void thread_local_cache_clear();
+
+    /// The number of allocations served from a block cached by the
+    /// allocating thread.
+    HPX_EXPORT std::uint64_t get_thread_local_cache_hits(bool reset);
+
+    /// The number of allocations which had to be forwarded to the system
+    /// allocator.
+    HPX_EXPORT std::uint64_t get_thread_local_cache_misses(bool reset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An allocator recycling the memory of small objects through a cache
+    /// held by each thread. This is meant for short lived objects allocated
+    /// at a high rate, like the shared states of futures.
+    template <typename T = char>
+    struct thread_local_caching_allocator
+    {
+        typedef T value_type;
+        typedef T* pointer;
+        typedef T const* const_pointer;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef thread_local_caching_allocator<U> other;
+        };
+
+        typedef std::true_type is_always_equal;
+        typedef std::true_type propagate_on_container_move_assignment;
+
+        thread_local_caching_allocator() = default;
+
+        template <typename U>
+        thread_local_caching_allocator(
+            thread_local_caching_allocator<U> const&) noexcept
+        {
+        }
+
+        pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (!detail::is_thread_local_cacheable<T>::value)
+            {
+#if defined(__cpp_aligned_new)
+                return static_cast<pointer>(::operator new(
+                    n * sizeof(T), std::align_val_t(alignof(T))));
+#else
+                return static_cast<pointer>(::operator new(n * sizeof(T)));
+#endif
+            }
+
+            return static_cast<pointer>(
+                detail::thread_local_cache_allocate(n * sizeof(T)));
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (!detail::is_thread_local_cacheable<T>::value)
+            {
+#if defined(__cpp_aligned_new)
+                return ::operator delete(p, std::align_val_t(alignof(T)));
+#else
+                return ::operator delete(p);
+#endif
+            }
+
+            detail::thread_local_cache_deallocate(p, n * sizeof(T));
+        }
+
+        size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            ::new ((void*) p) U(std::forward<Args>(args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p)
+        {
+            p->~U();
+        }
+    };
+
+    template <typename T, typename U>
+    HPX_CONSTEXPR bool operator==(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    HPX_CONSTEXPR bool operator!=(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&)
+    {
+        return false;
+    }
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
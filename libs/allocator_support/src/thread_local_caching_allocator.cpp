@@ -0,0 +1,194 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace hpx { namespace util {
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_THREAD_LOCAL_CACHE)
+    namespace {
+        constexpr std::size_t num_size_classes =
+            detail::thread_local_cache_max_size /
+            detail::thread_local_cache_granularity;
+
+        // the number of bytes cached per size class and thread
+        constexpr std::size_t max_cached_bytes = 16384;
+
+        // the statistics of each thread are added to the global values only
+        // every so often to avoid contention
+        constexpr std::uint64_t counter_flush_interval = 256;
+
+        std::atomic<std::uint64_t> cache_hits(0);
+        std::atomic<std::uint64_t> cache_misses(0);
+
+        struct free_block
+        {
+            free_block* next_;
+        };
+
+        struct thread_cache
+        {
+            struct bin
+            {
+                free_block* head_;
+                std::size_t count_;
+            };
+
+            ~thread_cache();
+
+            void clear()
+            {
+                for (bin& b : bins_)
+                {
+                    while (b.head_ != nullptr)
+                    {
+                        free_block* next = b.head_->next_;
+                        ::operator delete(b.head_);
+                        b.head_ = next;
+                    }
+                    b.count_ = 0;
+                }
+            }
+
+            void flush_counters()
+            {
+                cache_hits.fetch_add(hits_, std::memory_order_relaxed);
+                cache_misses.fetch_add(misses_, std::memory_order_relaxed);
+                hits_ = misses_ = 0;
+            }
+
+            // thread local objects are zero-initialized
+            std::array<bin, num_size_classes> bins_;
+            std::uint64_t hits_;
+            std::uint64_t misses_;
+        };
+
+        thread_local thread_cache cache;
+
+        // blocks freed during the destruction of other thread local objects
+        // are handed directly to the system allocator
+        HPX_NATIVE_TLS bool cache_destroyed = false;
+
+        thread_cache::~thread_cache()
+        {
+            clear();
+            flush_counters();
+            cache_destroyed = true;
+        }
+
+        std::size_t size_class(std::size_t size)
+        {
+            return size == 0 ?
+                0 :
+                (size - 1) / detail::thread_local_cache_granularity;
+        }
+
+        std::size_t max_cached_blocks(std::size_t c)
+        {
+            return max_cached_bytes /
+                ((c + 1) * detail::thread_local_cache_granularity);
+        }
+    }    // namespace
+
+    namespace detail {
+        void* thread_local_cache_allocate(std::size_t size)
+        {
+            if (size > thread_local_cache_max_size || cache_destroyed)
+                return ::operator new(size);
+
+            std::size_t const c = size_class(size);
+            thread_cache& tc = cache;
+            thread_cache::bin& b = tc.bins_[c];
+
+            if (b.head_ != nullptr)
+            {
+                free_block* p = b.head_;
+                b.head_ = p->next_;
+                --b.count_;
+
+                if (++tc.hits_ == counter_flush_interval)
+                    tc.flush_counters();
+                return p;
+            }
+
+            if (++tc.misses_ == counter_flush_interval)
+                tc.flush_counters();
+
+            // allocate the full size class, any block of a size class may be
+            // handed out for any size mapped to it
+            return ::operator new((c + 1) * thread_local_cache_granularity);
+        }
+
+        void thread_local_cache_deallocate(void* p, std::size_t size) noexcept
+        {
+            if (p == nullptr)
+                return;
+
+            if (size > thread_local_cache_max_size || cache_destroyed)
+                return ::operator delete(p);
+
+            std::size_t const c = size_class(size);
+            thread_cache::bin& b = cache.bins_[c];
+            if (b.count_ >= max_cached_blocks(c))
+                return ::operator delete(p);
+
+            free_block* block = static_cast<free_block*>(p);
+            block->next_ = b.head_;
+            b.head_ = block;
+            ++b.count_;
+        }
+    }    // namespace detail
+
+    void thread_local_cache_clear()
+    {
+        if (!cache_destroyed)
+            cache.clear();
+    }
+
+    std::uint64_t get_thread_local_cache_hits(bool reset)
+    {
+        return reset ? cache_hits.exchange(0, std::memory_order_relaxed) :
+                       cache_hits.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t get_thread_local_cache_misses(bool reset)
+    {
+        return reset ? cache_misses.exchange(0, std::memory_order_relaxed) :
+                       cache_misses.load(std::memory_order_relaxed);
+    }
+#else
+    namespace detail {
+        void* thread_local_cache_allocate(std::size_t size)
+        {
+            return ::operator new(size);
+        }
+
+        void thread_local_cache_deallocate(void* p, std::size_t) noexcept
+        {
+            ::operator delete(p);
+        }
+    }    // namespace detail
+
+    void thread_local_cache_clear() {}
+
+    std::uint64_t get_thread_local_cache_hits(bool)
+    {
+        return 0;
+    }
+
+    std::uint64_t get_thread_local_cache_misses(bool)
+    {
+        return 0;
+    }
+#endif
+}}    // namespace hpx::util
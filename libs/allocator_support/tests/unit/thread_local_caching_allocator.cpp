@@ -0,0 +1,145 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+using hpx::util::detail::thread_local_cache_allocate;
+using hpx::util::detail::thread_local_cache_deallocate;
+
+void test_alignment()
+{
+    for (std::size_t size = 1; size <= 1024; size += 7)
+    {
+        void* p = thread_local_cache_allocate(size);
+        HPX_TEST(p != nullptr);
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) %
+                hpx::util::detail::thread_local_cache_granularity,
+            std::uintptr_t(0));
+
+        std::memset(p, 0xff, size);
+        thread_local_cache_deallocate(p, size);
+    }
+}
+
+void test_recycling()
+{
+    hpx::util::thread_local_cache_clear();
+
+    void* p = thread_local_cache_allocate(40);
+    thread_local_cache_deallocate(p, 40);
+
+    // any size of the same size class reuses the block
+    void* q = thread_local_cache_allocate(33);
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_THREAD_LOCAL_CACHE)
+    HPX_TEST_EQ(p, q);
+#endif
+    thread_local_cache_deallocate(q, 33);
+
+    hpx::util::thread_local_cache_clear();
+}
+
+void test_allocator()
+{
+    std::vector<int, hpx::util::thread_local_caching_allocator<int>> v;
+    for (int i = 0; i != 1000; ++i)
+        v.push_back(i);
+
+    for (int i = 0; i != 1000; ++i)
+        HPX_TEST_EQ(v[i], i);
+}
+
+struct alignas(64) over_aligned
+{
+    char data[64];
+};
+
+void test_over_aligned()
+{
+    // over-aligned types are not cached, but still have to be aligned
+    hpx::util::thread_local_caching_allocator<over_aligned> alloc;
+
+    for (std::size_t n = 1; n <= 16; ++n)
+    {
+        over_aligned* p = alloc.allocate(n);
+        HPX_TEST(p != nullptr);
+#if defined(__cpp_aligned_new)
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(over_aligned),
+            std::uintptr_t(0));
+#endif
+        std::memset(p, 0xff, n * sizeof(over_aligned));
+        alloc.deallocate(p, n);
+    }
+}
+
+void test_threads()
+{
+    // blocks may be freed by a thread different from the allocating one
+    std::vector<void*> blocks(1000);
+    for (void*& p : blocks)
+        p = thread_local_cache_allocate(64);
+
+    std::set<void*> const allocated(blocks.begin(), blocks.end());
+
+    // the statistics of a thread are complete once it has exited
+    std::uint64_t const hits = hpx::util::get_thread_local_cache_hits(false);
+    std::uint64_t const misses =
+        hpx::util::get_thread_local_cache_misses(false);
+
+    std::size_t recycled = 0;
+    std::thread t([&]() {
+        for (void* p : blocks)
+            thread_local_cache_deallocate(p, 64);
+
+        for (void*& p : blocks)
+        {
+            p = thread_local_cache_allocate(64);
+            if (allocated.count(p) != 0)
+                ++recycled;
+        }
+    });
+    t.join();
+
+    std::uint64_t const thread_hits =
+        hpx::util::get_thread_local_cache_hits(false) - hits;
+    std::uint64_t const thread_misses =
+        hpx::util::get_thread_local_cache_misses(false) - misses;
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_THREAD_LOCAL_CACHE)
+    // the blocks freed by the thread are handed out to it again, as far as
+    // its (bounded) cache could hold them
+    HPX_TEST_EQ(thread_hits + thread_misses, std::uint64_t(blocks.size()));
+    HPX_TEST_LT(std::uint64_t(0), thread_hits);
+    HPX_TEST_LT(std::uint64_t(0), thread_misses);
+    HPX_TEST_LTE(thread_hits, std::uint64_t(recycled));
+#else
+    HPX_TEST_EQ(thread_hits, std::uint64_t(0));
+    HPX_TEST_EQ(thread_misses, std::uint64_t(0));
+#endif
+
+    for (void* p : blocks)
+        thread_local_cache_deallocate(p, 64);
+}
+
+int main()
+{
+    test_alignment();
+    test_recycling();
+    test_allocator();
+    test_over_aligned();
+    test_threads();
+
+    return hpx::util::report_errors();
+}
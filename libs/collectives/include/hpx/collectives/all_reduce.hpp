@@ -13,6 +13,22 @@
 // clang-format off
 namespace hpx { namespace lcos {
 
+    /// The algorithms available for performing an all_reduce operation.
+    ///
+    /// The recursive doubling algorithm finishes in log2(num_sites) steps
+    /// without funneling all data through a single site. The ring algorithm
+    /// is available for std::vector values only and requires the reduction
+    /// operation to combine its arguments element-wise, it is bandwidth
+    /// optimal for large vectors. The automatic selection assumes that all
+    /// sites supply values of equal size.
+    enum class all_reduce_algorithm
+    {
+        automatic,
+        central,
+        recursive_doubling,
+        ring
+    };
+
     /// AllReduce a set of values from different call sites
     ///
     /// This function receives a set of values that are the result of applying
@@ -36,7 +52,13 @@ namespace hpx { namespace lcos {
     ///                     defaults to whatever hpx::get_locality_id() returns.
     /// \params root_site   The site that is responsible for creating the
     ///                     all_reduce support object. This value is optional
-    ///                     and defaults to '0' (zero).
+    ///                     and defaults to '0' (zero). It is used by the
+    ///                     central algorithm only.
+    /// \param algorithm   The algorithm used to perform the all_reduce
+    ///                     operation (default: automatically selected based
+    ///                     on the number of sites and the size of the
+    ///                     supplied values). All sites have to use the same
+    ///                     algorithm.
     ///
     /// \note       Each all_reduce operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_ALLREDUCE macro to define the
@@ -50,7 +72,8 @@ namespace hpx { namespace lcos {
     hpx::future<T> all_reduce(char const* basename, hpx::future<T> result,
         F&& op, std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0);
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic);
 
     /// AllReduce a set of values from different call sites
     ///
@@ -74,7 +97,13 @@ namespace hpx { namespace lcos {
     ///                     defaults to whatever hpx::get_locality_id() returns.
     /// \params root_site   The site that is responsible for creating the
     ///                     all_reduce support object. This value is optional
-    ///                     and defaults to '0' (zero).
+    ///                     and defaults to '0' (zero). It is used by the
+    ///                     central algorithm only.
+    /// \param algorithm   The algorithm used to perform the all_reduce
+    ///                     operation (default: automatically selected based
+    ///                     on the number of sites and the size of the
+    ///                     supplied values). All sites have to use the same
+    ///                     algorithm.
     ///
     /// \note       Each all_reduce operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_ALLREDUCE macro to define the
@@ -88,7 +117,8 @@ namespace hpx { namespace lcos {
     hpx::future<std::decay_t<T>> all_reduce(char const* basename, T&& result,
         F&& op, std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0);
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic);
 
 /// \def HPX_REGISTER_ALLREDUCE_DECLARATION(type, name)
 ///
@@ -138,8 +168,11 @@ namespace hpx { namespace lcos {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
 #include <hpx/assertion.hpp>
+#include <hpx/async.hpp>
 #include <hpx/basic_execution/register_locks.hpp>
+#include <hpx/collectives/detail/communicator.hpp>
 #include <hpx/dataflow.hpp>
+#include <hpx/errors.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/local_lcos/and_gate.hpp>
@@ -158,7 +191,9 @@ namespace hpx { namespace lcos {
 #include <hpx/type_support/decay.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <mutex>
 #include <string>
 #include <type_traits>
@@ -167,6 +202,15 @@ namespace hpx { namespace lcos {
 
 namespace hpx { namespace lcos {
 
+    /// The algorithms available for performing an all_reduce operation.
+    enum class all_reduce_algorithm
+    {
+        automatic,             ///< select based on payload size and site count
+        central,               ///< all values are combined on the root site
+        recursive_doubling,    ///< pairwise exchanges in log2(num_sites) steps
+        ring                   ///< reduce-scatter followed by an allgather
+    };
+
     namespace detail {
 
         ////////////////////////////////////////////////////////////////////////
@@ -280,6 +324,203 @@ namespace hpx { namespace lcos {
                     return target;
                 });
         }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Below this many sites the single support object on the root site
+        // performs as well as any of the distributed algorithms.
+        constexpr std::size_t all_reduce_central_max_sites = 4;
+
+        // Starting at this payload size (in bytes) the ring algorithm is
+        // used for vectors as it is bandwidth-optimal, while recursive
+        // doubling sends the whole payload log2(num_sites) times.
+        constexpr std::size_t all_reduce_ring_min_payload = 64 * 1024;
+
+        template <typename T>
+        all_reduce_algorithm select_all_reduce_algorithm(
+            T const& value, std::size_t num_sites, std::false_type)
+        {
+            if (num_sites < all_reduce_central_max_sites)
+                return all_reduce_algorithm::central;
+            return all_reduce_algorithm::recursive_doubling;
+        }
+
+        template <typename T>
+        all_reduce_algorithm select_all_reduce_algorithm(
+            T const& value, std::size_t num_sites, std::true_type)
+        {
+            if (num_sites < all_reduce_central_max_sites)
+                return all_reduce_algorithm::central;
+            if (value.size() >= num_sites &&
+                payload_size(value) >= all_reduce_ring_min_payload)
+            {
+                return all_reduce_algorithm::ring;
+            }
+            return all_reduce_algorithm::recursive_doubling;
+        }
+
+        // All sites have to arrive at the same decision, which is the case as
+        // long as all of them supply values of equal size.
+        template <typename T>
+        all_reduce_algorithm select_all_reduce_algorithm(T const& value,
+            std::size_t num_sites, all_reduce_algorithm algorithm)
+        {
+            if (algorithm != all_reduce_algorithm::automatic)
+                return algorithm;
+            return select_all_reduce_algorithm(
+                value, num_sites, is_vector<T>());
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Recursive doubling: sites exchange their partial results with a
+        // partner at distance 1, 2, 4, ... If the number of sites is not a
+        // power of two, the excess sites hand their value to a partner first
+        // and receive the final result from it at the end.
+        template <typename T, typename F>
+        T all_reduce_recursive_doubling(communicator<T, all_reduce_tag>& comm,
+            T value, F& op, std::size_t num_sites, std::size_t this_site)
+        {
+            std::size_t pof2 = 1;
+            std::size_t num_steps = 0;
+            while (2 * pof2 <= num_sites)
+            {
+                pof2 *= 2;
+                ++num_steps;
+            }
+            std::size_t const last_step = num_steps + 1;
+
+            if (this_site >= pof2)
+            {
+                comm.send(this_site - pof2, 0, std::move(value));
+                return comm.receive(last_step);
+            }
+
+            bool has_excess_partner = this_site + pof2 < num_sites;
+            if (has_excess_partner)
+            {
+                value = op(std::move(value), comm.receive(0));
+            }
+
+            for (std::size_t step = 1, mask = 1; mask != pof2;
+                 ++step, mask *= 2)
+            {
+                std::size_t partner = this_site ^ mask;
+                comm.send(partner, step, T(value));
+                T other = comm.receive(step);
+
+                // always combine in site order to make sure that all sites
+                // end up with the very same result
+                if (this_site < partner)
+                    value = op(std::move(value), std::move(other));
+                else
+                    value = op(std::move(other), std::move(value));
+            }
+
+            if (has_excess_partner)
+            {
+                comm.send(this_site + pof2, last_step, T(value));
+            }
+            return value;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Ring algorithm: the vector is split into num_sites blocks. During
+        // the reduce-scatter phase each block travels once around the ring
+        // while being combined with the local data, afterwards each site owns
+        // one fully reduced block which is then passed around the ring again.
+        // This requires for the reduction operation to combine the given
+        // vectors element-wise.
+        template <typename T>
+        void all_reduce_ring_store(T& value, std::size_t first,
+            std::size_t last, T&& block)
+        {
+            if (block.size() != last - first)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::lcos::detail::all_reduce_ring",
+                    "the ring all_reduce algorithm requires equally sized "
+                    "vectors and an element-wise reduction operation");
+            }
+            std::move(block.begin(), block.end(),
+                std::next(value.begin(), first));
+        }
+
+        template <typename T, typename F>
+        T all_reduce_ring(communicator<T, all_reduce_tag>& comm, T value,
+            F& op, std::size_t num_sites, std::size_t this_site,
+            std::true_type)
+        {
+            std::size_t const size = value.size();
+            auto offset = [&](std::size_t block) {
+                return block * size / num_sites;
+            };
+            auto get_block = [&](std::size_t block) {
+                return T(std::next(value.begin(), offset(block)),
+                    std::next(value.begin(), offset(block + 1)));
+            };
+
+            std::size_t const next = (this_site + 1) % num_sites;
+            std::size_t step = 0;
+
+            // reduce-scatter
+            for (std::size_t i = 0; i != num_sites - 1; ++i, ++step)
+            {
+                std::size_t send_block =
+                    (this_site + num_sites - i) % num_sites;
+                std::size_t recv_block =
+                    (this_site + 2 * num_sites - i - 1) % num_sites;
+
+                comm.send(next, step, get_block(send_block));
+                T partial = comm.receive(step);
+
+                all_reduce_ring_store(value, offset(recv_block),
+                    offset(recv_block + 1),
+                    op(std::move(partial), get_block(recv_block)));
+            }
+
+            // allgather, this site now owns block (this_site + 1)
+            for (std::size_t i = 0; i != num_sites - 1; ++i, ++step)
+            {
+                std::size_t send_block =
+                    (this_site + 1 + num_sites - i) % num_sites;
+                std::size_t recv_block =
+                    (this_site + num_sites - i) % num_sites;
+
+                comm.send(next, step, get_block(send_block));
+                all_reduce_ring_store(value, offset(recv_block),
+                    offset(recv_block + 1), comm.receive(step));
+            }
+
+            return value;
+        }
+
+        template <typename T, typename F>
+        T all_reduce_ring(communicator<T, all_reduce_tag>& comm, T value,
+            F& op, std::size_t num_sites, std::size_t this_site,
+            std::false_type)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::lcos::detail::all_reduce_ring",
+                "the ring all_reduce algorithm can be used for std::vector "
+                "values only");
+            return value;
+        }
+
+        template <typename T, typename F>
+        T all_reduce_sites(std::string const& name, T value, F op,
+            std::size_t num_sites, std::size_t this_site,
+            all_reduce_algorithm algorithm)
+        {
+            communicator<T, all_reduce_tag> comm(name, this_site);
+
+            T result = (algorithm == all_reduce_algorithm::ring) ?
+                all_reduce_ring(comm, std::move(value), op, num_sites,
+                    this_site, is_vector<T>()) :
+                all_reduce_recursive_doubling(
+                    comm, std::move(value), op, num_sites, this_site);
+
+            comm.finish();
+            return result;
+        }
     }    // namespace detail
 
     ////////////////////////////////////////////////////////////////////////////
@@ -351,7 +592,8 @@ namespace hpx { namespace lcos {
         hpx::future<T>&& local_result, F&& op,
         std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic)
     {
         if (num_sites == std::size_t(-1))
         {
@@ -361,6 +603,21 @@ namespace hpx { namespace lcos {
         if (this_site == std::size_t(-1))
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
 
+        if (algorithm != all_reduce_algorithm::central)
+        {
+            // the algorithm can be selected only once the local value is
+            // known
+            using func_type = typename std::decay<F>::type;
+            return local_result.then(hpx::launch::sync,
+                [name = std::string(basename), HPX_CAPTURE_FORWARD(op),
+                    num_sites, generation, this_site, root_site,
+                    algorithm](hpx::future<T>&& f) mutable -> hpx::future<T> {
+                    return all_reduce(name.c_str(), f.get(),
+                        std::forward<func_type>(op), num_sites, generation,
+                        this_site, root_site, algorithm);
+                });
+        }
+
         if (this_site == 0)
         {
             return all_reduce(create_all_reduce<T>(
@@ -416,7 +673,8 @@ namespace hpx { namespace lcos {
     hpx::future<typename std::decay<T>::type> all_reduce(char const* basename,
         T&& local_result, F&& op, std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic)
     {
         if (num_sites == std::size_t(-1))
         {
@@ -426,6 +684,22 @@ namespace hpx { namespace lcos {
         if (this_site == std::size_t(-1))
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
 
+        using arg_type = typename std::decay<T>::type;
+        algorithm = detail::select_all_reduce_algorithm<arg_type>(
+            local_result, num_sites, algorithm);
+
+        if (algorithm != all_reduce_algorithm::central)
+        {
+            std::string name(basename);
+            if (generation != std::size_t(-1))
+                name += std::to_string(generation) + "/";
+
+            using func_type = typename std::decay<F>::type;
+            return hpx::async(&detail::all_reduce_sites<arg_type, func_type>,
+                std::move(name), std::forward<T>(local_result),
+                std::forward<F>(op), num_sites, this_site, algorithm);
+        }
+
         if (this_site == root_site)
         {
             return all_reduce(create_all_reduce<T>(
@@ -445,11 +719,32 @@ namespace hpx { namespace lcos {
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx {
     using lcos::all_reduce;
+    using lcos::all_reduce_algorithm;
     using lcos::create_all_reduce;
 }    // namespace hpx
 
 ////////////////////////////////////////////////////////////////////////////////
-#define HPX_REGISTER_ALLREDUCE_DECLARATION(...) /**/
+#define HPX_REGISTER_ALLREDUCE_DECLARATION(...)                                \
+    HPX_REGISTER_ALLREDUCE_DECLARATION_(__VA_ARGS__)                           \
+    /**/
+
+#define HPX_REGISTER_ALLREDUCE_DECLARATION_(...)                               \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_ALLREDUCE_DECLARATION_,              \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_ALLREDUCE_DECLARATION_1(type)                             \
+    HPX_REGISTER_ALLREDUCE_DECLARATION_2(type, HPX_PP_CAT(type, _all_reduce))  \
+    /**/
+
+#define HPX_REGISTER_ALLREDUCE_DECLARATION_2(type, name)                       \
+    typedef hpx::lcos::detail::communicator_server<type,                       \
+        hpx::lcos::detail::all_reduce_tag>                                     \
+        HPX_PP_CAT(all_reduce_communicator_server_, name);                     \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(all_reduce_communicator_server_, name)::set_action,         \
+        HPX_PP_CAT(all_reduce_communicator_set_action_, name))                 \
+    /**/
 
 ////////////////////////////////////////////////////////////////////////////////
 #define HPX_REGISTER_ALLREDUCE(...)                                            \
@@ -470,6 +765,16 @@ namespace hpx {
         hpx::lcos::detail::all_reduce_server<type>>                            \
         HPX_PP_CAT(all_reduce_, name);                                         \
     HPX_REGISTER_COMPONENT(HPX_PP_CAT(all_reduce_, name))                      \
+    typedef hpx::lcos::detail::communicator_server<type,                       \
+        hpx::lcos::detail::all_reduce_tag>                                     \
+        HPX_PP_CAT(all_reduce_communicator_server_, name);                     \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(all_reduce_communicator_server_, name)::set_action,         \
+        HPX_PP_CAT(all_reduce_communicator_set_action_, name));                \
+    typedef hpx::components::component<                                        \
+        HPX_PP_CAT(all_reduce_communicator_server_, name)>                     \
+        HPX_PP_CAT(all_reduce_communicator_, name);                            \
+    HPX_REGISTER_COMPONENT(HPX_PP_CAT(all_reduce_communicator_, name))         \
     /**/
 
 #endif    // COMPUTE_HOST_CODE
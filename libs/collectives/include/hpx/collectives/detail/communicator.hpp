@@ -0,0 +1,199 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_COLLECTIVES_DETAIL_COMMUNICATOR_OCT_18_2019_0951AM)
+#define HPX_COLLECTIVES_DETAIL_COMMUNICATOR_OCT_18_2019_0951AM
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/errors.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/local_lcos/receive_buffer.hpp>
+#include <hpx/runtime/actions/component_action.hpp>
+#include <hpx/runtime/basename_registration.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/components/server/component_base.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/naming/unmanaged.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Tags distinguishing the communicators used by the different collective
+    // operations, this allows to register all of them for the same data type.
+    struct all_reduce_tag
+    {
+    };
+
+    struct gather_tag
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct is_vector : std::false_type
+    {
+    };
+
+    template <typename T, typename Allocator>
+    struct is_vector<std::vector<T, Allocator>> : std::true_type
+    {
+    };
+
+    // Number of bytes a value occupies on the wire (approximately). This is
+    // used to select a suitable algorithm, all sites are expected to supply
+    // values of equal size.
+    template <typename T>
+    std::size_t payload_size(T const&)
+    {
+        return sizeof(T);
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t payload_size(std::vector<T, Allocator> const& v)
+    {
+        return v.size() * sizeof(T);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Mailbox of one participating site. Each site creates one of those and
+    // registers it under the common base name using its own site number.
+    // Values are matched with their receiver using the step number, which
+    // has to be unique for all messages received by a site during a single
+    // operation.
+    template <typename T, typename Tag>
+    class communicator_server
+      : public hpx::components::component_base<communicator_server<T, Tag>>
+    {
+    public:
+        communicator_server() = default;
+
+        void set(std::size_t step, T&& t)
+        {
+            buffer_.store_received(step, std::move(t));
+        }
+
+        hpx::future<T> get(std::size_t step)
+        {
+            return buffer_.receive(step);
+        }
+
+        HPX_DEFINE_COMPONENT_ACTION(communicator_server, set, set_action);
+
+    private:
+        lcos::local::receive_buffer<T> buffer_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Point to point communication between the sites participating in one
+    // collective operation. This is meant to be used from a (suspendable)
+    // HPX thread as all operations block until they have completed.
+    template <typename T, typename Tag>
+    class communicator
+    {
+        using server_type = communicator_server<T, Tag>;
+        using set_action = typename server_type::set_action;
+
+    public:
+        communicator(std::string name, std::size_t this_site)
+          : name_(std::move(name))
+          , site_(this_site)
+          , id_(hpx::local_new<server_type>().get())
+          , server_(hpx::get_ptr<server_type>(hpx::launch::sync, id_))
+        {
+            // Register unmanaged id to avoid cyclic dependencies, unregister
+            // is done once this site has received all of its data.
+            bool result = hpx::register_with_basename(
+                name_, hpx::unmanaged(id_), site_)
+                              .get();
+            if (!result)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::lcos::detail::communicator::communicator",
+                    "the given base name for the collective operation was "
+                    "already registered: " +
+                        name_);
+            }
+            registered_ = true;
+        }
+
+        ~communicator()
+        {
+            if (registered_)
+            {
+                hpx::unregister_with_basename(name_, site_);
+            }
+        }
+
+        communicator(communicator const&) = delete;
+        communicator& operator=(communicator const&) = delete;
+
+        void send(std::size_t site, std::size_t step, T&& t)
+        {
+            sends_.push_back(
+                hpx::async(set_action(), find(site), step, std::move(t)));
+        }
+
+        T receive(std::size_t step)
+        {
+            return server_->get(step).get();
+        }
+
+        // wait for all outgoing data to be delivered and detach the name of
+        // this site
+        void finish()
+        {
+            hpx::wait_all(sends_);
+            for (hpx::future<void>& f : sends_)
+            {
+                f.get();    // propagate any exceptions
+            }
+            sends_.clear();
+
+            registered_ = false;
+            hpx::unregister_with_basename(name_, site_).get();
+        }
+
+    private:
+        hpx::id_type const& find(std::size_t site)
+        {
+            auto it = peers_.find(site);
+            if (it == peers_.end())
+            {
+                it = peers_
+                         .emplace(site,
+                             hpx::find_from_basename(name_, site).get())
+                         .first;
+            }
+            return it->second;
+        }
+
+        std::string name_;
+        std::size_t site_;
+        hpx::id_type id_;
+        std::shared_ptr<server_type> server_;
+        bool registered_ = false;
+
+        std::map<std::size_t, hpx::id_type> peers_;
+        std::vector<hpx::future<void>> sends_;
+    };
+}}}    // namespace hpx::lcos::detail
+
+#endif    // COMPUTE_HOST_CODE
+#endif
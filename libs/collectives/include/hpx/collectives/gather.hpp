@@ -147,6 +147,78 @@ namespace hpx { namespace lcos {
         std::size_t generation = std::size_t(-1), std::size_t root_site = 0,
         std::size_t this_site = std::size_t(-1));
 
+    /// The algorithms available for performing a gather operation.
+    ///
+    /// The central algorithm sends all values directly to the gather site.
+    /// The binomial tree algorithm forwards the values along a tree rooted
+    /// at the gather site, which reduces the number of messages the gather
+    /// site has to handle to log2(num_sites). The automatic selection
+    /// assumes that all sites supply values of equal size.
+    enum class gather_algorithm
+    {
+        automatic,
+        central,
+        binomial_tree
+    };
+
+    /// Gather a set of values from different call sites using the given
+    /// algorithm
+    ///
+    /// \param  basename    The base name identifying the gather operation
+    /// \param  result      The value (or a future referring to the value) to
+    ///                     transmit to the central gather point from this
+    ///                     call site.
+    /// \param algorithm   The algorithm used to perform the gather
+    ///                     operation. All sites have to use the same
+    ///                     algorithm.
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities).
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the gather operation performed on the
+    ///                     given base name.
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id).
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             gathered values. It will become ready once the gather
+    ///             operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<typename std::decay<T>::type>> gather_here(
+        char const* basename, T&& result, gather_algorithm algorithm,
+        std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1));
+
+    /// Gather a given value at the given call site using the given algorithm
+    ///
+    /// \param  basename    The base name identifying the gather operation
+    /// \param  result      The value (or a future referring to the value) to
+    ///                     transmit to the central gather point from this
+    ///                     call site.
+    /// \param algorithm   The algorithm used to perform the gather
+    ///                     operation. All sites have to use the same
+    ///                     algorithm.
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities). This is required for the binomial
+    ///                     tree algorithm only.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the gather operation performed on the
+    ///                     given base name.
+    /// \param root_site   The sequence number of the central gather point
+    ///                     (usually the locality id).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id).
+    ///
+    /// \returns    This function returns a future which will become ready once
+    ///             the gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<void> gather_there(char const* basename, T&& result,
+        gather_algorithm algorithm, std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1), std::size_t root_site = 0,
+        std::size_t this_site = std::size_t(-1));
+
 /// \def HPX_REGISTER_GATHER_DECLARATION(type, name)
 ///
 /// \brief Declare a gather object named \a name for a given data type \a type.
@@ -195,6 +267,8 @@ namespace hpx { namespace lcos {
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/async.hpp>
+#include <hpx/collectives/detail/communicator.hpp>
 #include <hpx/dataflow.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -210,11 +284,14 @@ namespace hpx { namespace lcos {
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/runtime/naming/id_type.hpp>
 #include <hpx/runtime/naming/unmanaged.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/decay.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <mutex>
 #include <string>
 #include <type_traits>
@@ -223,6 +300,14 @@ namespace hpx { namespace lcos {
 
 namespace hpx { namespace lcos {
 
+    /// The algorithms available for performing a gather operation.
+    enum class gather_algorithm
+    {
+        automatic,       ///< select based on payload size and site count
+        central,         ///< all values are sent directly to the gather site
+        binomial_tree    ///< values are forwarded along a binomial tree
+    };
+
     namespace detail {
 
         ///////////////////////////////////////////////////////////////////////
@@ -390,6 +475,76 @@ namespace hpx { namespace lcos {
             typedef typename gather_server<T>::set_result_action action_type;
             return async(action_type(), f.get(), which, result.get());
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Below this many sites the gather site can easily handle all
+        // messages directly.
+        constexpr std::size_t gather_central_max_sites = 4;
+
+        // Starting at this payload size (in bytes) forwarding the values
+        // through intermediate sites costs more than it saves.
+        constexpr std::size_t gather_tree_max_payload = 64 * 1024;
+
+        // All sites have to arrive at the same decision, which is the case as
+        // long as all of them supply values of equal size.
+        template <typename T>
+        gather_algorithm select_gather_algorithm(T const& value,
+            std::size_t num_sites, gather_algorithm algorithm)
+        {
+            if (algorithm != gather_algorithm::automatic)
+                return algorithm;
+            if (num_sites < gather_central_max_sites ||
+                payload_size(value) > gather_tree_max_payload)
+            {
+                return gather_algorithm::central;
+            }
+            return gather_algorithm::binomial_tree;
+        }
+
+        // Binomial tree: a site with rank r (relative to the gather site)
+        // collects the values of the ranks [r, r + 2^k), where 2^k is the
+        // lowest bit set in r, and sends those to rank r - 2^k. The gather
+        // site receives log2(num_sites) messages only.
+        template <typename T>
+        std::vector<T> gather_binomial_tree(std::string const& name, T value,
+            std::size_t num_sites, std::size_t this_site,
+            std::size_t root_site)
+        {
+            communicator<std::vector<T>, gather_tag> comm(name, this_site);
+
+            std::size_t const rank =
+                (this_site + num_sites - root_site) % num_sites;
+
+            std::vector<T> data;
+            data.push_back(std::move(value));
+
+            std::size_t step = 0;
+            for (std::size_t mask = 1; mask < num_sites; mask *= 2, ++step)
+            {
+                if (rank & mask)
+                {
+                    comm.send((rank - mask + root_site) % num_sites, step,
+                        std::move(data));
+                    comm.finish();
+                    return std::vector<T>();
+                }
+
+                if (rank + mask < num_sites)
+                {
+                    std::vector<T> received = comm.receive(step);
+                    std::move(received.begin(), received.end(),
+                        std::back_inserter(data));
+                }
+            }
+            comm.finish();
+
+            // the values are ordered by rank, reorder them by site
+            HPX_ASSERT(data.size() == num_sites);
+            std::rotate(data.begin(),
+                std::next(data.begin(), (num_sites - root_site) % num_sites),
+                data.end());
+            return data;
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -545,6 +700,108 @@ namespace hpx { namespace lcos {
         return gather_there(hpx::find_from_basename(std::move(name), root_site),
             std::forward<T>(result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // gather using an explicitly selected algorithm
+    template <typename T>
+    hpx::future<std::vector<typename util::decay<T>::type>> gather_here(
+        char const* basename, T&& result, gather_algorithm algorithm,
+        std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1))
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+            this_site = static_cast<std::size_t>(hpx::get_locality_id());
+
+        typedef typename util::decay<T>::type result_type;
+        algorithm = detail::select_gather_algorithm<result_type>(
+            result, num_sites, algorithm);
+
+        if (algorithm == gather_algorithm::central)
+        {
+            return gather_here(basename, std::forward<T>(result), num_sites,
+                generation, this_site);
+        }
+
+        std::string name(basename);
+        if (generation != std::size_t(-1))
+            name += std::to_string(generation) + "/";
+
+        return hpx::async(&detail::gather_binomial_tree<result_type>,
+            std::move(name), std::forward<T>(result), num_sites, this_site,
+            this_site);
+    }
+
+    template <typename T>
+    hpx::future<std::vector<T>> gather_here(char const* basename,
+        hpx::future<T> result, gather_algorithm algorithm,
+        std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1))
+    {
+        // the algorithm can be selected only once the local value is known
+        return result.then(hpx::launch::sync,
+            [name = std::string(basename), algorithm, num_sites, generation,
+                this_site](hpx::future<T>&& f) {
+                return gather_here(name.c_str(), f.get(), algorithm,
+                    num_sites, generation, this_site);
+            });
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(char const* basename, T&& result,
+        gather_algorithm algorithm, std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1), std::size_t root_site = 0,
+        std::size_t this_site = std::size_t(-1))
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+            this_site = static_cast<std::size_t>(hpx::get_locality_id());
+
+        typedef typename util::decay<T>::type result_type;
+        algorithm = detail::select_gather_algorithm<result_type>(
+            result, num_sites, algorithm);
+
+        if (algorithm == gather_algorithm::central)
+        {
+            return gather_there(basename, std::forward<T>(result), generation,
+                root_site, this_site);
+        }
+
+        std::string name(basename);
+        if (generation != std::size_t(-1))
+            name += std::to_string(generation) + "/";
+
+        return hpx::async(&detail::gather_binomial_tree<result_type>,
+            std::move(name), std::forward<T>(result), num_sites, this_site,
+            root_site)
+            .then(hpx::launch::sync,
+                [](hpx::future<std::vector<result_type>>&& f) { f.get(); });
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(char const* basename, hpx::future<T> result,
+        gather_algorithm algorithm, std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1), std::size_t root_site = 0,
+        std::size_t this_site = std::size_t(-1))
+    {
+        // the algorithm can be selected only once the local value is known
+        return result.then(hpx::launch::sync,
+            [name = std::string(basename), algorithm, num_sites, generation,
+                root_site, this_site](hpx::future<T>&& f) {
+                return gather_there(name.c_str(), f.get(), algorithm,
+                    num_sites, generation, root_site, this_site);
+            });
+    }
 }}    // namespace hpx::lcos
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -567,7 +824,13 @@ namespace hpx { namespace lcos {
         HPX_PP_CAT(gather_get_result_action_, name));                          \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         hpx::lcos::detail::gather_server<type>::set_result_action,             \
-        HPX_PP_CAT(set_result_action_, name))                                  \
+        HPX_PP_CAT(set_result_action_, name));                                 \
+    typedef hpx::lcos::detail::communicator_server<std::vector<type>,          \
+        hpx::lcos::detail::gather_tag>                                         \
+        HPX_PP_CAT(gather_communicator_server_, name);                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(gather_communicator_server_, name)::set_action,             \
+        HPX_PP_CAT(gather_communicator_set_action_, name))                     \
     /**/
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -595,6 +858,16 @@ namespace hpx { namespace lcos {
         hpx::lcos::detail::gather_server<type>>                                \
         HPX_PP_CAT(gather_, name);                                             \
     HPX_REGISTER_COMPONENT(HPX_PP_CAT(gather_, name))                          \
+    typedef hpx::lcos::detail::communicator_server<std::vector<type>,          \
+        hpx::lcos::detail::gather_tag>                                         \
+        HPX_PP_CAT(gather_communicator_server_, name);                         \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(gather_communicator_server_, name)::set_action,             \
+        HPX_PP_CAT(gather_communicator_set_action_, name));                    \
+    typedef hpx::components::component<                                        \
+        HPX_PP_CAT(gather_communicator_server_, name)>                         \
+        HPX_PP_CAT(gather_communicator_, name);                                \
+    HPX_REGISTER_COMPONENT(HPX_PP_CAT(gather_communicator_, name))             \
     /**/
 
 #endif    // COMPUTE_HOST_CODE
@@ -11,6 +11,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -18,9 +19,84 @@
 
 char const* all_reduce_basename = "/test/all_reduce/";
 char const* all_reduce_direct_basename = "/test/all_reduce_direct/";
+char const* all_reduce_algorithm_basename = "/test/all_reduce_algorithm/";
+char const* all_reduce_vector_basename = "/test/all_reduce_vector/";
 
+HPX_REGISTER_ALLREDUCE_DECLARATION(std::uint32_t, test_all_reduce);
 HPX_REGISTER_ALLREDUCE(std::uint32_t, test_all_reduce);
 
+using vector_type = std::vector<std::uint32_t>;
+HPX_REGISTER_ALLREDUCE_DECLARATION(vector_type, test_all_reduce_vector);
+HPX_REGISTER_ALLREDUCE(vector_type, test_all_reduce_vector);
+
+struct plus_elementwise
+{
+    vector_type operator()(vector_type lhs, vector_type const& rhs) const
+    {
+        HPX_TEST_EQ(lhs.size(), rhs.size());
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    }
+};
+
+void test_all_reduce_algorithm(
+    hpx::all_reduce_algorithm algorithm, std::uint32_t num_localities)
+{
+    std::uint32_t sum = 0;
+    for (std::uint32_t j = 0; j != num_localities; ++j)
+    {
+        sum += j;
+    }
+
+    // scalar values
+    if (algorithm != hpx::all_reduce_algorithm::ring)
+    {
+        for (int i = 0; i != 10; ++i)
+        {
+            std::string basename = all_reduce_algorithm_basename +
+                std::to_string(static_cast<int>(algorithm)) + "/";
+
+            hpx::future<std::uint32_t> overall_result = hpx::all_reduce(
+                basename.c_str(), hpx::get_locality_id(),
+                std::plus<std::uint32_t>{}, num_localities, i,
+                std::size_t(-1), 0, algorithm);
+
+            HPX_TEST_EQ(sum, overall_result.get());
+        }
+    }
+
+    // vector values, use a size which is not divisible by the number of
+    // sites
+    for (int i = 0; i != 10; ++i)
+    {
+        std::string basename = all_reduce_vector_basename +
+            std::to_string(static_cast<int>(algorithm)) + "/";
+
+        std::uint32_t here = hpx::get_locality_id();
+        vector_type value(1001);
+        for (std::size_t j = 0; j != value.size(); ++j)
+        {
+            value[j] = here + static_cast<std::uint32_t>(j);
+        }
+
+        hpx::future<vector_type> overall_result =
+            hpx::all_reduce(basename.c_str(), hpx::make_ready_future(value),
+                plus_elementwise{}, num_localities, i, std::size_t(-1), 0,
+                algorithm);
+
+        vector_type result = overall_result.get();
+        HPX_TEST_EQ(result.size(), value.size());
+        for (std::size_t j = 0; j != result.size(); ++j)
+        {
+            HPX_TEST_EQ(
+                result[j], sum + num_localities * static_cast<std::uint32_t>(j));
+        }
+    }
+}
+
 int hpx_main(int argc, char* argv[])
 {
     std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
@@ -60,6 +136,15 @@ int hpx_main(int argc, char* argv[])
         HPX_TEST_EQ(sum, overall_result.get());
     }
 
+    // test explicitly selected algorithms
+    test_all_reduce_algorithm(
+        hpx::all_reduce_algorithm::automatic, num_localities);
+    test_all_reduce_algorithm(
+        hpx::all_reduce_algorithm::central, num_localities);
+    test_all_reduce_algorithm(
+        hpx::all_reduce_algorithm::recursive_doubling, num_localities);
+    test_all_reduce_algorithm(hpx::all_reduce_algorithm::ring, num_localities);
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,80 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/collectives/gather.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+char const* gather_basename = "/test/gather/";
+
+HPX_REGISTER_GATHER(std::uint32_t, test_gather);
+
+void test_gather(hpx::lcos::gather_algorithm algorithm,
+    std::uint32_t num_localities, std::uint32_t root_site)
+{
+    std::string basename = gather_basename +
+        std::to_string(static_cast<int>(algorithm)) + "/" +
+        std::to_string(root_site) + "/";
+
+    std::uint32_t here = hpx::get_locality_id();
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::future<std::uint32_t> value = hpx::make_ready_future(here);
+
+        if (here == root_site)
+        {
+            hpx::future<std::vector<std::uint32_t>> overall_result =
+                hpx::lcos::gather_here(basename.c_str(), std::move(value),
+                    algorithm, num_localities, i);
+
+            std::vector<std::uint32_t> sol = overall_result.get();
+            HPX_TEST_EQ(sol.size(), std::size_t(num_localities));
+            for (std::size_t j = 0; j != sol.size(); ++j)
+            {
+                HPX_TEST_EQ(sol[j], std::uint32_t(j));
+            }
+        }
+        else
+        {
+            hpx::future<void> f = hpx::lcos::gather_there(basename.c_str(),
+                std::move(value), algorithm, num_localities, i, root_site);
+            f.get();
+        }
+    }
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+
+    for (std::uint32_t root_site = 0; root_site != num_localities;
+         ++root_site)
+    {
+        test_gather(
+            hpx::lcos::gather_algorithm::automatic, num_localities, root_site);
+        test_gather(
+            hpx::lcos::gather_algorithm::central, num_localities, root_site);
+        test_gather(hpx::lcos::gather_algorithm::binomial_tree,
+            num_localities, root_site);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,196 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_CONCURRENCY_CHASE_LEV_DEQUE_OCT_18_2019_1102AM)
+#define HPX_CONCURRENCY_CHASE_LEV_DEQUE_OCT_18_2019_1102AM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Dynamic circular work-stealing deque as described by Chase and Lev,
+    // using the memory orderings derived by Le, Pop, Cohen and Zappa Nardelli
+    // (Correct and Efficient Work-Stealing for Weak Memory Models, PPoPP'13).
+    //
+    // Exactly one thread (the owner) may call push() and pop(), those operate
+    // on the bottom end of the deque in LIFO order. Any thread may call
+    // steal(), which takes elements from the top end in FIFO order.
+    //
+    // Arrays which were replaced while growing the deque may still be read by
+    // concurrent thieves, they are kept alive until the deque is destroyed.
+    // Since the capacity doubles each time, those use at most as much memory
+    // as the current array.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires a trivially copyable value type");
+
+        struct array
+        {
+            explicit array(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , data_(new std::atomic<T>[std::size_t(capacity)])
+            {
+                HPX_ASSERT((capacity & mask_) == 0);
+            }
+
+            std::int64_t capacity() const
+            {
+                return mask_ + 1;
+            }
+
+            T load(std::int64_t i) const
+            {
+                return data_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void store(std::int64_t i, T const& val)
+            {
+                data_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            std::int64_t const mask_;
+            std::unique_ptr<std::atomic<T>[]> data_;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(std::size_t initial_capacity = 64)
+          : array_(nullptr)
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+
+            std::int64_t capacity = 2;
+            while (capacity < std::int64_t(initial_capacity))
+                capacity <<= 1;
+
+            arrays_.emplace_back(new array(capacity));
+            array_.store(arrays_.back().get(), std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        // Owner only: add an element at the bottom end.
+        void push(T const& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+                a = grow(a, t, b);
+
+            a->store(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Owner only: remove the element most recently pushed.
+        bool pop(T& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->load(b);
+            if (t != b)
+                return true;
+
+            // this is the last element, race against the thieves
+            bool result = top_.data_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return result;
+        }
+
+        // Any thread: remove the least recently pushed element. This fails
+        // if the deque is empty or if another thread took the element first.
+        bool steal(T& val)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return false;
+
+            // memory_order_consume is promoted to acquire by all current
+            // compilers anyways
+            array* a = array_.load(std::memory_order_acquire);
+            T tmp = a->load(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            val = tmp;
+            return true;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        // The returned value is approximate if other threads modify the deque
+        // concurrently.
+        std::size_t size() const
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? std::size_t(b - t) : 0;
+        }
+
+    private:
+        array* grow(array* a, std::int64_t t, std::int64_t b)
+        {
+            std::unique_ptr<array> new_array(new array(2 * a->capacity()));
+            for (std::int64_t i = t; i != b; ++i)
+                new_array->store(i, a->load(i));
+
+            a = new_array.get();
+            arrays_.push_back(std::move(new_array));
+            array_.store(a, std::memory_order_release);
+            return a;
+        }
+
+        // top_ is modified by thieves, bottom_ by the owner only
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+
+        std::atomic<array*> array_;
+
+        // owned by the owner thread, holds the current and all retired arrays
+        std::vector<std::unique_ptr<array>> arrays_;
+    };
+}}    // namespace hpx::concurrency
+
+#endif
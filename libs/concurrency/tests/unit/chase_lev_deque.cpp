@@ -0,0 +1,102 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using deque_type = hpx::concurrency::chase_lev_deque<std::size_t>;
+
+void test_lifo_fifo()
+{
+    deque_type d(2);
+    HPX_TEST(d.empty());
+
+    // force the deque to grow a couple of times
+    for (std::size_t i = 0; i != 100; ++i)
+        d.push(i);
+    HPX_TEST_EQ(d.size(), std::size_t(100));
+
+    std::size_t val = 0;
+
+    // the owner sees the elements in LIFO order
+    HPX_TEST(d.pop(val));
+    HPX_TEST_EQ(val, std::size_t(99));
+
+    // thieves see the elements in FIFO order
+    HPX_TEST(d.steal(val));
+    HPX_TEST_EQ(val, std::size_t(0));
+
+    for (std::size_t i = 98; i != 0; --i)
+    {
+        HPX_TEST(d.pop(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(d.empty());
+    HPX_TEST(!d.pop(val));
+    HPX_TEST(!d.steal(val));
+}
+
+void test_concurrent_steal()
+{
+    std::size_t const num_items = 100000;
+    std::size_t const num_thieves = 4;
+
+    deque_type d;
+    std::vector<std::atomic<int>> seen(num_items);
+    for (auto& s : seen)
+        s.store(0);
+
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::size_t val = 0;
+            while (!done.load())
+            {
+                if (d.steal(val))
+                    ++seen[val];
+            }
+            while (d.steal(val))
+                ++seen[val];
+        });
+    }
+
+    // interleave pushing and popping to exercise the race for the last
+    // element
+    std::size_t val = 0;
+    for (std::size_t i = 0; i != num_items; ++i)
+    {
+        d.push(i);
+        if (i % 3 == 0 && d.pop(val))
+            ++seen[val];
+    }
+    while (d.pop(val))
+        ++seen[val];
+
+    done.store(true);
+    for (std::thread& t : thieves)
+        t.join();
+
+    // every element has to be taken exactly once
+    for (std::size_t i = 0; i != num_items; ++i)
+        HPX_TEST_EQ(seen[i].load(), 1);
+}
+
+int main()
+{
+    test_lifo_fifo();
+    test_concurrent_steal();
+
+    return hpx::util::report_errors();
+}
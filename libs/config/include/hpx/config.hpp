@@ -176,6 +176,12 @@
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+/// This defines the interval (in milliseconds) in which pending reference
+/// counting requests are sent even if their number is below the maximum.
+#if !defined(HPX_INITIAL_AGAS_REFCNT_REQUESTS_FLUSH_INTERVAL)
+#  define HPX_INITIAL_AGAS_REFCNT_REQUESTS_FLUSH_INTERVAL 10
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
@@ -197,6 +197,7 @@ namespace hpx { namespace threads { namespace coroutines {
               , stack_size_((stack_size == -1) ? alloc_.minimum_stacksize() :
                                                  std::size_t(stack_size))
               , stack_pointer_(nullptr)
+              , stack_dirty_since_(0)
             {
             }
 
@@ -247,7 +248,8 @@ namespace hpx { namespace threads { namespace coroutines {
 #if defined(_POSIX_VERSION)
                     void* limit =
                         static_cast<char*>(stack_pointer_) - stack_size_;
-                    if (posix::reset_stack(limit, stack_size_))
+                    if (posix::reset_stack(
+                            limit, stack_size_, stack_dirty_since_))
                     {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
                         increment_stack_unbind_count();
@@ -337,6 +339,7 @@ namespace hpx { namespace threads { namespace coroutines {
             stack_allocator alloc_;
             std::size_t stack_size_;
             void* stack_pointer_;
+            std::int64_t stack_dirty_since_;
         };
     }}    // namespace detail::generic_context
 }}}       // namespace hpx::threads::coroutines
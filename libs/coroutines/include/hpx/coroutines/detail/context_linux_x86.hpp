@@ -202,6 +202,7 @@ namespace hpx { namespace threads { namespace coroutines {
                         static_cast<std::ptrdiff_t>(default_stack_size) :
                         stack_size)
               , m_stack(nullptr)
+              , m_stack_dirty_since(0)
             {
             }
 
@@ -350,7 +351,8 @@ namespace hpx { namespace threads { namespace coroutines {
                         {
                             HPX_ASSERT(m_stack);
                             if (posix::reset_stack(m_stack,
-                                    static_cast<std::size_t>(m_stack_size)))
+                                    static_cast<std::size_t>(m_stack_size),
+                                    m_stack_dirty_since))
                             {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
                                 increment_stack_unbind_count();
@@ -510,6 +512,7 @@ namespace hpx { namespace threads { namespace coroutines {
 
                         std::ptrdiff_t m_stack_size;
                         void* m_stack;
+                        std::int64_t m_stack_dirty_since;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
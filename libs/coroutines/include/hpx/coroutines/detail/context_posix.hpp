@@ -233,6 +233,7 @@ namespace hpx { namespace threads { namespace coroutines {
                         static_cast<std::ptrdiff_t>(default_stack_size) :
                         stack_size)
               , m_stack(nullptr)
+              , m_stack_dirty_since(0)
               , funp_(&trampoline<CoroutineImpl>)
             {
             }
@@ -349,8 +350,9 @@ namespace hpx { namespace threads { namespace coroutines {
             {
                 if (m_stack)
                 {
-                    if (posix::reset_stack(
-                            m_stack, static_cast<std::size_t>(m_stack_size)))
+                    if (posix::reset_stack(m_stack,
+                            static_cast<std::size_t>(m_stack_size),
+                            m_stack_dirty_since))
                     {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
                         increment_stack_unbind_count();
@@ -419,6 +421,7 @@ namespace hpx { namespace threads { namespace coroutines {
             // declare m_stack_size first so we can use it to initialize m_stack
             std::ptrdiff_t m_stack_size;
             void* m_stack;
+            std::int64_t m_stack_dirty_since;
             void (*funp_)(void*);
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION)
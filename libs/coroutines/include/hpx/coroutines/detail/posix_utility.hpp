@@ -33,6 +33,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/coroutines/detail/stack_cache.hpp>
 
 // include unist.d conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -47,6 +48,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -80,6 +82,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         inline void* alloc_stack(std::size_t size)
         {
+            // reuse a stack released earlier on this NUMA domain, this avoids
+            // the mmap() and mprotect() calls below
+            if (void* stack = get_cached_stack(size))
+                return stack;
+
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
@@ -108,6 +115,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
                 }
             }
 
+#if defined(MADV_HUGEPAGE)
+            if (use_huge_pages)
+            {
+                ::madvise(real_stack, size + EXEC_PAGESIZE, MADV_HUGEPAGE);
+            }
+#endif
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
             {
@@ -134,25 +148,44 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
         }
 
-        inline bool reset_stack(void* stack, std::size_t size)
+        // Give all but the first page of the given stack back to the
+        // operating system. We never free up the first page, as it's
+        // initialized only when the stack is created.
+        inline void decommit_stack(void* stack, std::size_t size)
+        {
+            ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+        }
+
+        // Decommit the stack if it has been used beyond its first page and
+        // stayed dirty for longer than the configured decommit delay.
+        // Stacks which are reused frequently stay committed, which avoids
+        // page faults and madvise() calls on every reuse.
+        inline bool reset_stack(
+            void* stack, std::size_t size, std::int64_t& dirty_since)
         {
             void** watermark = static_cast<void**>(stack) +
                 ((size - EXEC_PAGESIZE) / sizeof(void*));
 
-            // If the watermark has been overwritten, then we've gone past the first
-            // page.
-            if ((reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) != *watermark)
-            {
-                // We never free up the first page, as it's initialized only when the
-                // stack is created.
-                ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
-                return true;
-            }
+            // If the watermark has been overwritten, then we've gone past the
+            // first page.
+            if ((reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) == *watermark)
+                return false;
 
-            return false;
+            std::int64_t now = stack_clock();
+            if (dirty_since == 0)
+                dirty_since = now;
+
+            if (now - dirty_since < stack_decommit_delay)
+                return false;
+
+            decommit_stack(stack, size);
+            watermark_stack(stack, size);
+            dirty_since = 0;
+            return true;
         }
 
-        inline void free_stack(void* stack, std::size_t size)
+        // Release the memory of the given stack unconditionally.
+        inline void release_stack(void* stack, std::size_t size)
         {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
@@ -170,6 +203,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif
         }
 
+        inline void free_stack(void* stack, std::size_t size)
+        {
+            if (!cache_stack(stack, size))
+                release_stack(stack, size);
+        }
+
 #else    // non-mmap()
 
         //this should be a fine default.
@@ -199,7 +238,8 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         inline void watermark_stack(void* stack, std::size_t size) {
         }    // no-op
 
-        inline bool reset_stack(void* stack, std::size_t size)
+        inline bool reset_stack(
+            void* stack, std::size_t size, std::int64_t& dirty_since)
         {
             return false;
         }
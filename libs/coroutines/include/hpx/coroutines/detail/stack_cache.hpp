@@ -0,0 +1,57 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_CACHE_HPP
+#define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_CACHE_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+
+    namespace posix {
+        ///////////////////////////////////////////////////////////////////////
+        // These global variables control the behavior of the stack cache,
+        // they are initialized from the [hpx.stacks] configuration section.
+
+        // Maximal number of stacks kept per NUMA domain and stack size. If
+        // this number is exceeded the cache is trimmed down to the low
+        // watermark at once. A value of zero disables the stack cache.
+        HPX_EXPORT extern std::size_t stack_cache_high_watermark;
+        HPX_EXPORT extern std::size_t stack_cache_low_watermark;
+
+        // Time (in milliseconds) a dirty stack stays committed before its
+        // pages are given back to the operating system.
+        HPX_EXPORT extern std::int64_t stack_decommit_delay;
+
+        // Advise the operating system to back thread stacks with
+        // transparent huge pages.
+        HPX_EXPORT extern bool use_huge_pages;
+
+        // Monotonic time in milliseconds used for stack decommit decisions.
+        HPX_EXPORT std::int64_t stack_clock();
+
+        // Retrieve a previously cached stack of the given size which was
+        // allocated on the NUMA domain of the calling thread, returns
+        // nullptr if none is available.
+        HPX_EXPORT void* get_cached_stack(std::size_t size);
+
+        // Hand a stack back to the cache, returns false if the stack was
+        // not taken (the caller has to release it).
+        HPX_EXPORT bool cache_stack(void* stack, std::size_t size);
+    }    // namespace posix
+
+    // Give the pages of stacks which were idle in the cache for longer than
+    // the decommit delay back to the operating system and release stacks
+    // exceeding the low watermark. This is cheap to call frequently, it
+    // returns immediately if the decommit delay has not expired since the
+    // last invocation.
+    HPX_EXPORT void trim_stack_cache();
+}}}}    // namespace hpx::threads::coroutines::detail
+
+#endif /*HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_CACHE_HPP*/
@@ -0,0 +1,285 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_cache.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#define HPX_COROUTINES_HAVE_STACK_CACHE
+#endif
+
+#if defined(HPX_COROUTINES_HAVE_STACK_CACHE)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+
+    namespace posix {
+        std::size_t stack_cache_high_watermark = 1024;
+        std::size_t stack_cache_low_watermark = 256;
+        std::int64_t stack_decommit_delay = 100;
+        bool use_huge_pages = false;
+
+        std::int64_t stack_clock()
+        {
+            // never return zero, it is used to mark clean stacks
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count() +
+                1;
+        }
+    }    // namespace posix
+
+#if defined(HPX_COROUTINES_HAVE_STACK_CACHE)
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        struct cached_stack
+        {
+            void* stack_;
+            std::int64_t released_;
+            bool committed_;
+        };
+
+        // All cached stacks of a given size on one NUMA domain. The most
+        // recently released stacks are handed out first as those are most
+        // likely to still be resident.
+        struct stack_pool
+        {
+            std::size_t size_ = 0;
+            std::vector<cached_stack> stacks_;
+        };
+
+        // We expect only a handful of different stack sizes to be in use
+        // (small, medium, large, huge).
+        constexpr std::size_t max_stack_sizes = 8;
+
+        struct numa_domain_cache
+        {
+            // the synchronization module depends on this one, so we can't
+            // use a spinlock here
+            using mutex_type = std::mutex;
+
+            stack_pool* find_pool(std::size_t size, bool create)
+            {
+                for (stack_pool& p : pools_)
+                {
+                    if (p.size_ == size)
+                        return &p;
+                    if (p.size_ == 0)
+                    {
+                        if (!create)
+                            return nullptr;
+                        p.size_ = size;
+                        return &p;
+                    }
+                }
+                return nullptr;
+            }
+
+            mutex_type mtx_;
+            stack_pool pools_[max_stack_sizes];
+        };
+
+        // This is intentionally never destroyed, thread stacks might be
+        // released during static destruction.
+        numa_domain_cache* get_domains()
+        {
+            static numa_domain_cache* domains =
+                new numa_domain_cache[HPX_HAVE_MAX_NUMA_DOMAIN_COUNT];
+            return domains;
+        }
+
+        // The NUMA domain an OS thread is running on is determined once, HPX
+        // worker threads are usually bound to a processing unit.
+        std::size_t get_numa_domain()
+        {
+            static HPX_NATIVE_TLS std::size_t domain = std::size_t(-1);
+            if (domain == std::size_t(-1))
+            {
+                domain = 0;
+#if defined(SYS_getcpu)
+                unsigned cpu = 0, node = 0;
+                if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+                    domain = node % HPX_HAVE_MAX_NUMA_DOMAIN_COUNT;
+#endif
+            }
+            return domain;
+        }
+
+        void release_stacks(std::vector<cached_stack> const& stacks,
+            std::size_t size)
+        {
+            for (cached_stack const& s : stacks)
+                posix::release_stack(s.stack_, size);
+        }
+    }    // namespace
+
+    namespace posix {
+        void* get_cached_stack(std::size_t size)
+        {
+            if (stack_cache_high_watermark == 0)
+                return nullptr;
+
+            numa_domain_cache& d = get_domains()[get_numa_domain()];
+
+            std::lock_guard<numa_domain_cache::mutex_type> l(d.mtx_);
+            stack_pool* p = d.find_pool(size, false);
+            if (p == nullptr || p->stacks_.empty())
+                return nullptr;
+
+            void* stack = p->stacks_.back().stack_;
+            p->stacks_.pop_back();
+            return stack;
+        }
+
+        bool cache_stack(void* stack, std::size_t size)
+        {
+            if (stack_cache_high_watermark == 0)
+                return false;
+
+            numa_domain_cache& d = get_domains()[get_numa_domain()];
+
+            std::vector<cached_stack> to_release;
+            {
+                std::lock_guard<numa_domain_cache::mutex_type> l(d.mtx_);
+                stack_pool* p = d.find_pool(size, true);
+                if (p == nullptr)
+                    return false;
+
+                if (p->stacks_.size() < stack_cache_high_watermark)
+                {
+                    p->stacks_.push_back(
+                        cached_stack{stack, stack_clock(), true});
+                    return true;
+                }
+
+                // trim the cache down to the low watermark, the oldest
+                // stacks are released first
+                std::size_t count = p->stacks_.size() -
+                    (std::min)(stack_cache_low_watermark, p->stacks_.size());
+                to_release.assign(
+                    p->stacks_.begin(), p->stacks_.begin() + count);
+                p->stacks_.erase(
+                    p->stacks_.begin(), p->stacks_.begin() + count);
+                p->stacks_.push_back(cached_stack{stack, stack_clock(), true});
+            }
+
+            release_stacks(to_release, size);
+            return true;
+        }
+    }    // namespace posix
+
+    void trim_stack_cache()
+    {
+        static std::atomic<std::int64_t> last_trim(0);
+
+        std::int64_t now = posix::stack_clock();
+        std::int64_t last = last_trim.load(std::memory_order_relaxed);
+        if (now - last < posix::stack_decommit_delay ||
+            !last_trim.compare_exchange_strong(last, now))
+        {
+            return;
+        }
+
+        numa_domain_cache* domains = get_domains();
+        for (std::size_t i = 0; i != HPX_HAVE_MAX_NUMA_DOMAIN_COUNT; ++i)
+        {
+            numa_domain_cache& d = domains[i];
+            std::unique_lock<numa_domain_cache::mutex_type> l(
+                d.mtx_, std::try_to_lock);
+            if (!l)
+                continue;
+
+            for (stack_pool& p : d.pools_)
+            {
+                if (p.size_ == 0)
+                    break;
+
+                // the stacks are ordered by the time they were released, the
+                // idle ones are at the front
+                std::size_t idle = 0;
+                while (idle != p.stacks_.size() &&
+                    now - p.stacks_[idle].released_ >=
+                        posix::stack_decommit_delay)
+                {
+                    ++idle;
+                }
+                if (idle == 0)
+                    continue;
+
+                // take the idle stacks out of the pool to avoid holding the
+                // lock while talking to the operating system
+                std::vector<cached_stack> stacks(
+                    p.stacks_.begin(), p.stacks_.begin() + idle);
+                p.stacks_.erase(p.stacks_.begin(), p.stacks_.begin() + idle);
+
+                // release idle stacks exceeding the low watermark
+                std::size_t keep = 0;
+                if (p.stacks_.size() < posix::stack_cache_low_watermark)
+                {
+                    keep = (std::min)(idle,
+                        posix::stack_cache_low_watermark - p.stacks_.size());
+                }
+
+                l.unlock();
+
+                std::vector<cached_stack> to_release(
+                    stacks.begin(), stacks.begin() + (idle - keep));
+                release_stacks(to_release, p.size_);
+                stacks.erase(stacks.begin(), stacks.begin() + (idle - keep));
+
+                // decommit the remaining idle stacks
+                for (cached_stack& s : stacks)
+                {
+                    if (s.committed_)
+                    {
+                        posix::decommit_stack(s.stack_, p.size_);
+                        s.committed_ = false;
+                    }
+                }
+
+                l.lock();
+                p.stacks_.insert(
+                    p.stacks_.begin(), stacks.begin(), stacks.end());
+            }
+        }
+    }
+#else
+    namespace posix {
+        void* get_cached_stack(std::size_t size)
+        {
+            return nullptr;
+        }
+
+        bool cache_stack(void* stack, std::size_t size)
+        {
+            return false;
+        }
+    }    // namespace posix
+
+    void trim_stack_cache() {}
+#endif
+}}}}    // namespace hpx::threads::coroutines::detail
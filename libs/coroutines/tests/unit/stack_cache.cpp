@@ -0,0 +1,103 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_cache.hpp>
+#include <hpx/testing.hpp>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+std::size_t const stack_size = 16 * EXEC_PAGESIZE;
+
+void test_reuse()
+{
+    posix::stack_cache_high_watermark = 4;
+    posix::stack_cache_low_watermark = 2;
+
+    // a released stack is handed out again
+    void* stack = posix::alloc_stack(stack_size);
+    posix::free_stack(stack, stack_size);
+    HPX_TEST_EQ(posix::alloc_stack(stack_size), stack);
+
+    // stacks of a different size are not mixed up
+    void* other = posix::alloc_stack(2 * stack_size);
+    HPX_TEST_NEQ(other, stack);
+    posix::free_stack(other, 2 * stack_size);
+    posix::free_stack(stack, stack_size);
+
+    // exceeding the high watermark trims the cache to the low watermark
+    std::vector<void*> stacks;
+    for (int i = 0; i != 6; ++i)
+    {
+        stacks.push_back(posix::alloc_stack(stack_size));
+    }
+    for (void* s : stacks)
+    {
+        posix::free_stack(s, stack_size);
+    }
+
+    // the most recently released stacks are handed out first
+    HPX_TEST_EQ(posix::alloc_stack(stack_size), stacks[5]);
+    HPX_TEST_EQ(posix::alloc_stack(stack_size), stacks[4]);
+    posix::free_stack(stacks[4], stack_size);
+    posix::free_stack(stacks[5], stack_size);
+}
+
+void test_lazy_decommit()
+{
+    void* stack = posix::alloc_stack(stack_size);
+    posix::watermark_stack(stack, stack_size);
+
+    std::int64_t dirty_since = 0;
+
+    // a stack which was not used beyond its first page is left alone
+    posix::stack_decommit_delay = 0;
+    HPX_TEST(!posix::reset_stack(stack, stack_size, dirty_since));
+    HPX_TEST_EQ(dirty_since, std::int64_t(0));
+
+    // a dirty stack stays committed until the decommit delay has expired
+    std::memset(stack, 0xff, stack_size);
+    posix::stack_decommit_delay = 1000000;
+    HPX_TEST(!posix::reset_stack(stack, stack_size, dirty_since));
+    HPX_TEST_NEQ(dirty_since, std::int64_t(0));
+
+    posix::stack_decommit_delay = 0;
+    HPX_TEST(posix::reset_stack(stack, stack_size, dirty_since));
+    HPX_TEST_EQ(dirty_since, std::int64_t(0));
+
+    // decommitted pages read as zero
+    HPX_TEST_EQ(*static_cast<char*>(stack), 0);
+
+    posix::free_stack(stack, stack_size);
+    hpx::threads::coroutines::detail::trim_stack_cache();
+}
+
+int main()
+{
+    test_reuse();
+    test_lazy_decommit();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
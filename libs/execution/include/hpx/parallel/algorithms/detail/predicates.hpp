@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_fused.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 
 #include <hpx/parallel/algorithms/detail/is_negative.hpp>
@@ -296,6 +297,74 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         Value value_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Negates the result of the wrapped predicate, this works for the masks
+    // returned by predicates which are invoked with vector packs as well.
+    template <typename F>
+    struct not_predicate
+    {
+        HPX_HOST_DEVICE explicit not_predicate(F const& f)
+          : f_(f)
+        {
+        }
+        HPX_HOST_DEVICE explicit not_predicate(F&& f)
+          : f_(std::move(f))
+        {
+        }
+
+        template <typename... Ts>
+        HPX_HOST_DEVICE HPX_FORCEINLINE auto operator()(Ts&&... ts)
+            -> decltype(!hpx::util::invoke(
+                std::declval<F&>(), std::forward<Ts>(ts)...))
+        {
+            return !hpx::util::invoke(f_, std::forward<Ts>(ts)...);
+        }
+
+        F f_;
+    };
+
+    template <typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE not_predicate<typename std::decay<F>::type>
+    make_not_predicate(F&& f)
+    {
+        return not_predicate<typename std::decay<F>::type>(std::forward<F>(f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invokes the wrapped predicate with the elements of a tuple, this is
+    // used for the algorithms operating on zipped sequences.
+    template <typename F>
+    struct fused_predicate
+    {
+        HPX_HOST_DEVICE explicit fused_predicate(F const& f)
+          : f_(f)
+        {
+        }
+        HPX_HOST_DEVICE explicit fused_predicate(F&& f)
+          : f_(std::move(f))
+        {
+        }
+
+        template <typename Tuple>
+        HPX_HOST_DEVICE HPX_FORCEINLINE auto operator()(Tuple&& t)
+            -> decltype(hpx::util::invoke_fused(
+                std::declval<F&>(), std::forward<Tuple>(t)))
+        {
+            return hpx::util::invoke_fused(f_, std::forward<Tuple>(t));
+        }
+
+        F f_;
+    };
+
+    template <typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+        fused_predicate<typename std::decay<F>::type>
+        make_fused_predicate(F&& f)
+    {
+        return fused_predicate<typename std::decay<F>::type>(
+            std::forward<F>(f));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct less
     {
@@ -11,6 +11,7 @@
 
 #include <hpx/parallel/executors/default_executor.hpp>
 #include <hpx/parallel/executors/distribution_policy_executor.hpp>
+#include <hpx/parallel/executors/fork_join_executor.hpp>
 #include <hpx/parallel/executors/parallel_executor.hpp>
 #include <hpx/parallel/executors/parallel_executor_aggregated.hpp>
 #include <hpx/parallel/executors/pool_executor.hpp>
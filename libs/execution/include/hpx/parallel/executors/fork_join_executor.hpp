@@ -0,0 +1,564 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/fork_join_executor.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_FORK_JOIN_EXECUTOR_NOV_11_2019_1012AM)
+#define HPX_PARALLEL_EXECUTORS_FORK_JOIN_EXECUTOR_NOV_11_2019_1012AM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/async_launch_policy_dispatch.hpp>
+#include <hpx/basic_execution/this_thread.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/post_policy_dispatch.hpp>
+#include <hpx/parallel/executors/static_chunk_size.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/threads/register_thread.hpp>
+#include <hpx/runtime/threads/thread_pool_base.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/traits/is_executor.hpp>
+#include <hpx/util/unwrap.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { namespace execution {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The team of worker threads shared by all copies of a
+        // fork_join_executor. One worker is pinned to every core of the pool
+        // but the one the team was created on, the thread starting a parallel
+        // region takes that place. The elements of a region are handed out
+        // one at a time through an atomic counter and the region ends once
+        // all workers have run out of elements.
+        class fork_join_team
+        {
+        public:
+            typedef void (*region_function_type)(void*, std::size_t);
+
+            fork_join_team(threads::thread_pool_base* pool,
+                threads::thread_priority priority)
+              : pool_(pool)
+              , num_workers_(0)
+              , region_f_(nullptr)
+              , region_data_(nullptr)
+              , region_size_(0)
+              , stop_(false)
+              , busy_(false)
+            {
+                std::size_t num_threads = pool_->get_os_thread_count();
+                if (num_threads <= 1)
+                    return;
+
+                std::size_t home = hpx::get_worker_thread_num() -
+                    pool_->get_thread_offset();
+                if (home >= num_threads)
+                    home = 0;
+
+                hpx::util::thread_description desc(
+                    "hpx::parallel::execution::fork_join_executor::worker");
+
+                for (std::size_t i = 0; i != num_threads; ++i)
+                {
+                    if (i == home)
+                        continue;
+
+                    // the worker counts as active until it has exited
+                    active_.data_.fetch_add(1, std::memory_order_relaxed);
+                    ++num_workers_;
+
+                    threads::register_thread_nullary(pool_,
+                        [this]() { worker(); }, desc, threads::pending, false,
+                        priority,
+                        threads::thread_schedule_hint(
+                            static_cast<std::int16_t>(i)));
+                }
+
+                // wait for all workers to be up and running, no region may be
+                // published before that
+                spin_while([this]() {
+                    return active_.data_.load(std::memory_order_acquire) != 0;
+                });
+            }
+
+            ~fork_join_team()
+            {
+                if (num_workers_ == 0)
+                    return;
+
+                active_.data_.store(num_workers_, std::memory_order_relaxed);
+                stop_ = true;
+                generation_.data_.fetch_add(1, std::memory_order_release);
+
+                spin_while([this]() {
+                    return active_.data_.load(std::memory_order_acquire) != 0;
+                });
+            }
+
+            fork_join_team(fork_join_team const&) = delete;
+            fork_join_team& operator=(fork_join_team const&) = delete;
+
+            // the number of threads participating in a parallel region
+            std::size_t size() const
+            {
+                return num_workers_ + 1;
+            }
+
+            threads::thread_pool_base* get_thread_pool() const
+            {
+                return pool_;
+            }
+
+            // Invoke f(data, i) for all i in [0, size) using all threads of
+            // the team. Returns only after all invocations have completed.
+            void run(region_function_type f, void* data, std::size_t size)
+            {
+                // regions started while another one is running (from
+                // inside the region or concurrently from a different
+                // thread) are executed by the calling thread only
+                if (num_workers_ == 0 || size <= 1 ||
+                    busy_.exchange(true, std::memory_order_acquire))
+                {
+                    for (std::size_t i = 0; i != size; ++i)
+                        f(data, i);
+                    return;
+                }
+
+                region_f_ = f;
+                region_data_ = data;
+                region_size_ = size;
+                next_.data_.store(0, std::memory_order_relaxed);
+                active_.data_.store(num_workers_, std::memory_order_relaxed);
+
+                // publish the region to the workers
+                generation_.data_.fetch_add(1, std::memory_order_release);
+
+                execute_region();
+
+                // join with the workers, the region data lives on the stack
+                // of the caller
+                spin_while([this]() {
+                    return active_.data_.load(std::memory_order_acquire) != 0;
+                });
+
+                busy_.store(false, std::memory_order_release);
+            }
+
+        private:
+            template <typename Predicate>
+            static void spin_while(Predicate&& pred)
+            {
+                for (std::size_t k = 0; pred(); ++k)
+                {
+                    hpx::basic_execution::this_thread::yield_k(k % 64,
+                        "hpx::parallel::execution::fork_join_executor");
+                }
+            }
+
+            void execute_region()
+            {
+                std::size_t i =
+                    next_.data_.fetch_add(1, std::memory_order_relaxed);
+                while (i < region_size_)
+                {
+                    region_f_(region_data_, i);
+                    i = next_.data_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            void worker()
+            {
+                std::size_t generation =
+                    generation_.data_.load(std::memory_order_relaxed);
+
+                active_.data_.fetch_sub(1, std::memory_order_release);
+
+                for (;;)
+                {
+                    spin_while([this, generation]() {
+                        return generation_.data_.load(
+                                   std::memory_order_acquire) == generation;
+                    });
+                    ++generation;
+
+                    if (stop_)
+                        break;
+
+                    execute_region();
+                    active_.data_.fetch_sub(1, std::memory_order_release);
+                }
+
+                // the team may be destroyed as soon as this is visible
+                active_.data_.fetch_sub(1, std::memory_order_release);
+            }
+
+            threads::thread_pool_base* pool_;
+            std::size_t num_workers_;
+
+            // description of the active region, written by the thread
+            // starting the region before the generation is advanced
+            region_function_type region_f_;
+            void* region_data_;
+            std::size_t region_size_;
+            bool stop_;
+
+            hpx::util::cache_line_data<std::atomic<std::size_t>> generation_;
+            hpx::util::cache_line_data<std::atomic<std::size_t>> next_;
+            hpx::util::cache_line_data<std::atomic<std::size_t>> active_;
+            std::atomic<bool> busy_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Element access for the shapes passed to the bulk functions, shapes
+        // which are not random access are copied first.
+        template <typename S, typename Enable = void>
+        struct fork_join_shape
+        {
+            typedef typename hpx::traits::range_traits<S>::value_type
+                value_type;
+
+            explicit fork_join_shape(S const& shape)
+              : elements_(hpx::util::begin(shape), hpx::util::end(shape))
+            {
+            }
+
+            std::size_t size() const
+            {
+                return elements_.size();
+            }
+
+            value_type const& operator[](std::size_t i) const
+            {
+                return elements_[i];
+            }
+
+            std::vector<value_type> elements_;
+        };
+
+        template <typename S>
+        struct fork_join_shape_iterator
+        {
+            typedef decltype(hpx::util::begin(std::declval<S const&>())) type;
+        };
+
+        template <typename S>
+        struct fork_join_shape<S,
+            typename std::enable_if<
+                std::is_base_of<std::random_access_iterator_tag,
+                    typename std::iterator_traits<typename
+                        fork_join_shape_iterator<S>::type>::iterator_category>::
+                    value>::type>
+        {
+            typedef typename fork_join_shape_iterator<S>::type iterator_type;
+
+            explicit fork_join_shape(S const& shape)
+              : first_(hpx::util::begin(shape))
+              , size_(hpx::util::size(shape))
+            {
+            }
+
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+            typename std::iterator_traits<iterator_type>::reference operator[](
+                std::size_t i) const
+            {
+                return first_[i];
+            }
+
+            iterator_type first_;
+            std::size_t size_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a fork_join_executor runs bulk operations on a team of worker
+    /// threads which is created once, when the executor is constructed. The
+    /// workers are bound to the cores of the thread pool and wait for work in
+    /// between parallel regions. A bulk operation hands the elements of its
+    /// shape to the workers through a shared counter and returns once all of
+    /// them have been processed, no tasks and no futures are created for the
+    /// individual elements.
+    ///
+    /// This executor is meant for short parallel loops which are run many
+    /// times, e.g. inside of a time step loop, where the overheads of
+    /// spawning tasks would dominate. The workers keep their cores busy while
+    /// the executor is alive; other work scheduled on the same pool is
+    /// executed only while the workers are yielding. All copies of an
+    /// executor share the same team.
+    ///
+    /// This executor conforms to the concepts of a TwoWayExecutor,
+    /// a BulkOneWayExecutor, and a BulkTwoWayExecutor
+    class fork_join_executor
+    {
+    public:
+        /// Associate the parallel_execution_tag executor tag type as a default
+        /// with this executor.
+        typedef parallel_execution_tag execution_category;
+
+        /// Associate the static_chunk_size executor parameters type as a default
+        /// with this executor.
+        typedef static_chunk_size executor_parameters_type;
+
+        /// Create a new fork_join_executor, this starts the worker threads
+        ///
+        /// \param priority [in] The priority of the worker threads.
+        /// \param pool     [in] The thread pool the workers are created on.
+        ///
+        explicit fork_join_executor(
+            threads::thread_priority priority = threads::thread_priority_normal,
+            threads::thread_pool_base* pool =
+                threads::detail::get_self_or_default_pool())
+          : team_(std::make_shared<detail::fork_join_team>(pool, priority))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(fork_join_executor const& rhs) const noexcept
+        {
+            return team_ == rhs.team_;
+        }
+
+        bool operator!=(fork_join_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        fork_join_executor const& context() const noexcept
+        {
+            return *this;
+        }
+
+        std::size_t processing_units_count() const
+        {
+            return team_->size();
+        }
+        /// \endcond
+
+        /// \cond NOINTERNAL
+
+        // OneWayExecutor interface
+        template <typename F, typename... Ts>
+        typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        sync_execute(F&& f, Ts&&... ts) const
+        {
+            return hpx::util::invoke(
+                std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type>
+        async_execute(F&& f, Ts&&... ts) const
+        {
+            return hpx::detail::async_launch_policy_dispatch<
+                hpx::launch::async_policy>::call(hpx::launch::async,
+                team_->get_thread_pool(), threads::thread_schedule_hint(),
+                std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
+        // NonBlockingOneWayExecutor (adapted) interface
+        template <typename F, typename... Ts>
+        void post(F&& f, Ts&&... ts) const
+        {
+            hpx::util::thread_description desc(
+                f, "hpx::parallel::execution::fork_join_executor::post");
+
+            detail::post_policy_dispatch<hpx::launch::async_policy>::call(
+                hpx::launch::async, desc, team_->get_thread_pool(),
+                threads::thread_schedule_hint(), std::forward<F>(f),
+                std::forward<Ts>(ts)...);
+        }
+
+        // BulkOneWayExecutor interface
+        template <typename F, typename S, typename... Ts>
+        typename detail::bulk_execute_result<F, S, Ts...>::type
+        bulk_sync_execute(F&& f, S const& shape, Ts&&... ts) const
+        {
+            typedef typename detail::bulk_function_result<F, S, Ts...>::type
+                result_type;
+
+            return bulk_sync_execute_impl(std::is_void<result_type>(),
+                std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+        }
+
+        // BulkTwoWayExecutor interface
+        //
+        // The bulk operation is executed before this function returns. All
+        // elements of a bulk operation invoking a function returning void
+        // are represented by a single future which holds the first
+        // exception thrown, if any.
+        template <typename F, typename S, typename... Ts>
+        std::vector<hpx::future<
+            typename detail::bulk_function_result<F, S, Ts...>::type>>
+        bulk_async_execute(F&& f, S const& shape, Ts&&... ts) const
+        {
+            typedef typename detail::bulk_function_result<F, S, Ts...>::type
+                result_type;
+
+            return bulk_async_execute_impl(std::is_void<result_type>(),
+                std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename Region>
+        static void invoke_region(void* region, std::size_t i)
+        {
+            (*static_cast<Region*>(region))(i);
+        }
+
+        template <typename Region>
+        void run(Region& region, std::size_t size) const
+        {
+            team_->run(&invoke_region<Region>, &region, size);
+        }
+
+        template <typename F, typename S, typename... Ts>
+        void bulk_sync_execute_impl(
+            std::true_type, F&& f, S const& shape, Ts&&... ts) const
+        {
+            detail::fork_join_shape<S> elements(shape);
+
+            std::exception_ptr e;
+            lcos::local::spinlock mtx_e;
+
+            auto region = [&](std::size_t i) {
+                // properly handle all exceptions thrown from 'f'
+                try
+                {
+                    hpx::util::invoke(f, elements[i], ts...);
+                }
+                catch (...)
+                {
+                    // store the first caught exception only
+                    std::lock_guard<lcos::local::spinlock> l(mtx_e);
+                    if (!e)
+                        e = std::current_exception();
+                }
+            };
+            run(region, elements.size());
+
+            // rethrow any exceptions caught during processing the region,
+            // all threads have left the region at this point
+            if (e)
+            {
+                std::rethrow_exception(std::move(e));
+            }
+        }
+
+        template <typename F, typename S, typename... Ts>
+        std::vector<
+            typename detail::bulk_function_result<F, S, Ts...>::type>
+        bulk_sync_execute_impl(
+            std::false_type, F&& f, S const& shape, Ts&&... ts) const
+        {
+            return hpx::util::unwrap(bulk_async_execute_impl(std::false_type(),
+                std::forward<F>(f), shape, std::forward<Ts>(ts)...));
+        }
+
+        template <typename F, typename S, typename... Ts>
+        std::vector<hpx::future<void>> bulk_async_execute_impl(
+            std::true_type, F&& f, S const& shape, Ts&&... ts) const
+        {
+            std::vector<hpx::future<void>> results;
+            try
+            {
+                bulk_sync_execute_impl(std::true_type(), std::forward<F>(f),
+                    shape, std::forward<Ts>(ts)...);
+                results.push_back(hpx::make_ready_future());
+            }
+            catch (...)
+            {
+                results.push_back(
+                    hpx::make_exceptional_future<void>(std::current_exception()));
+            }
+            return results;
+        }
+
+        template <typename F, typename S, typename... Ts>
+        std::vector<hpx::future<
+            typename detail::bulk_function_result<F, S, Ts...>::type>>
+        bulk_async_execute_impl(
+            std::false_type, F&& f, S const& shape, Ts&&... ts) const
+        {
+            typedef typename detail::bulk_function_result<F, S, Ts...>::type
+                result_type;
+
+            detail::fork_join_shape<S> elements(shape);
+
+            std::vector<hpx::future<result_type>> results(elements.size());
+
+            auto region = [&](std::size_t i) {
+                // every element is written by exactly one thread
+                try
+                {
+                    results[i] = hpx::make_ready_future(
+                        hpx::util::invoke(f, elements[i], ts...));
+                }
+                catch (...)
+                {
+                    results[i] = hpx::make_exceptional_future<result_type>(
+                        std::current_exception());
+                }
+            };
+            run(region, elements.size());
+
+            return results;
+        }
+
+        std::shared_ptr<detail::fork_join_team> team_;
+        /// \endcond
+    };
+}}}    // namespace hpx::parallel::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<parallel::execution::fork_join_executor>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct is_two_way_executor<parallel::execution::fork_join_executor>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct is_bulk_one_way_executor<parallel::execution::fork_join_executor>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct is_bulk_two_way_executor<parallel::execution::fork_join_executor>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
+
+#endif
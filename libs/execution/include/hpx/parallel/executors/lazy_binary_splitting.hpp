@@ -0,0 +1,90 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/lazy_binary_splitting.hpp
+
+#if !defined(HPX_PARALLEL_LAZY_BINARY_SPLITTING_NOV_13_2019_0918AM)
+#define HPX_PARALLEL_LAZY_BINARY_SPLITTING_NOV_13_2019_0918AM
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx { namespace parallel { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects lazy binary splitting for the algorithms iterating over their
+    /// input without combining intermediate results (for_each, for_each_n,
+    /// copy, move, transform, etc.). Instead of dividing the input into
+    /// chunks up front, the range is handed to a single task which processes
+    /// it in blocks of \a grain_size iterations. Before each block the task
+    /// checks whether worker threads are idle, i.e. whether fewer tasks are
+    /// waiting in the queues of the scheduler than there are cores. If so,
+    /// the second half of the remaining range is split off into a new task,
+    /// which continues in the same way.
+    ///
+    /// This adapts the partitioning to loops with irregular cost per
+    /// iteration, where any fixed choice of chunks leaves cores idle at the
+    /// end of the loop.
+    ///
+    /// \note All other algorithms divide their input up front, as if no
+    ///       executor parameters were given.
+    ///
+    struct lazy_binary_splitting
+    {
+        /// Construct a \a lazy_binary_splitting executor parameters object
+        ///
+        /// \param grain_size   [in] The optional number of loop iterations
+        ///                     executed between two checks for idle worker
+        ///                     threads. By default the input is divided into
+        ///                     64 blocks per core.
+        ///
+        HPX_CONSTEXPR explicit lazy_binary_splitting(std::size_t grain_size = 0)
+          : grain_size_(grain_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type selects lazy binary splitting
+        typedef std::true_type has_lazy_splitting;
+
+        HPX_CONSTEXPR std::size_t get_grain_size() const
+        {
+            return grain_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int version)
+        {
+            ar& grain_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t grain_size_;
+        /// \endcond
+    };
+}}}    // namespace hpx::parallel::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<parallel::execution::lazy_binary_splitting>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
+
+#endif
@@ -0,0 +1,87 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/single_pass_scan.hpp
+
+#if !defined(HPX_PARALLEL_SINGLE_PASS_SCAN_OCT_19_2019_0245PM)
+#define HPX_PARALLEL_SINGLE_PASS_SCAN_OCT_19_2019_0245PM
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx { namespace parallel { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects the single-pass scan for all algorithms based on a scan
+    /// (inclusive_scan, exclusive_scan, transform_inclusive_scan,
+    /// transform_exclusive_scan, copy_if, remove, unique, partition_copy,
+    /// etc.). The input is divided into chunks of \a chunk_size elements
+    /// which are claimed by the participating threads in order. Each chunk
+    /// determines the sum of the chunks before it by looking back at the
+    /// results published by its predecessors (decoupled look-back) instead of
+    /// waiting for a separate pass combining the results of all chunks. The
+    /// chunks are small enough to stay in the cache until their final
+    /// results are written, which avoids reading the input twice.
+    ///
+    /// This executor parameters type can be combined with other executor
+    /// parameters, their chunk size is not used by the scan algorithms.
+    ///
+    struct single_pass_scan
+    {
+        /// Construct a \a single_pass_scan executor parameters object
+        ///
+        /// \param chunk_size   [in] The optional number of elements handled
+        ///                     by each chunk of the scan. By default a chunk
+        ///                     size keeping the data of one chunk in the
+        ///                     cache is chosen.
+        ///
+        HPX_CONSTEXPR explicit single_pass_scan(std::size_t chunk_size = 0)
+          : scan_chunk_size_(chunk_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type selects the single-pass scan
+        typedef std::true_type has_single_pass_scan;
+
+        HPX_CONSTEXPR std::size_t get_scan_chunk_size() const
+        {
+            return scan_chunk_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int version)
+        {
+            ar& scan_chunk_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t scan_chunk_size_;
+        /// \endcond
+    };
+}}}    // namespace hpx::parallel::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<parallel::execution::single_pass_scan>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
+
+#endif
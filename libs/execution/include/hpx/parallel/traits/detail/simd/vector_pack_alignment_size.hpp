@@ -0,0 +1,75 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(                                                                  \
+    HPX_PARALLEL_TRAITS_VECTOR_PACK_ALIGNMENT_SIZE_SIMD_NOV_06_2019_1014AM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_ALIGNMENT_SIZE_SIMD_NOV_06_2019_1014AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+#include <cstddef>
+#include <type_traits>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    struct is_vector_pack<std::experimental::simd<T, Abi>> : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    struct is_scalar_vector_pack<std::experimental::simd<T, Abi>>
+      : std::integral_constant<bool,
+            std::experimental::simd_size<T, Abi>::value == 1>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    struct is_non_scalar_vector_pack<std::experimental::simd<T, Abi>>
+      : std::integral_constant<bool,
+            std::experimental::simd_size<T, Abi>::value != 1>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable>
+    struct vector_pack_alignment
+    {
+        static std::size_t const value = std::experimental::memory_alignment<
+            std::experimental::native_simd<T>>::value;
+    };
+
+    template <typename T, typename Abi>
+    struct vector_pack_alignment<std::experimental::simd<T, Abi>>
+    {
+        static std::size_t const value = std::experimental::memory_alignment<
+            std::experimental::simd<T, Abi>>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable>
+    struct vector_pack_size
+    {
+        static std::size_t const value =
+            std::experimental::native_simd<T>::size();
+    };
+
+    template <typename T, typename Abi>
+    struct vector_pack_size<std::experimental::simd<T, Abi>>
+    {
+        static std::size_t const value =
+            std::experimental::simd_size<T, Abi>::value;
+    };
+}}}    // namespace hpx::parallel::traits
+
+#endif
+#endif
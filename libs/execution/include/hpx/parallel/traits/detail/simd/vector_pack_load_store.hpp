@@ -0,0 +1,82 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_TRAITS_VECTOR_PACK_LOAD_SIMD_NOV_06_2019_1018AM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_LOAD_SIMD_NOV_06_2019_1018AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // the rebound pack has the same number of elements as the original one
+    template <typename T, typename Abi, typename NewT>
+    struct rebind_pack<std::experimental::simd<T, Abi>, NewT>
+    {
+        typedef std::experimental::rebind_simd_t<NewT,
+            std::experimental::simd<T, Abi>>
+            type;
+    };
+
+    // don't wrap types twice
+    template <typename T, typename Abi1, typename NewT, typename Abi2>
+    struct rebind_pack<std::experimental::simd<T, Abi1>,
+        std::experimental::simd<NewT, Abi2>>
+    {
+        typedef std::experimental::simd<NewT, Abi2> type;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_load
+    {
+        typedef typename rebind_pack<V, ValueType>::type value_type;
+
+        template <typename Iter>
+        static value_type aligned(Iter const& iter)
+        {
+            return value_type(
+                std::addressof(*iter), std::experimental::vector_aligned);
+        }
+
+        template <typename Iter>
+        static value_type unaligned(Iter const& iter)
+        {
+            return value_type(
+                std::addressof(*iter), std::experimental::element_aligned);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_store
+    {
+        template <typename Iter>
+        static void aligned(V const& value, Iter const& iter)
+        {
+            value.copy_to(
+                std::addressof(*iter), std::experimental::vector_aligned);
+        }
+
+        template <typename Iter>
+        static void unaligned(V const& value, Iter const& iter)
+        {
+            value.copy_to(
+                std::addressof(*iter), std::experimental::element_aligned);
+        }
+    };
+}}}    // namespace hpx::parallel::traits
+
+#endif
+#endif
@@ -71,6 +71,7 @@ namespace hpx { namespace parallel { namespace traits {
 
 #if !defined(__CUDACC__)
 #include <hpx/parallel/traits/detail/vc/vector_pack_alignment_size.hpp>
+#include <hpx/parallel/traits/detail/simd/vector_pack_alignment_size.hpp>
 #endif
 
 #endif
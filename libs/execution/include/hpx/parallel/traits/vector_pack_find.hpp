@@ -0,0 +1,36 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_TRAITS_VECTOR_PACK_FIND_NOV_08_2019_0214PM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_FIND_NOV_08_2019_0214PM
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    // Returns whether any of the elements of the given mask is set
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool any_of(bool value)
+    {
+        return value;
+    }
+
+    // Returns the index of the first element of the given mask which is set,
+    // or -1 if none is set
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_set(bool value)
+    {
+        return value ? 0 : -1;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/parallel/traits/detail/vc/vector_pack_find.hpp>
+#include <hpx/parallel/traits/detail/simd/vector_pack_find.hpp>
+#endif
+
+#endif
+#endif
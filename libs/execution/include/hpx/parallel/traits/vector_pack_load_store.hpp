@@ -27,6 +27,7 @@ namespace hpx { namespace parallel { namespace traits {
 
 #if !defined(__CUDACC__)
 #include <hpx/parallel/traits/detail/vc/vector_pack_load_store.hpp>
+#include <hpx/parallel/traits/detail/simd/vector_pack_load_store.hpp>
 #endif
 
 #endif
@@ -69,6 +69,45 @@ namespace hpx { namespace parallel { namespace execution {
         using type = typename Parameters::has_variable_chunk_size;
     };
 
+    ///////////////////////////////////////////////////////////////////////
+    // If a parameters type exposes 'has_single_pass_scan' aliased to
+    // std::true_type the scan based algorithms use a single pass over the
+    // data, the parameters type has to expose get_scan_chunk_size().
+    template <typename Parameters, typename Enable = void>
+    struct extract_has_single_pass_scan
+    {
+        // by default, use the multi-pass scan
+        using type = std::false_type;
+    };
+
+    template <typename Parameters>
+    struct extract_has_single_pass_scan<Parameters,
+        typename hpx::util::always_void<
+            typename Parameters::has_single_pass_scan>::type>
+    {
+        using type = typename Parameters::has_single_pass_scan;
+    };
+
+    ///////////////////////////////////////////////////////////////////////
+    // If a parameters type exposes 'has_lazy_splitting' aliased to
+    // std::true_type the algorithms iterating over their input split the
+    // range lazily whenever idle cores are detected, the parameters type has
+    // to expose get_grain_size().
+    template <typename Parameters, typename Enable = void>
+    struct extract_has_lazy_splitting
+    {
+        // by default, divide the input into chunks up front
+        using type = std::false_type;
+    };
+
+    template <typename Parameters>
+    struct extract_has_lazy_splitting<Parameters,
+        typename hpx::util::always_void<
+            typename Parameters::has_lazy_splitting>::type>
+    {
+        using type = typename Parameters::has_lazy_splitting;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
         /// \cond NOINTERNAL
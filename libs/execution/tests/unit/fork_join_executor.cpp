@@ -0,0 +1,223 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test(int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+    return passed_through;
+}
+
+void test_sync()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    executor exec;
+    HPX_TEST_EQ(hpx::parallel::execution::sync_execute(exec, &test, 42), 42);
+}
+
+void test_async()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    executor exec;
+    HPX_TEST_EQ(
+        hpx::parallel::execution::async_execute(exec, &test, 42).get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> count(0);
+
+void bulk_test(int value, int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+    ++count;
+}
+
+int bulk_test_result(int value, int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+    return value + 1;
+}
+
+void test_bulk_sync()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    std::vector<int> v(107);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    executor exec;
+
+    count = 0;
+    hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, 42);
+    HPX_TEST_EQ(count.load(), v.size());
+
+    std::vector<int> results = hpx::parallel::execution::bulk_sync_execute(
+        exec, &bulk_test_result, v, 42);
+
+    HPX_TEST_EQ(results.size(), v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i], v[i] + 1);
+    }
+}
+
+void test_bulk_async()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    std::vector<int> v(107);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    executor exec;
+
+    count = 0;
+    hpx::when_all(
+        hpx::parallel::execution::bulk_async_execute(exec, &bulk_test, v, 42))
+        .get();
+    HPX_TEST_EQ(count.load(), v.size());
+
+    std::vector<hpx::future<int>> results =
+        hpx::parallel::execution::bulk_async_execute(
+            exec, &bulk_test_result, v, 42);
+
+    HPX_TEST_EQ(results.size(), v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), v[i] + 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void bulk_test_exception(int value)
+{
+    if (value == 42)
+        throw std::runtime_error("bulk_test_exception");
+}
+
+void test_bulk_exception()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    std::vector<int> v(107);
+    std::iota(std::begin(v), std::end(v), 0);
+
+    executor exec;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::execution::bulk_sync_execute(
+            exec, &bulk_test_exception, v);
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+
+    // the executor has to be usable after an exception was thrown
+    count = 0;
+    hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, 42);
+    HPX_TEST_EQ(count.load(), v.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_for_loop()
+{
+    using namespace hpx::parallel;
+
+    execution::fork_join_executor exec;
+
+    std::vector<std::size_t> c(10007, 0);
+    for (int iteration = 0; iteration != 100; ++iteration)
+    {
+        for_loop(execution::par.on(exec), 0, c.size(),
+            [&](std::size_t i) { ++c[i]; });
+    }
+
+    HPX_TEST(std::all_of(std::begin(c), std::end(c),
+        [](std::size_t v) { return v == 100; }));
+
+    // nested invocations are executed by the calling thread
+    std::atomic<std::size_t> nested(0);
+    for_loop(execution::par.on(exec), 0, 10, [&](int) {
+        for_loop(execution::par.on(exec), 0, 10, [&](int) { ++nested; });
+    });
+    HPX_TEST_EQ(nested.load(), std::size_t(100));
+}
+
+void static_check_executor()
+{
+    using namespace hpx::traits;
+    using executor = hpx::parallel::execution::fork_join_executor;
+
+    static_assert(has_sync_execute_member<executor>::value,
+        "has_sync_execute_member<executor>::value");
+    static_assert(has_async_execute_member<executor>::value,
+        "has_async_execute_member<executor>::value");
+    static_assert(!has_then_execute_member<executor>::value,
+        "!has_then_execute_member<executor>::value");
+    static_assert(has_bulk_sync_execute_member<executor>::value,
+        "has_bulk_sync_execute_member<executor>::value");
+    static_assert(has_bulk_async_execute_member<executor>::value,
+        "has_bulk_async_execute_member<executor>::value");
+    static_assert(!has_bulk_then_execute_member<executor>::value,
+        "!has_bulk_then_execute_member<executor>::value");
+    static_assert(has_post_member<executor>::value,
+        "check has_post_member<executor>::value");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    static_check_executor();
+
+    test_sync();
+    test_async();
+
+    test_bulk_sync();
+    test_bulk_async();
+    test_bulk_exception();
+
+    test_for_loop();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv, cfg), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -10,6 +10,7 @@
 #define HPX_UTIL_DETAIL_VTABLE_VTABLE_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -61,9 +62,14 @@ namespace hpx { namespace util { namespace detail {
             using storage_t =
                 typename std::aligned_storage<sizeof(T), alignof(T)>::type;
 
+            // callables not fitting into the embedded storage are usually
+            // short lived, recycle their memory unless they are over-aligned
             if (sizeof(T) > storage_size)
             {
-                return new storage_t;
+                if (!is_thread_local_cacheable<storage_t>::value)
+                    return new storage_t;
+
+                return thread_local_caching_allocator<storage_t>().allocate(1);
             }
             return storage;
         }
@@ -82,7 +88,11 @@ namespace hpx { namespace util { namespace detail {
 
             if (sizeof(T) > storage_size)
             {
-                delete static_cast<storage_t*>(obj);
+                if (!is_thread_local_cacheable<storage_t>::value)
+                    return delete static_cast<storage_t*>(obj);
+
+                thread_local_caching_allocator<storage_t>().deallocate(
+                    static_cast<storage_t*>(obj), 1);
             }
         }
         void (*deallocate)(void*, std::size_t storage_size, bool);
@@ -146,6 +146,9 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -443,6 +446,11 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::local_priority_lifo;
         }
+        else if (0 ==
+            std::string("local-priority-chase-lev").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
         else if (0 == std::string("static").find(cfg_.queuing_))
         {
             default_scheduler = scheduling_policy::static_;
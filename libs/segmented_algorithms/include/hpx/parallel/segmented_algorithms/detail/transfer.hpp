@@ -10,7 +10,11 @@
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/lcos/dataflow.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/type_support/decay.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/execution_policy.hpp>
@@ -19,6 +23,7 @@
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <iterator>
 #include <list>
@@ -33,13 +38,109 @@ namespace hpx { namespace parallel { inline namespace v1 {
         ///////////////////////////////////////////////////////////////////////
         /// \cond NOINTERNAL
 
-        // sequential remote implementation
-        template <typename Algo, typename ExPolicy, typename SegIter,
-            typename SegOutIter>
-        static typename util::detail::algorithm_result<ExPolicy,
-            std::pair<SegIter, SegOutIter>>::type
-        segmented_transfer(Algo&& algo, ExPolicy const& policy, std::true_type,
-            SegIter first, SegIter last, SegOutIter dest)
+        // Receives a block of elements sent by transfer_send and moves them
+        // into the destination range, this runs on the locality owning the
+        // destination segment.
+        struct transfer_receive
+        {
+            typedef void result_type;
+
+            template <typename ExPolicy, typename IsSeq, typename OutIter,
+                typename T>
+            typename util::detail::algorithm_result<ExPolicy>::type call(
+                ExPolicy&&, IsSeq, OutIter dest, std::vector<T> values) const
+            {
+                std::move(values.begin(), values.end(), dest);
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive&, unsigned int)
+            {
+            }
+        };
+
+        // Transfers the elements of a piece of the input range into a
+        // destination segment living on another locality. This runs on the
+        // locality owning the input segment and sends all elements with a
+        // single parcel directly to the locality owning the destination.
+        template <typename Algo, typename LocalOutIter>
+        struct transfer_send
+        {
+            typedef void result_type;
+
+            transfer_send() = default;
+
+            transfer_send(id_type const& id, LocalOutIter const& dest)
+              : id_(id)
+              , dest_(dest)
+            {
+            }
+
+            template <typename ExPolicy, typename IsSeq, typename InIter>
+            typename util::detail::algorithm_result<ExPolicy>::type call(
+                ExPolicy&& policy, IsSeq, InIter first, InIter last) const
+            {
+                typedef typename std::iterator_traits<InIter>::value_type
+                    value_type;
+
+                // copy (or move) the elements using the transfer algorithm
+                std::vector<value_type> values(std::distance(first, last));
+                Algo::sequential(
+                    execution::seq, first, last, values.begin());
+
+                return util::detail::algorithm_result<ExPolicy>::get(
+                    dispatch_async(id_, transfer_receive(), policy,
+                        std::true_type(), dest_, std::move(values)));
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned int)
+            {
+                // clang-format off
+                ar & id_ & dest_;
+                // clang-format on
+            }
+
+            id_type id_;
+            LocalOutIter dest_;
+        };
+
+        // A part of the input range which does not cross a segment boundary,
+        // neither in the input nor in the destination range.
+        template <typename SegIter, typename SegOutIter>
+        struct transfer_piece
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+
+            typename traits::segment_iterator sit;
+            typename traits::local_iterator first;
+            typename traits::local_iterator last;
+            typename output_traits::segment_iterator sdest;
+            typename output_traits::local_iterator dest;
+
+            bool is_colocated() const
+            {
+                return naming::get_locality_id_from_id(traits::get_id(sit)) ==
+                    naming::get_locality_id_from_id(
+                        output_traits::get_id(sdest));
+            }
+        };
+
+        // Split [first, last) into the pieces which can be transferred with
+        // a single operation, returns the end of the destination range.
+        template <typename SegIter, typename SegOutIter>
+        SegOutIter get_transfer_pieces(SegIter first, SegIter last,
+            SegOutIter dest,
+            std::vector<transfer_piece<SegIter, SegOutIter>>& pieces)
         {
             typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
             typedef typename traits::segment_iterator segment_iterator;
@@ -52,70 +153,87 @@ namespace hpx { namespace parallel { inline namespace v1 {
             typedef typename output_traits::local_iterator
                 local_output_iterator_type;
 
-            typedef std::pair<local_iterator_type, local_output_iterator_type>
-                local_iterator_pair;
-
             segment_iterator sit = traits::segment(first);
             segment_iterator send = traits::segment(last);
+            local_iterator_type beg = traits::local(first);
 
-            segment_output_iterator sdest = traits::segment(dest);
+            segment_output_iterator sdest = output_traits::segment(dest);
+            local_output_iterator_type out = output_traits::local(dest);
 
-            if (sit == send)
+            while (true)
             {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
+                local_iterator_type end =
+                    (sit == send) ? traits::local(last) : traits::end(sit);
 
-                if (beg != end)
+                while (beg != end)
                 {
-                    local_iterator_pair p =
-                        dispatch(traits::get_id(sit), algo, policy,
-                            std::true_type(), beg, end, traits::local(dest));
+                    local_output_iterator_type out_end =
+                        output_traits::end(sdest);
+                    if (out == out_end)
+                    {
+                        // the current destination segment is full
+                        ++sdest;
+                        out = output_traits::begin(sdest);
+                        continue;
+                    }
+
+                    std::size_t count = (std::min)(
+                        static_cast<std::size_t>(std::distance(beg, end)),
+                        static_cast<std::size_t>(
+                            std::distance(out, out_end)));
 
-                    dest = output_traits::compose(sdest, p.second);
+                    local_iterator_type piece_end = std::next(beg, count);
+                    pieces.push_back(transfer_piece<SegIter, SegOutIter>{
+                        sit, beg, piece_end, sdest, out});
+
+                    beg = piece_end;
+                    out = std::next(out, count);
                 }
+
+                if (sit == send)
+                    break;
+
+                ++sit;
+                beg = traits::begin(sit);
             }
-            else
-            {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
 
-                if (beg != end)
-                {
-                    local_iterator_pair p = dispatch(traits::get_id(sit), algo,
-                        policy, std::true_type(), beg, end, out);
-                    out = p.second;
-                }
+            return output_traits::compose(sdest, out);
+        }
 
-                // handle all of the full partitions
-                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
-                {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    out = traits::begin(sdest);
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename SegOutIter>
+        static typename util::detail::algorithm_result<ExPolicy,
+            std::pair<SegIter, SegOutIter>>::type
+        segmented_transfer(Algo&& algo, ExPolicy const& policy, std::true_type,
+            SegIter first, SegIter last, SegOutIter dest)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
 
-                    if (beg != end)
-                    {
-                        local_iterator_pair p = dispatch(traits::get_id(sit),
-                            algo, policy, std::true_type(), beg, end, out);
-                        out = p.second;
-                    }
-                }
+            std::vector<transfer_piece<SegIter, SegOutIter>> pieces;
+            dest = get_transfer_pieces(first, last, dest, pieces);
 
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-                if (beg != end)
+            for (auto const& piece : pieces)
+            {
+                if (piece.is_colocated())
                 {
-                    local_iterator_pair p =
-                        dispatch(traits::get_id(sit), algo, policy,
-                            std::true_type(), beg, end, traits::begin(sdest));
-                    out = p.second;
+                    dispatch(traits::get_id(piece.sit), algo, policy,
+                        std::true_type(), piece.first, piece.last, piece.dest);
+                }
+                else
+                {
+                    // send the elements directly to the destination
+                    dispatch(traits::get_id(piece.sit),
+                        transfer_send<typename hpx::util::decay<Algo>::type,
+                            local_output_iterator_type>(
+                            output_traits::get_id(piece.sdest),
+                            piece.dest),
+                        policy, std::true_type(), piece.first, piece.last);
                 }
-
-                dest = output_traits::compose(sdest, out);
             }
 
             return util::detail::algorithm_result<ExPolicy,
@@ -132,78 +250,39 @@ namespace hpx { namespace parallel { inline namespace v1 {
             SegIter first, SegIter last, SegOutIter dest)
         {
             typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
-            typedef typename traits::segment_iterator segment_iterator;
-            typedef typename traits::local_iterator local_iterator_type;
-
             typedef hpx::traits::segmented_iterator_traits<SegOutIter>
                 output_traits;
-            typedef typename output_traits::segment_iterator
-                segment_output_iterator;
             typedef typename output_traits::local_iterator
                 local_output_iterator_type;
 
-            typedef std::pair<local_iterator_type, local_output_iterator_type>
-                local_iterator_pair;
-
             typedef std::integral_constant<bool,
                 !hpx::traits::is_forward_iterator<SegIter>::value>
                 forced_seq;
 
-            segment_iterator sit = traits::segment(first);
-            segment_iterator send = traits::segment(last);
-
-            segment_output_iterator sdest = traits::segment(dest);
+            std::vector<transfer_piece<SegIter, SegOutIter>> pieces;
+            dest = get_transfer_pieces(first, last, dest, pieces);
 
-            std::vector<shared_future<local_iterator_pair>> segments;
-            segments.reserve(std::distance(sit, send));
+            // all pieces are transferred concurrently, each of them directly
+            // between the localities owning the input and the destination
+            std::vector<future<void>> segments;
+            segments.reserve(pieces.size());
 
-            if (sit == send)
-            {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
-
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, traits::local(dest)));
-                }
-            }
-            else
+            for (auto const& piece : pieces)
             {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
-
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, out));
-                }
-
-                // handle all of the full partitions
-                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
+                if (piece.is_colocated())
                 {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    out = traits::begin(sdest);
-
-                    if (beg != end)
-                    {
-                        segments.push_back(dispatch_async(traits::get_id(sit),
-                            algo, policy, forced_seq(), beg, end, out));
-                    }
+                    segments.push_back(future<void>(dispatch_async(
+                        traits::get_id(piece.sit), algo, policy, forced_seq(),
+                        piece.first, piece.last, piece.dest)));
                 }
-
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-
-                if (beg != end)
+                else
                 {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, traits::begin(sdest)));
+                    segments.push_back(dispatch_async(traits::get_id(piece.sit),
+                        transfer_send<typename hpx::util::decay<Algo>::type,
+                            local_output_iterator_type>(
+                            output_traits::get_id(piece.sdest),
+                            piece.dest),
+                        policy, forced_seq(), piece.first, piece.last));
                 }
             }
             // NOLINTNEXTLINE(bugprone-use-after-move)
@@ -212,17 +291,14 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return util::detail::
                 algorithm_result<ExPolicy, std::pair<SegIter, SegOutIter>>::get(
                     hpx::dataflow(
-                        [=](std::vector<shared_future<local_iterator_pair>>&& r)
+                        [=](std::vector<future<void>>&& r)
                             -> std::pair<SegIter, SegOutIter> {
                             // handle any remote exceptions, will throw on error
                             std::list<std::exception_ptr> errors;
                             parallel::util::detail::handle_remote_exceptions<
                                 ExPolicy>::call(r, errors);
 
-                            local_iterator_pair p = r.back().get();
-                            return std::make_pair(
-                                output_traits::compose(sdest, p.first),
-                                output_traits::compose(sdest, p.second));
+                            return std::make_pair(last, dest);
                         },
                         std::move(segments)));
         }
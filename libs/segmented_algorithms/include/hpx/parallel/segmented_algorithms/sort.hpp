@@ -0,0 +1,721 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_NOV_18_2019_0915AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_NOV_18_2019_0915AM
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/transfer.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The buckets are merged on the locality owning them and have to be
+        // kept there until all elements have been read from the segments.
+        // This holds the merged buckets of all sort operations in flight.
+        template <typename T>
+        class sort_bucket_store
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+            typedef std::pair<std::uint64_t, std::size_t> key_type;
+
+        public:
+            static sort_bucket_store& instance()
+            {
+                static sort_bucket_store store;
+                return store;
+            }
+
+            void put(std::uint64_t sort_id, std::size_t bucket,
+                std::vector<T>&& values)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                buckets_[key_type(sort_id, bucket)] = std::move(values);
+            }
+
+            std::vector<T> take(std::uint64_t sort_id, std::size_t bucket)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                auto it = buckets_.find(key_type(sort_id, bucket));
+                HPX_ASSERT(it != buckets_.end());
+
+                std::vector<T> values = std::move(it->second);
+                buckets_.erase(it);
+                return values;
+            }
+
+            // Drop the bucket if it is still held, used after a failed sort
+            void erase(std::uint64_t sort_id, std::size_t bucket)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                buckets_.erase(key_type(sort_id, bucket));
+            }
+
+        private:
+            mutex_type mtx_;
+            std::map<key_type, std::vector<T>> buckets_;
+        };
+
+        // Return an identifier which is unique for this sort operation across
+        // all localities.
+        inline std::uint64_t get_sort_id()
+        {
+            static std::atomic<std::uint32_t> count(0);
+            return (std::uint64_t(hpx::get_locality_id()) << 32) | ++count;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Sort the elements of a segment and return a regular sample of them.
+        template <typename T>
+        struct sort_segment
+        {
+            typedef std::vector<T> result_type;
+
+            template <typename ExPolicy, typename IsSeq, typename RandomIt,
+                typename Compare, typename Proj>
+            typename util::detail::algorithm_result<ExPolicy,
+                result_type>::type
+            call(ExPolicy&& policy, IsSeq, RandomIt first, RandomIt last,
+                std::size_t count, Compare comp, Proj proj) const
+            {
+                typedef execution::is_sequenced_execution_policy<ExPolicy>
+                    is_seq;
+
+                sort<RandomIt>().call(
+                    policy, is_seq(), first, last, comp, proj);
+
+                std::size_t size = std::distance(first, last);
+                count = (std::min)(count, size);
+
+                std::vector<T> samples;
+                samples.reserve(count);
+                for (std::size_t i = 0; i != count; ++i)
+                    samples.push_back(*(first + (i * size) / count));
+
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(std::move(samples));
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive&, unsigned int)
+            {
+            }
+        };
+
+        // Return the boundaries of the buckets defined by the splitters in a
+        // sorted segment.
+        template <typename T>
+        struct sort_segment_bounds
+        {
+            typedef std::vector<std::size_t> result_type;
+
+            template <typename ExPolicy, typename IsSeq, typename RandomIt,
+                typename Compare, typename Proj>
+            typename util::detail::algorithm_result<ExPolicy,
+                result_type>::type
+            call(ExPolicy&&, IsSeq, RandomIt first, RandomIt last,
+                std::vector<T> splitters, Compare comp, Proj proj) const
+            {
+                util::compare_projected<Compare, Proj> pred(
+                    std::move(comp), std::move(proj));
+
+                std::vector<std::size_t> bounds;
+                bounds.reserve(splitters.size() + 2);
+                bounds.push_back(0);
+
+                RandomIt it = first;
+                for (T const& splitter : splitters)
+                {
+                    it = std::lower_bound(it, last, splitter, pred);
+                    bounds.push_back(std::distance(first, it));
+                }
+                bounds.push_back(std::distance(first, last));
+
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(std::move(bounds));
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive&, unsigned int)
+            {
+            }
+        };
+
+        // Return a copy of a part of a segment.
+        template <typename T>
+        struct sort_read_run
+        {
+            typedef std::vector<T> result_type;
+
+            template <typename ExPolicy, typename IsSeq, typename InIter>
+            typename util::detail::algorithm_result<ExPolicy,
+                result_type>::type
+            call(ExPolicy&&, IsSeq, InIter first, InIter last) const
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(std::vector<T>(first, last));
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive&, unsigned int)
+            {
+            }
+        };
+
+        // Collect the runs making up a bucket from all segments and merge
+        // them. This runs on the locality owning the bucket, remote runs are
+        // sent directly from the localities owning them.
+        template <typename T, typename LocalIter>
+        struct sort_merge_bucket
+        {
+            typedef void result_type;
+
+            sort_merge_bucket() = default;
+
+            sort_merge_bucket(std::uint64_t sort_id, std::size_t bucket)
+              : sort_id_(sort_id)
+              , bucket_(bucket)
+            {
+            }
+
+            void add_run(id_type const& id, LocalIter first, LocalIter last)
+            {
+                ids_.push_back(id);
+                firsts_.push_back(first);
+                lasts_.push_back(last);
+            }
+
+            template <typename ExPolicy, typename IsSeq, typename Compare,
+                typename Proj>
+            typename util::detail::algorithm_result<ExPolicy>::type call(
+                ExPolicy&& policy, IsSeq, Compare comp, Proj proj) const
+            {
+                typedef hpx::traits::segmented_local_iterator_traits<LocalIter>
+                    local_traits;
+
+                std::uint32_t here = hpx::get_locality_id();
+
+                // request all remote runs before copying the local ones
+                std::vector<future<std::vector<T>>> remote_runs;
+                for (std::size_t i = 0; i != ids_.size(); ++i)
+                {
+                    if (naming::get_locality_id_from_id(ids_[i]) != here)
+                    {
+                        remote_runs.push_back(dispatch_async(ids_[i],
+                            sort_read_run<T>(), policy, std::true_type(),
+                            firsts_[i], lasts_[i]));
+                    }
+                }
+
+                std::vector<T> values;
+                std::vector<std::size_t> run_bounds(1, 0);
+                for (std::size_t i = 0; i != ids_.size(); ++i)
+                {
+                    if (naming::get_locality_id_from_id(ids_[i]) == here)
+                    {
+                        values.insert(values.end(),
+                            local_traits::local(firsts_[i]),
+                            local_traits::local(lasts_[i]));
+                        run_bounds.push_back(values.size());
+                    }
+                }
+
+                for (future<std::vector<T>>& f : remote_runs)
+                {
+                    std::vector<T> run = f.get();
+                    std::move(
+                        run.begin(), run.end(), std::back_inserter(values));
+                    run_bounds.push_back(values.size());
+                }
+
+                // merge pairs of neighboring runs until a single one is left
+                util::compare_projected<Compare, Proj> pred(
+                    std::move(comp), std::move(proj));
+
+                while (run_bounds.size() > 2)
+                {
+                    std::vector<std::size_t> merged_bounds(1, 0);
+
+                    std::size_t i = 0;
+                    for (/**/; i + 2 < run_bounds.size(); i += 2)
+                    {
+                        std::inplace_merge(values.begin() + run_bounds[i],
+                            values.begin() + run_bounds[i + 1],
+                            values.begin() + run_bounds[i + 2], pred);
+                        merged_bounds.push_back(run_bounds[i + 2]);
+                    }
+                    if (i + 1 < run_bounds.size())
+                        merged_bounds.push_back(run_bounds[i + 1]);
+
+                    run_bounds = std::move(merged_bounds);
+                }
+
+                sort_bucket_store<T>::instance().put(
+                    sort_id_, bucket_, std::move(values));
+
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned int)
+            {
+                // clang-format off
+                ar & sort_id_ & bucket_ & ids_ & firsts_ & lasts_;
+                // clang-format on
+            }
+
+            std::uint64_t sort_id_;
+            std::size_t bucket_;
+            std::vector<id_type> ids_;
+            std::vector<LocalIter> firsts_;
+            std::vector<LocalIter> lasts_;
+        };
+
+        // Write a merged bucket back to the segments covering its part of
+        // the sorted sequence. This runs on the locality owning the bucket,
+        // the elements are sent directly to the localities owning the
+        // segments.
+        template <typename T, typename LocalIter>
+        struct sort_write_bucket
+        {
+            typedef void result_type;
+
+            sort_write_bucket() = default;
+
+            sort_write_bucket(std::uint64_t sort_id, std::size_t bucket)
+              : sort_id_(sort_id)
+              , bucket_(bucket)
+            {
+            }
+
+            void add_slice(
+                id_type const& id, LocalIter first, std::size_t count)
+            {
+                ids_.push_back(id);
+                firsts_.push_back(first);
+                counts_.push_back(count);
+            }
+
+            template <typename ExPolicy, typename IsSeq>
+            typename util::detail::algorithm_result<ExPolicy>::type call(
+                ExPolicy&& policy, IsSeq) const
+            {
+                typedef hpx::traits::segmented_local_iterator_traits<LocalIter>
+                    local_traits;
+
+                std::vector<T> values =
+                    sort_bucket_store<T>::instance().take(sort_id_, bucket_);
+
+                std::uint32_t here = hpx::get_locality_id();
+
+                std::vector<future<void>> sent;
+                typename std::vector<T>::iterator it = values.begin();
+                for (std::size_t i = 0; i != ids_.size(); ++i)
+                {
+                    typename std::vector<T>::iterator end = it + counts_[i];
+
+                    if (naming::get_locality_id_from_id(ids_[i]) == here)
+                    {
+                        std::move(it, end, local_traits::local(firsts_[i]));
+                    }
+                    else
+                    {
+                        sent.push_back(dispatch_async(ids_[i],
+                            transfer_receive(), policy, std::true_type(),
+                            firsts_[i],
+                            std::vector<T>(std::make_move_iterator(it),
+                                std::make_move_iterator(end))));
+                    }
+
+                    it = end;
+                }
+                HPX_ASSERT(it == values.end());
+
+                hpx::wait_all(sent);
+                for (future<void>& f : sent)
+                    f.get();
+
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned int)
+            {
+                // clang-format off
+                ar & sort_id_ & bucket_ & ids_ & firsts_ & counts_;
+                // clang-format on
+            }
+
+            std::uint64_t sort_id_;
+            std::size_t bucket_;
+            std::vector<id_type> ids_;
+            std::vector<LocalIter> firsts_;
+            std::vector<std::size_t> counts_;
+        };
+
+        // Release a merged bucket which has not been written back because
+        // the sort failed.
+        template <typename T>
+        struct sort_erase_bucket
+        {
+            typedef void result_type;
+
+            sort_erase_bucket() = default;
+
+            sort_erase_bucket(std::uint64_t sort_id, std::size_t bucket)
+              : sort_id_(sort_id)
+              , bucket_(bucket)
+            {
+            }
+
+            template <typename ExPolicy, typename IsSeq>
+            typename util::detail::algorithm_result<ExPolicy>::type call(
+                ExPolicy&&, IsSeq) const
+            {
+                sort_bucket_store<T>::instance().erase(sort_id_, bucket_);
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned int)
+            {
+                // clang-format off
+                ar & sort_id_ & bucket_;
+                // clang-format on
+            }
+
+            std::uint64_t sort_id_;
+            std::size_t bucket_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename T>
+        void wait_for_segments(std::vector<future<T>>& segments)
+        {
+            hpx::wait_all(segments);
+
+            // handle any remote exceptions, will throw on error
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<ExPolicy>::call(
+                segments, errors);
+        }
+
+        // Distributed sample sort: every segment is sorted locally, the
+        // splitters are chosen from a regular sample of each segment. Bucket
+        // j is assembled on the locality owning segment j by merging the
+        // runs all segments contribute to it, and written back from there to
+        // its final position in the sequence.
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        SegIter segmented_sort(ExPolicy const& policy, SegIter first,
+            SegIter last, Compare const& comp, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            // collect the non-empty parts of the segments to sort
+            std::vector<id_type> ids;
+            std::vector<local_iterator_type> begins;
+            std::vector<local_iterator_type> ends;
+            std::vector<std::size_t> sizes;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+            local_iterator_type beg = traits::local(first);
+
+            while (true)
+            {
+                local_iterator_type end =
+                    (sit == send) ? traits::local(last) : traits::end(sit);
+
+                if (beg != end)
+                {
+                    ids.push_back(traits::get_id(sit));
+                    begins.push_back(beg);
+                    ends.push_back(end);
+                    sizes.push_back(std::distance(beg, end));
+                }
+
+                if (sit == send)
+                    break;
+
+                ++sit;
+                beg = traits::begin(sit);
+            }
+
+            std::size_t const num_segments = ids.size();
+            if (num_segments == 0)
+                return last;
+
+            // sort all segments, every segment returns as many samples as
+            // there are segments
+            std::size_t num_samples = num_segments == 1 ? 0 : num_segments;
+
+            std::vector<future<std::vector<value_type>>> samples_f;
+            samples_f.reserve(num_segments);
+            for (std::size_t i = 0; i != num_segments; ++i)
+            {
+                samples_f.push_back(dispatch_async(ids[i],
+                    sort_segment<value_type>(), policy, is_seq(), begins[i],
+                    ends[i], num_samples, comp, proj));
+            }
+            wait_for_segments<ExPolicy>(samples_f);
+
+            if (num_segments == 1)
+                return last;
+
+            // select the splitters from the combined sample
+            std::vector<value_type> samples;
+            samples.reserve(num_segments * num_samples);
+            for (future<std::vector<value_type>>& f : samples_f)
+            {
+                std::vector<value_type> s = f.get();
+                std::move(s.begin(), s.end(), std::back_inserter(samples));
+            }
+
+            std::sort(samples.begin(), samples.end(),
+                util::compare_projected<Compare const&, Proj const&>(
+                    comp, proj));
+
+            std::vector<value_type> splitters;
+            splitters.reserve(num_segments - 1);
+            for (std::size_t j = 1; j != num_segments; ++j)
+            {
+                splitters.push_back(
+                    samples[(j * samples.size()) / num_segments]);
+            }
+
+            // find the buckets in each of the sorted segments
+            std::vector<future<std::vector<std::size_t>>> bounds_f;
+            bounds_f.reserve(num_segments);
+            for (std::size_t i = 0; i != num_segments; ++i)
+            {
+                bounds_f.push_back(dispatch_async(ids[i],
+                    sort_segment_bounds<value_type>(), policy, is_seq(),
+                    begins[i], ends[i], splitters, comp, proj));
+            }
+            wait_for_segments<ExPolicy>(bounds_f);
+
+            std::vector<std::vector<std::size_t>> bounds;
+            bounds.reserve(num_segments);
+            for (future<std::vector<std::size_t>>& f : bounds_f)
+                bounds.push_back(f.get());
+
+            // bucket j ends up at [offsets[j], offsets[j + 1]) of the sequence
+            std::vector<std::size_t> offsets(num_segments + 1, 0);
+            for (std::size_t j = 0; j != num_segments; ++j)
+            {
+                offsets[j + 1] = offsets[j];
+                for (std::size_t i = 0; i != num_segments; ++i)
+                    offsets[j + 1] += bounds[i][j + 1] - bounds[i][j];
+            }
+
+            std::uint64_t sort_id = get_sort_id();
+
+            std::vector<future<void>> merged;
+            merged.reserve(num_segments);
+
+            std::vector<future<void>> written;
+            written.reserve(num_segments);
+
+            try
+            {
+                // assemble bucket j on the locality owning segment j
+                for (std::size_t j = 0; j != num_segments; ++j)
+                {
+                    if (offsets[j] == offsets[j + 1])
+                        continue;
+
+                    sort_merge_bucket<value_type, local_iterator_type> merge(
+                        sort_id, j);
+                    for (std::size_t i = 0; i != num_segments; ++i)
+                    {
+                        if (bounds[i][j] != bounds[i][j + 1])
+                        {
+                            merge.add_run(ids[i],
+                                std::next(begins[i], bounds[i][j]),
+                                std::next(begins[i], bounds[i][j + 1]));
+                        }
+                    }
+
+                    merged.push_back(dispatch_async(ids[j], std::move(merge),
+                        policy, is_seq(), comp, proj));
+                }
+                wait_for_segments<ExPolicy>(merged);
+
+                // all elements have been read, write the buckets back
+                std::size_t segment = 0;
+                std::size_t segment_offset = 0;
+                for (std::size_t j = 0; j != num_segments; ++j)
+                {
+                    if (offsets[j] == offsets[j + 1])
+                        continue;
+
+                    sort_write_bucket<value_type, local_iterator_type> write(
+                        sort_id, j);
+
+                    std::size_t pos = offsets[j];
+                    while (pos != offsets[j + 1])
+                    {
+                        while (pos >= segment_offset + sizes[segment])
+                            segment_offset += sizes[segment++];
+
+                        std::size_t count =
+                            (std::min)(offsets[j + 1],
+                                segment_offset + sizes[segment]) -
+                            pos;
+
+                        write.add_slice(ids[segment],
+                            std::next(begins[segment], pos - segment_offset),
+                            count);
+                        pos += count;
+                    }
+
+                    written.push_back(dispatch_async(
+                        ids[j], std::move(write), policy, is_seq()));
+                }
+                wait_for_segments<ExPolicy>(written);
+            }
+            catch (...)
+            {
+                // release the buckets which have been merged but not written
+                // back, once no merge is in flight anymore
+                hpx::wait_all(merged);
+                hpx::wait_all(written);
+
+                std::vector<future<void>> erased;
+                erased.reserve(num_segments);
+                for (std::size_t j = 0; j != num_segments; ++j)
+                {
+                    if (offsets[j] != offsets[j + 1])
+                    {
+                        erased.push_back(dispatch_async(ids[j],
+                            sort_erase_bucket<value_type>(sort_id, j), policy,
+                            is_seq()));
+                    }
+                }
+                hpx::wait_all(erased);
+
+                throw;
+            }
+
+            return last;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        sort_(ExPolicy&& policy, SegIter first, SegIter last, Compare&& comp,
+            Proj&& proj, std::true_type)
+        {
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+            typedef typename hpx::util::decay<Compare>::type compare_type;
+            typedef typename hpx::util::decay<Proj>::type proj_type;
+
+            // the segments are sorted using the corresponding non-task
+            // execution policy, which keeps the executor and the executor
+            // parameters of the given one
+            typedef typename std::conditional<
+                execution::is_sequenced_execution_policy<policy_type>::value,
+                execution::sequenced_policy, execution::parallel_policy>::type
+                local_policy_type;
+
+            if (first == last)
+                return result::get(std::move(last));
+
+            auto local_policy = local_policy_type()
+                                    .on(policy.executor())
+                                    .with(policy.parameters());
+
+            if (execution::is_async_execution_policy<policy_type>::value)
+            {
+                compare_type c(std::forward<Compare>(comp));
+                proj_type p(std::forward<Proj>(proj));
+
+                return result::get(hpx::async([=]() -> SegIter {
+                    return segmented_sort(local_policy, first, last, c, p);
+                }));
+            }
+
+            return result::get(
+                segmented_sort(local_policy, first, last, comp, proj));
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::false_type);
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+#endif
@@ -100,6 +100,28 @@ void copy_algo_tests_with_policy_async(std::size_t size, std::size_t localities,
     compare_vectors(v1, v2);
 }
 
+// the input and the destination are partitioned differently
+template <typename T, typename DistPolicy1, typename DistPolicy2,
+    typename ExPolicy>
+void copy_algo_tests_with_layouts(std::size_t size, DistPolicy1 const& policy1,
+    DistPolicy2 const& policy2, ExPolicy const& copy_policy)
+{
+    hpx::partitioned_vector<T> v1(size, policy1);
+    std::size_t value = 0;
+    for (auto it = v1.begin(); it != v1.end(); ++it)
+        *it = T(value++);
+
+    hpx::partitioned_vector<T> v2(size, T(0), policy2);
+    auto p = hpx::parallel::copy(
+        copy_policy, v1.begin() + 1, v1.end() - 1, v2.begin() + 2);
+    HPX_TEST(p.out() == v2.end());
+
+    HPX_TEST_EQ(v2.get_value(hpx::launch::sync, 0), T(0));
+    HPX_TEST_EQ(v2.get_value(hpx::launch::sync, 1), T(0));
+    for (std::size_t i = 2; i != size; ++i)
+        HPX_TEST_EQ(v2.get_value(hpx::launch::sync, i), T(i - 1));
+}
+
 template <typename T, typename DistPolicy>
 void copy_tests_with_policy(
     std::size_t size, std::size_t localities, DistPolicy const& policy)
@@ -155,6 +177,15 @@ void copy_tests()
     copy_tests_with_policy<T>(length, 3, hpx::container_layout(3, localities));
     copy_tests_with_policy<T>(
         length, localities.size(), hpx::container_layout(localities));
+
+    using namespace hpx::parallel::execution;
+
+    copy_algo_tests_with_layouts<T>(length, hpx::container_layout(3),
+        hpx::container_layout(5, localities), seq);
+    copy_algo_tests_with_layouts<T>(length, hpx::container_layout(3),
+        hpx::container_layout(5, localities), par);
+    copy_algo_tests_with_layouts<T>(length,
+        hpx::container_layout(4, localities), hpx::container_layout(2), par);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
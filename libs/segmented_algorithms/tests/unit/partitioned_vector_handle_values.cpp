@@ -10,8 +10,11 @@
 
 #include <hpx/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdlib>
 #include <iostream>
+#include <numeric>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -104,6 +107,76 @@ void handle_values_tests_distributed_access(hpx::partitioned_vector<T>& v)
     compare_vectors(values2, result2);
 }
 
+template <typename T>
+void handle_values_tests_random_access(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(0), T(1));
+
+    // positions in arbitrary order, spanning all partitions, with duplicates
+    std::vector<std::size_t> positions(2 * v.size());
+    for (std::size_t& pos : positions)
+        pos = std::rand() % v.size();
+
+    std::vector<T> expected(positions.size());
+    for (std::size_t i = 0; i != positions.size(); ++i)
+        expected[i] = T(positions[i]);
+
+    std::vector<T> result = v.get_values(hpx::launch::sync, positions);
+    compare_vectors(expected, result);
+
+    // write every element exactly once, in reverse order
+    std::vector<std::size_t> all_positions(v.size());
+    std::iota(all_positions.rbegin(), all_positions.rend(), std::size_t(0));
+
+    std::vector<T> values(all_positions.size());
+    for (std::size_t i = 0; i != all_positions.size(); ++i)
+        values[i] = T(2 * all_positions[i]);
+
+    v.set_values(hpx::launch::sync, all_positions, values);
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), T(2 * i));
+}
+
+template <typename T>
+void handle_values_tests_cache(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(0), T(1));
+
+    hpx::partitioned_vector_cache<T> cache(v, 5);
+    HPX_TEST_EQ(cache.page_size(), std::size_t(5));
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+        HPX_TEST_EQ(cache.get_value(i), T(i));
+
+    std::vector<std::size_t> positions(v.size());
+    std::iota(positions.rbegin(), positions.rend(), std::size_t(0));
+
+    std::vector<T> result = cache.get_values(positions);
+    for (std::size_t i = 0; i != positions.size(); ++i)
+        HPX_TEST_EQ(result[i], T(positions[i]));
+
+    // modifications become visible in the vector once flushed
+    for (std::size_t i = 0; i != v.size(); ++i)
+        cache.set_value(i, T(3 * i));
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+        HPX_TEST_EQ(cache.get_value(i), T(3 * i));
+
+    cache.flush(hpx::launch::sync);
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), T(3 * i));
+
+    // changes done through the vector are seen after invalidating the cache
+    fill_vector(v, T(42));
+    cache.invalidate();
+    HPX_TEST_EQ(cache.num_pages(), std::size_t(0));
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+        HPX_TEST_EQ(cache.get_value(i), T(42));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename DistPolicy>
@@ -119,6 +192,16 @@ void handle_values_tests_with_policy(
         hpx::partitioned_vector<T> v(size, policy);
         handle_values_tests_distributed_access(v);
     }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_random_access(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_cache(v);
+    }
 }
 
 template <typename T>
@@ -0,0 +1,146 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T>
+std::vector<T> fill_random(hpx::partitioned_vector<T>& v, int range)
+{
+    std::uniform_int_distribution<int> dis(0, range);
+
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it)
+    {
+        values.push_back(T(dis(gen)));
+        *it = values.back();
+    }
+
+    return values;
+}
+
+template <typename T, typename Compare>
+void verify_sorted(hpx::partitioned_vector<T>& v, std::size_t first,
+    std::size_t last, std::vector<T> expected, Compare comp)
+{
+    std::sort(expected.begin() + first, expected.begin() + last, comp);
+
+    std::size_t i = 0;
+    for (T const& value : v)
+    {
+        HPX_TEST_EQ(value, expected[i]);
+        ++i;
+    }
+    HPX_TEST_EQ(i, expected.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+
+    // many duplicate values
+    std::vector<T> values = fill_random(c, 10);
+    hpx::parallel::sort(sort_policy, c.begin(), c.end());
+    verify_sorted(c, 0, size, values, std::less<T>());
+
+    values = fill_random(c, 100000);
+    hpx::parallel::sort(sort_policy, c.begin(), c.end(), std::greater<T>());
+    verify_sorted(c, 0, size, values, std::greater<T>());
+
+    values = fill_random(c, 100000);
+    hpx::parallel::sort(sort_policy, c.begin() + 1, c.end() - 1);
+    verify_sorted(c, 1, size - 1, values, std::less<T>());
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> values = fill_random(c, 100000);
+    hpx::future<typename hpx::partitioned_vector<T>::iterator> f =
+        hpx::parallel::sort(sort_policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+
+    verify_sorted(c, 0, size, values, std::less<T>());
+
+    values = fill_random(c, 100000);
+    hpx::future<typename hpx::partitioned_vector<T>::iterator> f1 =
+        hpx::parallel::sort(sort_policy, c.begin() + 1, c.end() - 1);
+    HPX_TEST(f1.get() == c.end() - 1);
+
+    verify_sorted(c, 1, size - 1, values, std::less<T>());
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    sort_algo_tests_with_policy<T>(size, policy, seq);
+    sort_algo_tests_with_policy<T>(size, policy, par);
+
+    // the executor parameters are passed on to the segments
+    sort_algo_tests_with_policy<T>(
+        size, policy, par.with(static_chunk_size(64)));
+
+    //async
+    sort_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    sort_algo_tests_with_policy_async<T>(size, policy, par(task));
+    sort_algo_tests_with_policy_async<T>(
+        size, policy, par(task).with(static_chunk_size(64)));
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(length, hpx::container_layout);
+    sort_tests_with_policy<T>(length, hpx::container_layout(3));
+    sort_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+    sort_tests_with_policy<T>(12, hpx::container_layout(7, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return 0;
+}
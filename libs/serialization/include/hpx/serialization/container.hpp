@@ -13,6 +13,7 @@
 #include <hpx/serialization/binary_filter.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization {
 
@@ -44,6 +45,15 @@ namespace hpx { namespace serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+
+        // Hand out the memory holding the next zero-copy chunk together with
+        // an object keeping it alive instead of copying its contents.
+        virtual bool adopt_binary_chunk(std::size_t /* count */,
+            std::size_t /* alignment */, void*& /* address */,
+            std::shared_ptr<void>& /* owner */)
+        {
+            return false;
+        }
     };
 }}    // namespace hpx::serialization
 
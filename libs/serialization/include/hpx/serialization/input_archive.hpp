@@ -38,10 +38,11 @@ namespace hpx { namespace serialization {
 
         template <typename Container>
         input_archive(Container& buffer, std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = nullptr)
+            const std::vector<serialization_chunk>* chunks = nullptr,
+            const std::vector<std::shared_ptr<void>>* chunk_owners = nullptr)
           : base_type(0U)
           , buffer_(new input_container<Container>(
-                buffer, chunks, inbound_data_size))
+                buffer, chunks, inbound_data_size, chunk_owners))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -125,6 +126,21 @@ namespace hpx { namespace serialization {
             return basic_archive<input_archive>::current_pos();
         }
 
+        // Take over the memory of the next zero-copy chunk if it holds
+        // exactly count bytes, the returned owner keeps the memory alive.
+        bool adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            void*& address, std::shared_ptr<void>& owner)
+        {
+            if (0 == count || disable_data_chunking())
+                return false;
+
+            if (!buffer_->adopt_binary_chunk(count, alignment, address, owner))
+                return false;
+
+            size_ += count;
+            return true;
+        }
+
     private:
         friend struct basic_archive<input_archive>;
 
@@ -57,6 +57,7 @@ namespace hpx { namespace serialization {
           , filter_()
           , decompressed_size_(inbound_data_size)
           , chunks_(nullptr)
+          , chunk_owners_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
         {
@@ -64,12 +65,14 @@ namespace hpx { namespace serialization {
 
         input_container(Container const& cont,
             std::vector<serialization_chunk> const* chunks,
-            std::size_t inbound_data_size)
+            std::size_t inbound_data_size,
+            std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr)
           : cont_(cont)
           , current_(0)
           , filter_()
           , decompressed_size_(inbound_data_size)
           , chunks_(nullptr)
+          , chunk_owners_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
         {
@@ -77,6 +80,9 @@ namespace hpx { namespace serialization {
             {
                 chunks_ = chunks;
                 current_chunk_ = 0;
+
+                if (chunk_owners && chunk_owners->size() == chunks->size())
+                    chunk_owners_ = chunk_owners;
             }
         }
 
@@ -178,12 +184,42 @@ namespace hpx { namespace serialization {
             }
         }
 
+        // Pointer chunks which were received into memory owned by the
+        // receiving end can be handed over to the de-serialized object.
+        bool adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            void*& address, std::shared_ptr<void>& owner)    // override
+        {
+            if (chunk_owners_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD || filter_)
+            {
+                return false;
+            }
+
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+            if (get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count ||
+                !(*chunk_owners_)[current_chunk_])
+            {
+                return false;
+            }
+
+            void* data = get_chunk_data(current_chunk_).pos_;
+            if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+                return false;
+
+            address = data;
+            owner = (*chunk_owners_)[current_chunk_];
+            ++current_chunk_;
+            return true;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
         std::size_t decompressed_size_;
 
         std::vector<serialization_chunk> const* chunks_;
+        std::vector<std::shared_ptr<void>> const* chunk_owners_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
     };
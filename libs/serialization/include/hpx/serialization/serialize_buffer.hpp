@@ -15,11 +15,14 @@
 #include <hpx/serialization/array.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 
+#include <boost/predef/other/endian.h>
 #include <boost/shared_array.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
 namespace hpx { namespace serialization {
@@ -292,6 +295,15 @@ namespace hpx { namespace serialization {
             ar >> size_ >> alloc_;
             // -V128
 
+            // avoid copying data which was received into separately
+            // allocated memory
+            using use_received_data = std::integral_constant<bool,
+                std::is_same<Allocator, std::allocator<T>>::value &&
+                    hpx::traits::is_bitwise_serializable<T>::value>;
+
+            if (size_ != 0 && load_received_data(ar, use_received_data()))
+                return;
+
             data_.reset(alloc_.allocate(size_), [this](T* p) {
                 serialize_buffer::deleter<allocator_type>(p, alloc_, size_);
             });
@@ -304,6 +316,40 @@ namespace hpx { namespace serialization {
 
         HPX_SERIALIZATION_SPLIT_MEMBER()
 
+    private:
+        template <typename Archive>
+        bool load_received_data(Archive&, std::false_type)
+        {
+            return false;
+        }
+
+        template <typename Archive>
+        bool load_received_data(Archive& ar, std::true_type)
+        {
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            void* address = nullptr;
+            std::shared_ptr<void> owner;
+            if (!ar.adopt_binary_chunk(
+                    size_ * sizeof(T), alignof(T), address, owner))
+            {
+                return false;
+            }
+
+            // the received data is kept alive as long as it is referenced
+            data_ = boost::shared_array<T>(
+                static_cast<T*>(address), [owner](T*) {});
+            return true;
+        }
+
+    public:
+
         // this is needed for util::any
         friend bool operator==(
             serialize_buffer const& rhs, serialize_buffer const& lhs)
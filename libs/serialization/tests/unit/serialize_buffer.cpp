@@ -9,10 +9,14 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/actions.hpp>
 #include <hpx/include/lcos.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/serialize_buffer.hpp>
 #include <hpx/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -131,6 +135,67 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+// Zero-copy chunks which were received into memory owned by the receiving
+// end are handed over to the de-serialized buffer instead of being copied.
+template <typename T>
+void test_adopt_received_chunks(std::size_t size)
+{
+    using buffer_type = hpx::serialization::serialize_buffer<T>;
+
+    buffer_type send_buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        send_buffer[i] = static_cast<T>(i);
+    }
+
+    std::vector<char> data;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(data, 0, &chunks);
+    oarchive << send_buffer;
+    std::size_t archive_size = oarchive.bytes_written();
+
+    // emulate receiving the zero-copy chunks into separate buffers
+    std::vector<std::shared_ptr<void>> owners(chunks.size());
+    std::vector<void*> received;
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        if (chunks[i].type_ != hpx::serialization::chunk_type_pointer)
+        {
+            continue;
+        }
+
+        std::size_t chunk_size = chunks[i].size_;
+        std::shared_ptr<char> p(
+            new char[chunk_size], std::default_delete<char[]>());
+        std::memcpy(p.get(), chunks[i].data_.cpos_, chunk_size);
+
+        chunks[i] =
+            hpx::serialization::create_pointer_chunk(p.get(), chunk_size);
+        received.push_back(p.get());
+        owners[i] = p;
+    }
+
+    buffer_type recv_buffer;
+    {
+        hpx::serialization::input_archive iarchive(
+            data, archive_size, &chunks, &owners);
+        iarchive >> recv_buffer;
+    }
+    owners.clear();
+
+    HPX_TEST_EQ(recv_buffer.size(), size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(recv_buffer[i], static_cast<T>(i));
+    }
+
+    bool adopted = std::find(received.begin(), received.end(),
+                       static_cast<void*>(recv_buffer.data())) !=
+        received.end();
+    HPX_TEST_EQ(adopted,
+        size * sizeof(T) >= HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -156,6 +221,12 @@ int hpx_main(int argc, char* argv[])
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
     }
 
+    for (std::size_t size = 1; size <= max_size; size *= 4)
+    {
+        test_adopt_received_chunks<char>(size);
+        test_adopt_received_chunks<double>(size);
+    }
+
     return hpx::finalize();
 }
 
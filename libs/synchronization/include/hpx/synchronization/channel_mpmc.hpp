@@ -13,10 +13,15 @@
 #include <hpx/assertion.hpp>
 #include <hpx/concurrency.hpp>
 #include <hpx/errors.hpp>
+#include <hpx/synchronization/condition_variable.hpp>
+#include <hpx/synchronization/detail/yield_k.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -24,193 +29,489 @@
 namespace hpx { namespace lcos { namespace local {
 
     ////////////////////////////////////////////////////////////////////////////
-    // A simple but very high performance implementation of the channel concept.
-    // This channel is bounded to a size given at construction time and supports
+    // A lock-free implementation of the channel concept. This channel holds
+    // at most the number of values given at construction time and supports
     // multiple producers and multiple consumers. The data is stored in a
-    // ring-buffer.
+    // ring-buffer (its size rounded up to the next power of two, at least
+    // two), each cell of which carries a sequence number telling whether it
+    // is ready to be written or read (see Dmitry Vyukov, Bounded MPMC queue,
+    // 1024cores.net).
+    //
+    // The operations set(), get(), set_n(), and get_n() never block. The
+    // operations set_sync() and get_sync() suspend the calling HPX thread
+    // until they succeed, the mutex is used only for those.
     template <typename T, typename Mutex = util::spinlock>
     class bounded_channel
     {
     private:
         using mutex_type = Mutex;
 
-        bool is_full(std::size_t tail) const noexcept
+        struct cell
         {
-            std::size_t numitems = size_ + tail - head_.data_;
-            if (numitems < size_)
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+        // A single cell can't tell whether it was filled at position p or
+        // whether it is ready to be filled at position p + 1, the buffer needs
+        // at least two cells.
+        static std::size_t round_to_power_of_two(std::size_t size)
+        {
+            std::size_t result = 2;
+            while (result < size)
             {
-                return numitems == size_ - 1;
+                result <<= 1;
             }
-            return numitems - size_ == size_ - 1;
-        }
-
-        bool is_empty(std::size_t head) const noexcept
-        {
-            return head == tail_.data_;
+            return result;
         }
 
     public:
         explicit bounded_channel(std::size_t size)
-          : size_(size + 1)
-          , buffer_(new T[size + 1])
+          : size_(size)
+          , mask_(round_to_power_of_two(size) - 1)
+          , buffer_(new cell[mask_ + 1])
           , closed_(false)
         {
             HPX_ASSERT(size != 0);
 
-            // invoke constructors for allocated buffer
-            for (std::size_t i = 0; i != size_; ++i)
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
             {
-                new (&buffer_[i]) T();
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
             }
 
-            head_.data_ = 0;
-            tail_.data_ = 0;
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
+
+            waiting_consumers_.data_.store(0, std::memory_order_relaxed);
+            waiting_producers_.data_.store(0, std::memory_order_relaxed);
         }
 
+        // Moving a channel is not thread-safe, no blocking operation may be
+        // in progress.
         bounded_channel(bounded_channel&& rhs) noexcept
-          : head_(rhs.head_)
-          , tail_(rhs.tail_)
-          , size_(rhs.size_)
+          : size_(rhs.size_)
+          , mask_(rhs.mask_)
           , buffer_(std::move(rhs.buffer_))
-          , closed_(rhs.closed_)
         {
-            rhs.size_ = 0;
-            rhs.closed_ = true;
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            waiting_consumers_.data_.store(0, std::memory_order_relaxed);
+            waiting_producers_.data_.store(0, std::memory_order_relaxed);
+
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            rhs.closed_.store(true, std::memory_order_release);
         }
 
         bounded_channel& operator=(bounded_channel&& rhs) noexcept
         {
-            head_ = rhs.head_;
-            tail_ = rhs.tail_;
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
             size_ = rhs.size_;
+            mask_ = rhs.mask_;
             buffer_ = std::move(rhs.buffer_);
-            closed_ = rhs.closed_;
-            rhs.closed_ = true;
+
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            rhs.closed_.store(true, std::memory_order_release);
+
             return *this;
         }
 
         ~bounded_channel()
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
+            if (!closed_.load(std::memory_order_relaxed))
+            {
+                close();
+            }
+        }
 
-            // invoke destructors for allocated buffer
-            for (std::size_t i = 0; i != size_; ++i)
+        bool get(T* val = nullptr) const noexcept
+        {
+            if (!try_get(val))
             {
-                (&buffer_[i])->~T();
+                return false;
             }
 
-            if (!closed_)
+            if (val != nullptr)
             {
-                close(l);
+                notify(waiting_producers_.data_, producers_);
             }
+            return true;
         }
 
-        bool get(T* val = nullptr) const noexcept
+        bool set(T&& t) noexcept
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            if (closed_)
+            if (!try_set(t))
             {
                 return false;
             }
 
-            std::size_t head = head_.data_;
+            notify(waiting_consumers_.data_, consumers_);
+            return true;
+        }
 
-            if (is_empty(head))
+        // Retrieve up to count values, return the number of values stored in
+        // the array val points to.
+        std::size_t get_n(T* val, std::size_t count) const noexcept
+        {
+            if (count == 0 || closed_.load(std::memory_order_relaxed))
             {
-                return false;
+                return 0;
             }
 
-            if (val == nullptr)
+            std::size_t pos = head_.data_.load(std::memory_order_relaxed);
+            for (;;)
             {
-                return true;
+                // find the number of consecutive cells which are ready
+                std::size_t n = 0;
+                std::intptr_t diff = 0;
+                for (/**/; n != count && n <= mask_; ++n)
+                {
+                    diff = std::intptr_t(
+                               buffer_[(pos + n) & mask_].sequence_.load(
+                                   std::memory_order_acquire)) -
+                        std::intptr_t(pos + n + 1);
+                    if (diff != 0)
+                    {
+                        break;
+                    }
+                }
+
+                if (n == 0)
+                {
+                    if (diff < 0)
+                    {
+                        return 0;    // the channel is empty
+                    }
+                    pos = head_.data_.load(std::memory_order_relaxed);
+                }
+                else if (head_.data_.compare_exchange_weak(
+                             pos, pos + n, std::memory_order_relaxed))
+                {
+                    for (std::size_t i = 0; i != n; ++i)
+                    {
+                        cell& c = buffer_[(pos + i) & mask_];
+                        val[i] = std::move(c.data_);
+                        c.sequence_.store(
+                            pos + i + mask_ + 1, std::memory_order_release);
+                    }
+
+                    notify(waiting_producers_.data_, producers_, n);
+                    return n;
+                }
             }
+        }
 
-            *val = std::move(buffer_[head]);
-            if (++head >= size_)
+        // Store up to count values moved from the array val points to, return
+        // the number of values stored.
+        std::size_t set_n(T* val, std::size_t count) noexcept
+        {
+            if (count == 0 || closed_.load(std::memory_order_relaxed))
             {
-                head = 0;
+                return 0;
             }
-            head_.data_ = head;
 
-            return true;
+            std::size_t pos = tail_.data_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                // don't store more values than requested at construction
+                std::intptr_t const size = stored_values(pos);
+                if (size >= std::intptr_t(size_))
+                {
+                    return 0;    // the channel is full
+                }
+
+                std::size_t const max_count = size < 0 ?
+                    count :
+                    (std::min)(count, size_ - std::size_t(size));
+
+                // find the number of consecutive cells which are free
+                std::size_t n = 0;
+                std::intptr_t diff = 0;
+                for (/**/; n != max_count && n <= mask_; ++n)
+                {
+                    diff = std::intptr_t(
+                               buffer_[(pos + n) & mask_].sequence_.load(
+                                   std::memory_order_acquire)) -
+                        std::intptr_t(pos + n);
+                    if (diff != 0)
+                    {
+                        break;
+                    }
+                }
+
+                if (n == 0)
+                {
+                    if (diff < 0)
+                    {
+                        return 0;    // the channel is full
+                    }
+                    pos = tail_.data_.load(std::memory_order_relaxed);
+                }
+                else if (tail_.data_.compare_exchange_weak(
+                             pos, pos + n, std::memory_order_relaxed))
+                {
+                    for (std::size_t i = 0; i != n; ++i)
+                    {
+                        cell& c = buffer_[(pos + i) & mask_];
+                        c.data_ = std::move(val[i]);
+                        c.sequence_.store(
+                            pos + i + 1, std::memory_order_release);
+                    }
+
+                    notify(waiting_consumers_.data_, consumers_, n);
+                    return n;
+                }
+            }
         }
 
-        bool set(T&& t) noexcept
+        // Suspend the calling HPX thread until a value was retrieved, return
+        // false if the channel was closed.
+        bool get_sync(T* val) const
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            if (closed_)
+            HPX_ASSERT(val != nullptr);
+            if (!wait(waiting_consumers_.data_, consumers_,
+                    [&]() { return try_get(val); }))
             {
                 return false;
             }
 
-            std::size_t tail = tail_.data_;
+            notify(waiting_producers_.data_, producers_);
+            return true;
+        }
 
-            if (is_full(tail))
+        // Suspend the calling HPX thread until the value was stored, return
+        // false if the channel was closed.
+        bool set_sync(T&& t)
+        {
+            if (!wait(waiting_producers_.data_, producers_,
+                    [&]() { return try_set(t); }))
             {
                 return false;
             }
 
-            buffer_[tail] = std::move(t);
-            if (++tail >= size_)
-            {
-                tail = 0;
-            }
-            tail_.data_ = tail;
-
+            notify(waiting_consumers_.data_, consumers_);
             return true;
         }
 
         std::size_t close()
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            return close(l);
+            bool expected = false;
+            if (!closed_.compare_exchange_strong(expected, true))
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_channel::close",
+                    "attempting to close an already closed channel");
+            }
+
+            // wake up all suspended threads, they will find the channel closed
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting_consumers_.data_.load(std::memory_order_relaxed) != 0 ||
+                waiting_producers_.data_.load(std::memory_order_relaxed) != 0)
+            {
+                std::lock_guard<mutex_type> l(mtx_.data_);
+                consumers_.notify_all();
+                producers_.notify_all();
+            }
+            return 0;
         }
 
         std::size_t capacity() const
         {
-            return size_ - 1;
+            return size_;
         }
 
-    protected:
-        std::size_t close(std::unique_lock<mutex_type>& l)
+    private:
+        // The number of values stored or being stored in front of the given
+        // position of the tail. This is an upper bound as the head might
+        // have moved on already, it is negative if pos is outdated.
+        std::intptr_t stored_values(std::size_t pos) const noexcept
         {
-            HPX_ASSERT_OWNS_LOCK(l);
+            return std::intptr_t(
+                pos - head_.data_.load(std::memory_order_acquire));
+        }
 
-            if (closed_)
+        bool try_get(T* val) const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
             {
-                l.unlock();
-                HPX_THROW_EXCEPTION(hpx::invalid_status,
-                    "hpx::lcos::local::bounded_channel::close",
-                    "attempting to close an already closed channel");
+                return false;
             }
 
-            closed_ = true;
-            return 0;
+            std::size_t pos = head_.data_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell& c = buffer_[pos & mask_];
+                std::intptr_t diff =
+                    std::intptr_t(c.sequence_.load(std::memory_order_acquire)) -
+                    std::intptr_t(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (val == nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (head_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        *val = std::move(c.data_);
+                        c.sequence_.store(
+                            pos + mask_ + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is empty
+                }
+                else
+                {
+                    pos = head_.data_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // the value is moved from only if it was stored
+        bool try_set(T& t) noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            std::size_t pos = tail_.data_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                // don't store more values than requested at construction
+                if (stored_values(pos) >= std::intptr_t(size_))
+                {
+                    return false;    // the channel is full
+                }
+
+                cell& c = buffer_[pos & mask_];
+                std::intptr_t diff =
+                    std::intptr_t(c.sequence_.load(std::memory_order_acquire)) -
+                    std::intptr_t(pos);
+
+                if (diff == 0)
+                {
+                    if (tail_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        c.data_ = std::move(t);
+                        c.sequence_.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is full
+                }
+                else
+                {
+                    pos = tail_.data_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Spin for a short while, then suspend until notified. The waiting
+        // counter is incremented before the final attempt, which pairs with
+        // the fence in notify() to avoid missing a wakeup.
+        template <typename F>
+        bool wait(std::atomic<std::size_t>& waiting,
+            condition_variable_any& cond, F&& f) const
+        {
+            for (std::size_t k = 0; k != 16; ++k)
+            {
+                if (f())
+                {
+                    return true;
+                }
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+                hpx::util::detail::yield_k(k, "bounded_channel::wait");
+            }
+
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            waiting.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            while (!f())
+            {
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    waiting.fetch_sub(1);
+                    return false;
+                }
+                cond.wait(l);
+            }
+
+            waiting.fetch_sub(1);
+            return true;
+        }
+
+        void notify(std::atomic<std::size_t>& waiting,
+            condition_variable_any& cond, std::size_t count = 1) const
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+            std::lock_guard<mutex_type> l(mtx_.data_);
+            if (count == 1)
+            {
+                cond.notify_one();
+            }
+            else
+            {
+                cond.notify_all();
+            }
         }
 
     private:
-        // keep the mutex, the head, and the tail pointer in separate cache
-        // lines
-        mutable hpx::util::cache_aligned_data<mutex_type> mtx_;
-        mutable hpx::util::cache_aligned_data<std::size_t> head_;
-        hpx::util::cache_aligned_data<std::size_t> tail_;
+        // keep the head and the tail pointer in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
 
-        // a channel of size n can buffer n-1 items
+        // the maximal number of values stored, the ring-buffer holds
+        // mask_ + 1 cells
         std::size_t size_;
+        std::size_t mask_;
 
         // channel buffer
-        std::unique_ptr<T[]> buffer_;
+        std::unique_ptr<cell[]> buffer_;
 
         // this channel was closed, i.e. no further operations are possible
-        bool closed_;
+        std::atomic<bool> closed_;
+
+        // number of threads suspended in get_sync() and set_sync()
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>>
+            waiting_consumers_;
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>>
+            waiting_producers_;
+
+        mutable hpx::util::cache_aligned_data<mutex_type> mtx_;
+        mutable condition_variable_any consumers_;
+        mutable condition_variable_any producers_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
     // For use with HPX threads, the channel_mpmc defined here is the fastest
-    // (even faster than the channel_spsc). Using hpx::util::spinlock as the
-    // means of synchronization enables the use of this channel with non-HPX
-    // threads, however the performance degrades by a factor of ten compared to
-    // using hpx::lcos::local::spinlock.
+    // (even faster than the channel_spsc). The non-blocking operations do not
+    // use the mutex and can be used with non-HPX threads as well.
     template <typename T>
     using channel_mpmc = bounded_channel<T, hpx::lcos::local::spinlock>;
 
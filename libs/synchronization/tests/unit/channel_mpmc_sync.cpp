@@ -0,0 +1,198 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+constexpr int NUM_PRODUCERS = 32;
+constexpr int NUM_CONSUMERS = 8;
+constexpr int NUM_VALUES = 1000;
+constexpr int BATCH_SIZE = 7;
+
+///////////////////////////////////////////////////////////////////////////////
+// every producer sends NUM_VALUES values, every consumer sums up what it gets
+void produce_sync(hpx::lcos::local::channel_mpmc<int>& c)
+{
+    for (int i = 1; i <= NUM_VALUES; ++i)
+    {
+        HPX_TEST(c.set_sync(int(i)));
+    }
+}
+
+std::size_t consume_sync(hpx::lcos::local::channel_mpmc<int>& c, int count)
+{
+    std::size_t sum = 0;
+    for (int i = 0; i != count; ++i)
+    {
+        int value = 0;
+        HPX_TEST(c.get_sync(&value));
+        sum += value;
+    }
+    return sum;
+}
+
+void produce_n(hpx::lcos::local::channel_mpmc<int>& c)
+{
+    std::vector<int> values(NUM_VALUES);
+    std::iota(values.begin(), values.end(), 1);
+
+    std::size_t pos = 0;
+    while (pos != values.size())
+    {
+        std::size_t count = (std::min)(
+            std::size_t(BATCH_SIZE), values.size() - pos);
+        std::size_t n = c.set_n(values.data() + pos, count);
+        HPX_TEST_LTE(n, count);
+        pos += n;
+        if (n == 0)
+        {
+            hpx::this_thread::yield();
+        }
+    }
+}
+
+std::size_t consume_n(hpx::lcos::local::channel_mpmc<int>& c, int count)
+{
+    std::size_t sum = 0;
+    std::vector<int> values(BATCH_SIZE);
+    while (count != 0)
+    {
+        std::size_t n = c.get_n(values.data(),
+            (std::min)(std::size_t(BATCH_SIZE), std::size_t(count)));
+        sum = std::accumulate(values.begin(), values.begin() + n, sum);
+        count -= int(n);
+        if (n == 0)
+        {
+            hpx::this_thread::yield();
+        }
+    }
+    return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Producer, typename Consumer>
+void test_channel(std::size_t size, Producer produce, Consumer consume)
+{
+    hpx::lcos::local::channel_mpmc<int> c(size);
+    HPX_TEST_EQ(size, c.capacity());
+
+    std::vector<hpx::future<void>> producers;
+    for (int i = 0; i != NUM_PRODUCERS; ++i)
+    {
+        producers.push_back(hpx::async(produce, std::ref(c)));
+    }
+
+    int const values_per_consumer =
+        NUM_PRODUCERS * NUM_VALUES / NUM_CONSUMERS;
+
+    std::vector<hpx::future<std::size_t>> consumers;
+    for (int i = 0; i != NUM_CONSUMERS; ++i)
+    {
+        consumers.push_back(
+            hpx::async(consume, std::ref(c), values_per_consumer));
+    }
+
+    hpx::wait_all(producers);
+
+    std::size_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    HPX_TEST_EQ(sum,
+        std::size_t(NUM_PRODUCERS) * NUM_VALUES * (NUM_VALUES + 1) / 2);
+    HPX_TEST(!c.get());
+}
+
+// the channel holds no more values than requested, even if its ring-buffer
+// is larger
+void test_capacity(std::size_t size)
+{
+    {
+        hpx::lcos::local::channel_mpmc<int> c(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            HPX_TEST(c.set(int(i)));
+        }
+        HPX_TEST(!c.set(int(size)));
+
+        int value = -1;
+        HPX_TEST(c.get(&value));
+        HPX_TEST_EQ(value, 0);
+
+        HPX_TEST(c.set(int(size)));
+        HPX_TEST(!c.set(int(size + 1)));
+    }
+
+    {
+        hpx::lcos::local::channel_mpmc<int> c(size);
+        std::vector<int> values(size + 3);
+        std::iota(values.begin(), values.end(), 0);
+
+        HPX_TEST_EQ(c.set_n(values.data(), values.size()), size);
+        HPX_TEST_EQ(c.set_n(values.data(), values.size()), std::size_t(0));
+        HPX_TEST(!c.set(int(size)));
+
+        std::vector<int> result(size + 3);
+        HPX_TEST_EQ(c.get_n(result.data(), result.size()), size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            HPX_TEST_EQ(result[i], int(i));
+        }
+    }
+}
+
+// a closed channel wakes up all suspended threads
+void test_close()
+{
+    hpx::lcos::local::channel_mpmc<int> c(1);
+
+    std::vector<hpx::future<bool>> consumers;
+    for (int i = 0; i != NUM_CONSUMERS; ++i)
+    {
+        consumers.push_back(hpx::async([&c]() {
+            int value = 0;
+            return c.get_sync(&value);
+        }));
+    }
+
+    hpx::this_thread::yield();
+    c.close();
+
+    for (auto& f : consumers)
+    {
+        HPX_TEST(!f.get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    for (std::size_t size : {1, 5, 64})
+    {
+        test_capacity(size);
+
+        test_channel(size, &produce_sync, &consume_sync);
+        test_channel(size, &produce_n, &consume_n);
+        test_channel(size, &produce_n, &consume_sync);
+        test_channel(size, &produce_sync, &consume_n);
+    }
+
+    test_close();
+
+    return hpx::util::report_errors();
+}
@@ -682,6 +682,49 @@ namespace hpx { namespace threads {
 #endif
                 break;
             }
+
+            case resource::local_priority_chase_lev:
+            {
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_priority_queue_scheduler<
+                        std::mutex, hpx::threads::policies::lockfree_chase_lev>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init,
+                    "core-chase_lev_priority_queue_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->add_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::enable_stealing_numa, !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(std::move(sched), thread_pool_init));
+                pools_.push_back(std::move(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=local-priority-chase-lev "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=chase-lev-priority'.");
+#endif
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
@@ -1124,6 +1167,15 @@ namespace hpx { namespace threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_to_pending_remote(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_to_pending_remote(
+                all_threads, reset);
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
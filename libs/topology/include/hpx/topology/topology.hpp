@@ -188,6 +188,18 @@ namespace hpx { namespace threads {
         mask_cref_type get_core_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the data cache of the given level
+        ///        (2 or 3) with the given thread. If the cache level is not
+        ///        reported by the operating system the core affinity mask
+        ///        (level 2) or socket affinity mask (level 3) is returned.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_cache_affinity_mask(std::size_t num_thread,
+            std::size_t level, error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -362,6 +374,9 @@ namespace hpx { namespace threads {
                 get_core_number(num_thread), default_mask);
         }
 
+        mask_type init_cache_affinity_mask(
+            std::size_t num_thread, unsigned level) const;
+
         void init_num_of_pus();
 
         hwloc_topology_t topo;
@@ -404,6 +419,10 @@ namespace hpx { namespace threads {
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
+
+        // The PUs sharing the level 2 and level 3 data caches with a PU.
+        std::vector<mask_type> l2_cache_affinity_masks_;
+        std::vector<mask_type> l3_cache_affinity_masks_;
     };
 
 #include <hpx/config/warnings_suffix.hpp>
@@ -289,6 +289,14 @@ namespace hpx { namespace threads {
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
         }
+
+        l2_cache_affinity_masks_.reserve(num_of_pus_);
+        l3_cache_affinity_masks_.reserve(num_of_pus_);
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            l2_cache_affinity_masks_.push_back(init_cache_affinity_mask(i, 2));
+            l3_cache_affinity_masks_.push_back(init_cache_affinity_mask(i, 3));
+        }
     }    // }}}
 
     void topology::write_to_log() const
@@ -324,6 +332,10 @@ namespace hpx { namespace threads {
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
         detail::write_to_log_mask(
             "thread_affinity_mask", thread_affinity_masks_);
+        detail::write_to_log_mask(
+            "l2_cache_affinity_mask", l2_cache_affinity_masks_);
+        detail::write_to_log_mask(
+            "l3_cache_affinity_mask", l3_cache_affinity_masks_);
     }
 
     topology::~topology()
@@ -407,6 +419,40 @@ namespace hpx { namespace threads {
         return empty_mask;
     }    // }}}
 
+    mask_cref_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, std::size_t level, error_code& ec) const
+    {
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        std::vector<mask_type> const* masks = nullptr;
+        if (level == 2)
+            masks = &l2_cache_affinity_masks_;
+        else if (level == 3)
+            masks = &l3_cache_affinity_masks_;
+
+        if (masks == nullptr)
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "hpx::threads::topology::get_cache_affinity_mask",
+                hpx::util::format(
+                    "cache level %1% is not supported", level));
+            return empty_mask;
+        }
+
+        if (num_pu < masks->size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return (*masks)[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter,
+            "hpx::threads::topology::get_cache_affinity_mask",
+            hpx::util::format("thread number %1% is out of range", num_thread));
+        return empty_mask;
+    }
+
     mask_cref_type topology::get_core_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {
@@ -1079,6 +1125,48 @@ namespace hpx { namespace threads {
         return default_mask;
     }    // }}}
 
+    mask_type topology::init_cache_affinity_mask(
+        std::size_t num_thread, unsigned level) const
+    {    // {{{
+        mask_type default_mask = level == 2 ? core_affinity_masks_[num_thread] :
+                                              socket_affinity_masks_[num_thread];
+
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t obj = nullptr;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+        }
+
+        // walk up the tree until we find the data (or unified) cache of the
+        // requested level
+        for (/**/; obj != nullptr; obj = obj->parent)
+        {
+#if HWLOC_API_VERSION >= 0x00020000
+            if (!hwloc_obj_type_is_dcache(obj->type))
+                continue;
+#else
+            if (obj->type != HWLOC_OBJ_CACHE ||
+                obj->attr->cache.type == HWLOC_OBJ_CACHE_INSTRUCTION)
+            {
+                continue;
+            }
+#endif
+            if (obj->attr->cache.depth == level)
+            {
+                mask_type cache_affinity_mask = mask_type();
+                resize(cache_affinity_mask, get_number_of_pus());
+
+                extract_node_mask(obj, cache_affinity_mask);
+                return cache_affinity_mask;
+            }
+        }
+
+        return default_mask;
+    }    // }}}
+
     mask_type topology::init_thread_affinity_mask(std::size_t num_thread) const
     {    // {{{
 
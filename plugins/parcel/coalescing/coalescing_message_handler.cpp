@@ -25,6 +25,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -43,6 +44,8 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      max_latency = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -51,7 +54,9 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "max_latency = 100";
         }
     };
 }}
@@ -87,28 +92,41 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+
+        // the histogram used by adaptive coalescing if it wasn't set up by
+        // the parcel-arrival-histogram counter, the time between parcels is
+        // measured in nanoseconds
+        std::int64_t const histogram_num_buckets = 100;
     }
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        parameters_.set_num_messages(
+            detail::get_num_messages(parameters_.num_messages()));
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        parameters_.set_interval(detail::get_interval(parameters_.interval()));
+    }
+
+    void coalescing_message_handler::update_max_latency()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        parameters_.set_max_latency(
+            detail::get_max_latency(parameters_.max_latency()));
     }
 
     coalescing_message_handler::coalescing_message_handler(
             char const* action_name, parcelset::parcelport* pp, std::size_t num,
             std::size_t interval)
       : pp_(pp),
-        num_coalesced_parcels_(detail::get_num_messages(num)),
-        interval_(detail::get_interval(interval)),
-        buffer_(num_coalesced_parcels_),
+        parameters_(detail::get_num_messages(num),
+            detail::get_interval(interval)),
+        buffer_(parameters_.batch_size()),
         timer_(
             util::bind_back(&coalescing_message_handler::timer_flush, this_()),
             util::bind_back(&coalescing_message_handler::flush_terminate, this_()),
@@ -127,6 +145,24 @@ namespace hpx { namespace plugins { namespace parcel
         histogram_max_boundary_(-1),
         histogram_num_buckets_(-1)
     {
+        // adaptive coalescing is based on the distribution of the time
+        // between parcels
+        if (parameters_.adaptive())
+        {
+            histogram_min_boundary_ = 0;
+            histogram_max_boundary_ =
+                std::int64_t(parameters_.max_latency()) * 1000;
+            histogram_num_buckets_ = detail::histogram_num_buckets;
+
+            time_between_parcels_.reset(new histogram_collector_type(
+                hpx::util::tag::histogram::num_bins =
+                    double(histogram_num_buckets_),
+                hpx::util::tag::histogram::min_range =
+                    double(histogram_min_boundary_),
+                hpx::util::tag::histogram::max_range =
+                    double(histogram_max_boundary_)));
+        }
+
         // register performance counter functions
         coalescing_counter_registry::instance().register_action(action_name,
             util::bind_front(&coalescing_message_handler::get_parcels_count, this),
@@ -145,6 +181,9 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.max_latency",
+            util::bind(&coalescing_message_handler::update_max_latency, this));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -163,7 +202,7 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        std::chrono::microseconds interval(parameters_.flush_interval());
 
         // just send parcel if the coalescing was stopped or the buffer is
         // empty and time since last parcel is larger than coalescing interval.
@@ -272,7 +311,7 @@ namespace hpx { namespace plugins { namespace parcel
         if (buffer_.empty())
             return false;
 
-        detail::message_buffer buff (num_coalesced_parcels_);
+        detail::message_buffer buff (parameters_.batch_size());
         std::swap(buff, buffer_);
 
         ++num_messages_;
@@ -281,6 +320,16 @@ namespace hpx { namespace plugins { namespace parcel
         HPX_ASSERT(nullptr != pp_);
         buff(pp_);                   // 'invoke' the buffer
 
+        if (parameters_.adaptive())
+        {
+            std::int64_t pending_parcels =
+                pp_->get_num_pending_parcels(buff.destination());
+
+            l.lock();
+            if (!stopped_)
+                parameters_.adjust(*time_between_parcels_, pending_parcels);
+        }
+
         return true;
     }
 
@@ -0,0 +1,292 @@
+//  Copyright (c) 2019 Ste||ar Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/config/asio.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport_factory.hpp>
+#include <hpx/util/command_line_handling.hpp>
+
+// parcelport
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+
+#include <hpx/synchronization/detail/yield_k.hpp>
+#include <hpx/util/runtime_configuration.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx
+{
+    bool is_starting();
+}
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT parcelport;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::false_type send_immediate_parcels;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT parcelport
+          : public parcelport_impl<parcelport>
+        {
+            typedef parcelport_impl<parcelport> base_type;
+
+            static parcelset::locality here()
+            {
+                // the pid is unique on this host, which is all we need as
+                // only co-located localities will ever connect
+                return
+                    parcelset::locality(
+                        locality(
+                            boost::asio::ip::host_name(),
+                            "/hpx.shmem." + std::to_string(::getpid())
+                        )
+                    );
+            }
+
+            static std::size_t ring_size(util::runtime_configuration const& ini)
+            {
+                // round up to the next power of two
+                std::size_t size = hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", 262144);
+                std::size_t result = 4096;
+                while (result < size)
+                    result <<= 1;
+                return result;
+            }
+
+            static std::size_t num_slots(util::runtime_configuration const& ini)
+            {
+                std::size_t slots = hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.num_slots", 64);
+                return slots == 0 ? 1 : slots;
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(true)
+              , ring_size_(ring_size(ini))
+              , num_slots_(num_slots(ini))
+              , receiver_(*this)
+            {}
+
+            ~parcelport()
+            {
+                receiver_.stop();
+            }
+
+            /// Start the handling of connections.
+            bool do_run()
+            {
+                receiver_.run(here_.get<locality>().segment(), num_slots_,
+                    ring_size_);
+                stopped_ = false;
+
+                for(std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    io_service_pool_.get_io_service(int(i)).post(
+                        hpx::util::bind(
+                            &parcelport::io_service_work, this
+                        )
+                    );
+                }
+                return true;
+            }
+
+            /// Stop the handling of connections.
+            void do_stop()
+            {
+                while(do_background_work(0, parcelport_background_mode_all))
+                {
+                    if(threads::get_self_ptr())
+                        hpx::this_thread::suspend(hpx::threads::pending,
+                            "shmem::parcelport::do_stop");
+                }
+                stopped_ = true;
+                sender_.clear();
+                receiver_.stop();
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return boost::asio::ip::host_name();
+            }
+
+            /// Only localities living on the same host are reachable through
+            /// shared memory, all others are left to the next parcelport.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override
+            {
+                if (!use_alternative_parcelport)
+                    return false;
+
+                locality const& dest = l.get<locality>();
+                if (dest.host() != here_.get<locality>().host())
+                    return false;
+
+                error_code ec(lightweight);
+                return sender_.get_segment(dest.segment(), ec) != nullptr;
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const & ini) const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_)
+                    return false;
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode_send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode_receive)
+                {
+                    has_work = receiver_.background_work(num_thread) ||
+                        has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+
+            std::size_t const ring_size_;
+            std::size_t const num_slots_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            void io_service_work()
+            {
+                std::size_t k = 0;
+                // We only execute work on the IO service while HPX is starting
+                while(hpx::is_starting())
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work() || has_work;
+                    if(has_work)
+                    {
+                        k = 0;
+                    }
+                    else
+                    {
+                        ++k;
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                                "io_service_work");
+                    }
+                }
+            }
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 1000
+    //
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static char const* priority()
+        {
+            return "1000";
+        }
+
+        static void init(int *argc, char ***argv, util::command_line_handling &cfg)
+        {
+        }
+
+        static char const* call()
+        {
+            return
+                "ring_size = ${HPX_HAVE_PARCELPORT_SHMEM_RING_SIZE:262144}\n"
+                "num_slots = ${HPX_HAVE_PARCELPORT_SHMEM_NUM_SLOTS:64}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::parcelport,
+    shmem);
+
+#endif
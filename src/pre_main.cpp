@@ -99,6 +99,9 @@ int pre_main(runtime_mode mode)
     naming::resolver_client& agas_client = naming::get_agas_client();
     runtime& rt = get_runtime();
 
+    // Send pending reference counting operations periodically as well.
+    agas_client.start_refcnt_requests_timer();
+
     int exit_code = 0;
     if (runtime_mode_connect == mode)
     {
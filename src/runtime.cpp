@@ -6,11 +6,13 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/concurrency/thread_name.hpp>
 #include <hpx/custom_exception_info.hpp>
 #include <hpx/errors.hpp>
 #include <hpx/static_reinit/static_reinit.hpp>
+#include <hpx/functional/bind.hpp>
 #include <hpx/logging.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
@@ -430,10 +432,28 @@ namespace hpx
     }
 #endif
 
+    namespace detail
+    {
+        std::int64_t get_thread_local_cache_hits(bool reset)
+        {
+            return static_cast<std::int64_t>(
+                util::get_thread_local_cache_hits(reset));
+        }
+
+        std::int64_t get_thread_local_cache_misses(bool reset)
+        {
+            return static_cast<std::int64_t>(
+                util::get_thread_local_cache_misses(reset));
+        }
+    }
+
     /// \brief Register all performance counter types related to this runtime
     ///        instance
     void runtime::register_counter_types()
     {
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
         performance_counters::generic_counter_type_data statistic_counter_types[] =
         {
             // averaging counter
@@ -556,6 +576,31 @@ namespace hpx
               ""
             },
 
+            // allocation counters of the per-thread cache used for the
+            // shared states of futures
+            { "/runtime/count/allocator-cache-hits",
+              performance_counters::counter_raw,
+              "returns the number of small objects (like shared states of "
+              "futures) allocated from the memory cached by the allocating "
+              "thread on this locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &detail::get_thread_local_cache_hits, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/runtime/count/allocator-cache-misses",
+              performance_counters::counter_raw,
+              "returns the number of small objects (like shared states of "
+              "futures) which had to be allocated from the system allocator "
+              "on this locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &detail::get_thread_local_cache_misses, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+
             // action invocation counters
             { "/runtime/count/action-invocation", performance_counters::counter_raw,
               "returns the number of (local) invocations of a specific action "
@@ -66,71 +66,6 @@
 
 namespace hpx { namespace agas
 {
-    struct addressing_service::gva_cache_key
-    {    // {{{ gva_cache_key implementation
-    private:
-        typedef std::pair<naming::gid_type, naming::gid_type> key_type;
-
-        key_type key_;
-
-    public:
-        gva_cache_key()
-          : key_()
-        {
-        }
-
-        explicit gva_cache_key(
-                naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    }; // }}}
 
 addressing_service::addressing_service(
     util::runtime_configuration const& ini_
@@ -141,7 +76,10 @@ addressing_service::addressing_service(
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
   , refcnt_requests_count_(0)
   , enable_refcnt_caching_(true)
-  , refcnt_requests_(new refcnt_requests_type)
+  , refcnt_requests_timer_(
+        util::bind_front(&addressing_service::flush_refcnt_requests, this),
+        std::int64_t(ini_.get_agas_refcnt_requests_flush_interval()) * 1000,
+        "addressing_service::flush_refcnt_requests", true)
   , service_type(ini_.get_agas_service_mode())
   , runtime_type(runtime_type_)
   , caching_(ini_.get_agas_caching_mode())
@@ -1589,12 +1527,13 @@ lcos::future<std::int64_t> addressing_service::incref_async(
     std::int64_t pending_decrefs = 0;
 
     {
-        std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
+        refcnt_requests_shard& shard = get_refcnt_requests_shard(raw);
+        std::lock_guard<mutex_type> l(shard.mtx_);
 
         typedef refcnt_requests_type::iterator iterator;
 
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
+        iterator matches = shard.requests_.find(raw);
+        if (matches != shard.requests_.end())
         {
             pending_decrefs = matches->second;
             matches->second += credit;
@@ -1611,13 +1550,13 @@ lcos::future<std::int64_t> addressing_service::incref_async(
                 pending_incref = mapping(matches->first, matches->second);
                 has_pending_incref = true;
 
-                refcnt_requests_->erase(matches);
+                shard.requests_.erase(matches);
             }
             else if (matches->second == 0)
             {
                 // credit == decref (case no. 3): if the incref offsets any
                 // pending decref, just remove the pending decref request.
-                refcnt_requests_->erase(matches);
+                shard.requests_.erase(matches);
             }
             else
             {
@@ -1686,21 +1625,22 @@ void addressing_service::decref(
     }
 
     try {
-        std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+        refcnt_requests_shard& shard = get_refcnt_requests_shard(raw);
+        std::unique_lock<mutex_type> l(shard.mtx_);
 
         // Match the decref request with entries in the incref table
         typedef refcnt_requests_type::iterator iterator;
         typedef refcnt_requests_type::value_type mapping;
 
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
+        iterator matches = shard.requests_.find(raw);
+        if (matches != shard.requests_.end())
         {
             matches->second -= credit;
         }
         else
         {
             std::pair<iterator, bool> p =
-                refcnt_requests_->insert(mapping(raw, -credit));
+                shard.requests_.insert(mapping(raw, -credit));
 
             if (HPX_UNLIKELY(!p.second))
             {
@@ -1714,7 +1654,8 @@ void addressing_service::decref(
             }
         }
 
-        send_refcnt_requests(l, ec);
+        l.unlock();
+        send_refcnt_requests(shard, ec);
     }
     catch (hpx::exception const& e) {
         HPX_RETHROWS_IF(ec, e, "addressing_service::decref");
@@ -1879,17 +1820,6 @@ hpx::future<addressing_service::iterate_names_return_type>
     return symbol_ns_.iterate_async(pattern);
 } // }}}
 
-// This function has to return false if the key is already in the cache (true
-// means go ahead with the cache update).
-bool check_for_collisions(
-    addressing_service::gva_cache_key const& new_key
-  , addressing_service::gva_cache_key const& old_key
-    )
-{
-    return (new_key.get_gid() != old_key.get_gid())
-        || (new_key.get_count() != old_key.get_count());
-}
-
 void addressing_service::update_cache_entry(
     naming::gid_type const& id
   , gva const& g
@@ -1949,33 +1879,23 @@ void addressing_service::update_cache_entry(
             "addressing_service::update_cache_entry, gid({1}), count({2})",
             gid, count);
 
-        const gva_cache_key key(gid, count);
-
+        if (!gva_cache_->update_entry(gid, count, g))
         {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+            if (LAGAS_ENABLED(warning))
             {
-                if (LAGAS_ENABLED(warning))
-                {
-                    // Figure out who we collided with.
-                    addressing_service::gva_cache_key idbase;
-                    addressing_service::gva_cache_type::entry_type e;
-
-                    if (!gva_cache_->get_entry(key, idbase, e))
-                    {
-                        // This is impossible under sane conditions.
-                        lock.unlock();
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
-                        return;
-                    }
+                // Figure out who we collided with, the colliding entry may
+                // have been evicted concurrently.
+                naming::gid_type idbase;
+                gva e;
 
+                if (gva_cache_->get_entry(gid, idbase, e))
+                {
                     LAGAS_(warning) << hpx::util::format(
                         "addressing_service::update_cache_entry, "
                         "aborting update due to key collision in cache, "
-                        "new_gid({1}), new_count({2}), old_gid({3}), old_count({4})",
-                        gid, count, idbase.get_gid(), idbase.get_count());
+                        "new_gid({1}), new_count({2}), old_gid({3}), "
+                        "old_count({4})",
+                        gid, count, idbase, e.count);
                 }
             }
         }
@@ -2000,24 +1920,20 @@ bool addressing_service::get_cache_entry(
     {
         return false;
     }
-    gva_cache_key k(gid);
-    gva_cache_key idbase_key;
-
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-    if(gva_cache_->get_entry(k, idbase_key, gva))
+    naming::gid_type idbase_gid;
+    if(gva_cache_->get_entry(gid, idbase_gid, gva))
     {
         const std::uint64_t id_msb =
             naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
-        if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+        if (HPX_UNLIKELY(id_msb != idbase_gid.get_msb()))
         {
-            lock.unlock();
             HPX_THROWS_IF(ec, internal_server_error
               , "addressing_service::get_cache_entry"
               , "bad entry in cache, MSBs of GID base and GID do not match");
             return false;
         }
-        idbase = idbase_key.get_gid();
+        idbase = idbase_gid;
         return true;
     }
 
@@ -2040,8 +1956,6 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->clear();
 
         if (&ec != &throws)
@@ -2087,13 +2001,7 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->erase(
-            [&gid](std::pair<gva_cache_key, gva> const& p)
-            {
-                return gid == p.first.get_gid();
-            });
+        gva_cache_->erase(gid);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2103,6 +2011,13 @@ void addressing_service::remove_cache_entry(
     }
 }
 
+// Start sending pending credit requests periodically
+void addressing_service::start_refcnt_requests_timer()
+{
+    if (caching_ && refcnt_requests_timer_.get_interval() > 0)
+        refcnt_requests_timer_.start(false);
+}
+
 // Disable refcnt caching during shutdown
 void addressing_service::start_shutdown(error_code& ec)
 {
@@ -2110,9 +2025,8 @@ void addressing_service::start_shutdown(error_code& ec)
     if (!caching_)
         return;
 
-    std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
-    enable_refcnt_caching_ = false;
-    send_refcnt_requests_sync(l, ec);
+    enable_refcnt_caching_.store(false);
+    send_refcnt_requests_sync(false, ec);
 }
 
 namespace detail
@@ -2238,86 +2152,76 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->size();
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().hits(reset);
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().misses(reset);
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().evictions(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().insertions(reset);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_get_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_insert_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_update_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_erase_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_get_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_insert_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_update_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_erase_entry_time(reset);
 }
 
 /// Install performance counter types exposing properties from the local cache.
 void addressing_service::register_counter_types()
 { // {{{
+    using util::placeholders::_1;
+    using util::placeholders::_2;
+
     // install
     util::function_nonser<std::int64_t(bool)> cache_entries(
         util::bind_front(&addressing_service::get_cache_entries, this));
@@ -2493,51 +2397,114 @@ void addressing_service::garbage_collect_non_blocking(
     error_code& ec
     )
 {
-    std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
-    if (!l.owns_lock()) return;     // no need to compete for garbage collection
-
-    send_refcnt_requests_non_blocking(l, ec);
+    // no need to compete for garbage collection
+    send_refcnt_requests_non_blocking(true, ec);
 }
 
 void addressing_service::garbage_collect(
     error_code& ec
     )
 {
-    std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
-    if (!l.owns_lock()) return;     // no need to compete for garbage collection
+    // no need to compete for garbage collection
+    send_refcnt_requests_sync(true, ec);
+}
 
-    send_refcnt_requests_sync(l, ec);
+addressing_service::refcnt_requests_shard&
+addressing_service::get_refcnt_requests_shard(
+    naming::gid_type const& gid
+    )
+{
+    std::uint64_t h = (gid.get_msb() ^ gid.get_lsb()) * 0x9e3779b97f4a7c15ull;
+    return refcnt_requests_[(h >> 32) % num_refcnt_requests_shards].data_;
+}
+
+void addressing_service::collect_refcnt_requests(
+    refcnt_requests_shard& shard
+  , refcnt_requests_type& requests
+    )
+{
+    refcnt_requests_type pending;
+    {
+        std::lock_guard<mutex_type> l(shard.mtx_);
+        pending.swap(shard.requests_);
+    }
+
+    // the shards hold disjoint sets of GIDs
+    if (requests.empty())
+        requests.swap(pending);
+    else
+        requests.insert(pending.begin(), pending.end());
+}
+
+void addressing_service::collect_refcnt_requests(
+    refcnt_requests_type& requests
+  , bool try_lock
+    )
+{
+    for (util::cache_aligned_data<refcnt_requests_shard>& s : refcnt_requests_)
+    {
+        refcnt_requests_shard& shard = s.data_;
+
+        refcnt_requests_type pending;
+        {
+            std::unique_lock<mutex_type> l(shard.mtx_, std::defer_lock);
+            if (try_lock)
+            {
+                if (!l.try_lock())
+                    continue;
+            }
+            else
+            {
+                l.lock();
+            }
+
+            pending.swap(shard.requests_);
+        }
+
+        // the shards hold disjoint sets of GIDs
+        if (requests.empty())
+            requests.swap(pending);
+        else
+            requests.insert(pending.begin(), pending.end());
+    }
+
+    refcnt_requests_count_.store(0, std::memory_order_relaxed);
 }
 
 void addressing_service::send_refcnt_requests(
-    std::unique_lock<addressing_service::mutex_type>& l
+    refcnt_requests_shard& shard
   , error_code& ec
     )
 {
-    if (!l.owns_lock())
+    if (!enable_refcnt_caching_.load(std::memory_order_relaxed))
     {
-        HPX_THROWS_IF(ec, lock_error
-          , "addressing_service::send_refcnt_requests"
-          , "mutex is not locked");
+        // all other shards have been flushed when shutdown started
+        refcnt_requests_type p;
+        collect_refcnt_requests(shard, p);
+        send_refcnt_requests_non_blocking(p, ec);
         return;
     }
 
-    if (!enable_refcnt_caching_ || max_refcnt_requests_ == ++refcnt_requests_count_)
-        send_refcnt_requests_non_blocking(l, ec);
-
+    // exactly one thread sees the count reaching the maximum
+    std::size_t count =
+        refcnt_requests_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count >= max_refcnt_requests_ &&
+        refcnt_requests_count_.compare_exchange_strong(count, 0))
+    {
+        send_refcnt_requests_non_blocking(false, ec);
+    }
     else if (&ec != &throws)
+    {
         ec = make_success_code();
+    }
 }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
-        std::unique_lock<addressing_service::mutex_type>& l
-      , addressing_service::refcnt_requests_type const& requests
+        addressing_service::refcnt_requests_type const& requests
       , const char* func_name
         )
     {
-        HPX_ASSERT(l.owns_lock());
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping client-side refcnt table, requests({2}):",
@@ -2560,35 +2527,48 @@ void addressing_service::send_refcnt_requests(
     }
 #endif
 
+bool addressing_service::flush_refcnt_requests()
+{
+    // don't compete with threads sending the requests already
+    if (refcnt_requests_count_.load(std::memory_order_relaxed) != 0)
+    {
+        error_code ec(lightweight);
+        send_refcnt_requests_non_blocking(true, ec);
+    }
+    return true;
+}
+
 void addressing_service::send_refcnt_requests_non_blocking(
-    std::unique_lock<addressing_service::mutex_type>& l
+    bool try_lock
   , error_code& ec
     )
 {
-    HPX_ASSERT(l.owns_lock());
+    refcnt_requests_type p;
+    collect_refcnt_requests(p, try_lock);
+    send_refcnt_requests_non_blocking(p, ec);
+}
 
+void addressing_service::send_refcnt_requests_non_blocking(
+    refcnt_requests_type const& p
+  , error_code& ec
+    )
+{
     try {
-        if (refcnt_requests_->empty())
+        if (p.empty())
         {
-            l.unlock();
+            if (&ec != &throws)
+                ec = make_success_code();
             return;
         }
 
-        std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
-
-        p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
-
-        l.unlock();
-
         LAGAS_(info) << hpx::util::format(
             "addressing_service::send_refcnt_requests_non_blocking, "
             "requests({1})",
-            p->size());
+            p.size());
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
-            dump_refcnt_requests(l, *p,
+            dump_refcnt_requests(p,
                 "addressing_service::send_refcnt_requests_non_blocking");
 #endif
 
@@ -2603,7 +2583,7 @@ void addressing_service::send_refcnt_requests_non_blocking(
             requests_type;
         requests_type requests;
 
-        for (refcnt_requests_type::const_reference e : *p)
+        for (refcnt_requests_type::const_reference e : p)
         {
             HPX_ASSERT(e.second < 0);
 
@@ -2628,7 +2608,6 @@ void addressing_service::send_refcnt_requests_non_blocking(
             ec = make_success_code();
     }
     catch (hpx::exception const& e) {
-        l.unlock();
         HPX_RETHROWS_IF(ec, e,
             "addressing_service::send_refcnt_requests_non_blocking");
     }
@@ -2636,32 +2615,25 @@ void addressing_service::send_refcnt_requests_non_blocking(
 
 std::vector<hpx::future<std::vector<std::int64_t> > >
 addressing_service::send_refcnt_requests_async(
-    std::unique_lock<addressing_service::mutex_type>& l
+    bool try_lock
     )
 {
-    HPX_ASSERT(l.owns_lock());
+    refcnt_requests_type p;
+    collect_refcnt_requests(p, try_lock);
 
-    if (refcnt_requests_->empty())
+    if (p.empty())
     {
-        l.unlock();
         return std::vector<hpx::future<std::vector<std::int64_t> > >();
     }
 
-    std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
-
-    p.swap(refcnt_requests_);
-    refcnt_requests_count_ = 0;
-
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "addressing_service::send_refcnt_requests_async, "
         "requests({1})",
-        p->size());
+        p.size());
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     if (LAGAS_ENABLED(debug))
-        dump_refcnt_requests(l, *p,
+        dump_refcnt_requests(p,
             "addressing_service::send_refcnt_requests_sync");
 #endif
 
@@ -2677,7 +2649,7 @@ addressing_service::send_refcnt_requests_async(
     requests_type requests;
 
     std::vector<hpx::future<std::vector<std::int64_t> > > lazy_results;
-    for (refcnt_requests_type::const_reference e : *p)
+    for (refcnt_requests_type::const_reference e : p)
     {
         HPX_ASSERT(e.second < 0);
 
@@ -2703,12 +2675,12 @@ addressing_service::send_refcnt_requests_async(
 }
 
 void addressing_service::send_refcnt_requests_sync(
-    std::unique_lock<addressing_service::mutex_type>& l
+    bool try_lock
   , error_code& ec
     )
 {
     std::vector<hpx::future<std::vector<std::int64_t> > > lazy_results =
-        send_refcnt_requests_async(l);
+        send_refcnt_requests_async(try_lock);
 
     // re throw possible errors
     when_all(lazy_results).get();
@@ -0,0 +1,626 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/gva_cache.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/synchronization/detail/yield_k.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace agas
+{
+
+constexpr std::size_t gva_cache::block_bits;
+constexpr std::size_t gva_cache::num_ways;
+constexpr std::size_t gva_cache::num_range_entries;
+
+constexpr std::size_t gva_cache::statistics::num_counters;
+constexpr std::size_t gva_cache::statistics::num_stripes;
+
+namespace
+{
+    // Helper class to update timings and counts on function exit
+    struct update_on_exit
+    {
+        static std::uint64_t now()
+        {
+            std::chrono::nanoseconds ns = std::chrono::duration_cast<
+                std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch());
+            return static_cast<std::uint64_t>(ns.count());
+        }
+
+        update_on_exit(gva_cache::statistics& stat,
+                gva_cache::statistics::method m)
+          : started_at_(now())
+          , statistics_(stat)
+          , method_(m)
+        {}
+
+        ~update_on_exit()
+        {
+            statistics_.add_call(method_, now() - started_at_);
+        }
+
+        std::uint64_t started_at_;
+        gva_cache::statistics& statistics_;
+        gva_cache::statistics::method method_;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+gva_cache::statistics::statistics()
+{
+    for (util::cache_aligned_data<counters_type>& stripe : stripes_)
+    {
+        for (std::atomic<std::uint64_t>& c : stripe.data_)
+            c.store(0, std::memory_order_relaxed);
+    }
+}
+
+void gva_cache::statistics::add(std::size_t c, std::uint64_t value)
+{
+    // threads which are not HPX worker threads share the last stripe
+    std::size_t const stripe =
+        (std::min)(hpx::get_worker_thread_num(), num_stripes - 1);
+    stripes_[stripe].data_[c].fetch_add(value, std::memory_order_relaxed);
+}
+
+std::uint64_t gva_cache::statistics::get(std::size_t c, bool reset)
+{
+    std::uint64_t result = 0;
+    for (util::cache_aligned_data<counters_type>& stripe : stripes_)
+    {
+        result += reset ?
+            stripe.data_[c].exchange(0, std::memory_order_relaxed) :
+            stripe.data_[c].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void gva_cache::statistics::got_hit()
+{
+    add(counter_hits, 1);
+}
+
+void gva_cache::statistics::got_miss()
+{
+    add(counter_misses, 1);
+}
+
+void gva_cache::statistics::got_insertion()
+{
+    add(counter_insertions, 1);
+}
+
+void gva_cache::statistics::got_eviction()
+{
+    add(counter_evictions, 1);
+}
+
+void gva_cache::statistics::add_call(method m, std::uint64_t time)
+{
+    add(counter_calls + m, 1);
+    add(counter_time + m, time);
+}
+
+std::uint64_t gva_cache::statistics::hits(bool reset)
+{
+    return get(counter_hits, reset);
+}
+
+std::uint64_t gva_cache::statistics::misses(bool reset)
+{
+    return get(counter_misses, reset);
+}
+
+std::uint64_t gva_cache::statistics::insertions(bool reset)
+{
+    return get(counter_insertions, reset);
+}
+
+std::uint64_t gva_cache::statistics::evictions(bool reset)
+{
+    return get(counter_evictions, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_get_entry_count(bool reset)
+{
+    return get(counter_calls + method_get_entry, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_insert_entry_count(bool reset)
+{
+    return get(counter_calls + method_insert_entry, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_update_entry_count(bool reset)
+{
+    return get(counter_calls + method_update_entry, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_erase_entry_count(bool reset)
+{
+    return get(counter_calls + method_erase_entry, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_get_entry_time(bool reset)
+{
+    return get(counter_time + method_get_entry, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_insert_entry_time(bool reset)
+{
+    return get(counter_time + method_insert_entry, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_update_entry_time(bool reset)
+{
+    return get(counter_time + method_update_entry, reset);
+}
+
+std::uint64_t gva_cache::statistics::get_erase_entry_time(bool reset)
+{
+    return get(counter_time + method_erase_entry, reset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+gva_cache::slot::slot()
+  : sequence_(0)
+  , base_msb_(0)
+  , base_lsb_(0)
+  , count_(0)
+  , prefix_msb_(0)
+  , prefix_lsb_(0)
+  , type_(0)
+  , gva_count_(0)
+  , lva_(0)
+  , offset_(0)
+  , referenced_(false)
+{}
+
+bool gva_cache::slot::load(std::uint64_t msb, std::uint64_t lsb,
+    naming::gid_type& base, gva& g) const
+{
+    for (std::size_t k = 0; /**/; ++k)
+    {
+        std::uint64_t const seq = sequence_.load(std::memory_order_acquire);
+        if (seq & 1)
+        {
+            util::detail::yield_k(k, "hpx::agas::gva_cache::slot::load");
+            continue;
+        }
+
+        std::uint64_t const count = count_.load(std::memory_order_relaxed);
+        std::uint64_t const base_msb = base_msb_.load(std::memory_order_relaxed);
+        std::uint64_t const base_lsb = base_lsb_.load(std::memory_order_relaxed);
+
+        bool const matches = count != 0 && base_msb == msb &&
+            base_lsb <= lsb && lsb - base_lsb < count;
+
+        std::uint64_t prefix_msb = 0, prefix_lsb = 0, gva_count = 0;
+        std::uint64_t lva = 0, offset = 0;
+        std::int32_t type = 0;
+        if (matches)
+        {
+            prefix_msb = prefix_msb_.load(std::memory_order_relaxed);
+            prefix_lsb = prefix_lsb_.load(std::memory_order_relaxed);
+            type = type_.load(std::memory_order_relaxed);
+            gva_count = gva_count_.load(std::memory_order_relaxed);
+            lva = lva_.load(std::memory_order_relaxed);
+            offset = offset_.load(std::memory_order_relaxed);
+        }
+
+        // make sure the slot was not modified while reading it
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) != seq)
+            continue;
+
+        if (!matches)
+            return false;
+
+        base = naming::gid_type(base_msb, base_lsb);
+        g = gva(naming::gid_type(prefix_msb, prefix_lsb), type, gva_count,
+            lva, offset);
+
+        // avoid writing to the shared cache line if possible
+        if (!referenced_.load(std::memory_order_relaxed))
+            referenced_.store(true, std::memory_order_relaxed);
+
+        return true;
+    }
+}
+
+// Assumes that the set holding the slot is locked.
+void gva_cache::slot::store(naming::gid_type const& base, std::uint64_t count,
+    gva const& g)
+{
+    std::uint64_t const seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    base_msb_.store(base.get_msb(), std::memory_order_relaxed);
+    base_lsb_.store(base.get_lsb(), std::memory_order_relaxed);
+    count_.store(count, std::memory_order_relaxed);
+    prefix_msb_.store(g.prefix.get_msb(), std::memory_order_relaxed);
+    prefix_lsb_.store(g.prefix.get_lsb(), std::memory_order_relaxed);
+    type_.store(g.type, std::memory_order_relaxed);
+    gva_count_.store(g.count, std::memory_order_relaxed);
+    lva_.store(g.lva(), std::memory_order_relaxed);
+    offset_.store(g.offset, std::memory_order_relaxed);
+    referenced_.store(true, std::memory_order_relaxed);
+
+    sequence_.store(seq + 2, std::memory_order_release);
+}
+
+// Assumes that the set holding the slot is locked.
+void gva_cache::slot::reset()
+{
+    std::uint64_t const seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    count_.store(0, std::memory_order_relaxed);
+    referenced_.store(false, std::memory_order_relaxed);
+
+    sequence_.store(seq + 2, std::memory_order_release);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Assumes that the set is locked.
+template <std::size_t N>
+std::size_t gva_cache::set<N>::find(naming::gid_type const& base) const
+{
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        slot const& s = slots_[i];
+        if (s.count_.load(std::memory_order_relaxed) != 0 &&
+            s.base_msb_.load(std::memory_order_relaxed) == base.get_msb() &&
+            s.base_lsb_.load(std::memory_order_relaxed) == base.get_lsb())
+        {
+            return i;
+        }
+    }
+    return N;
+}
+
+// Select the slot to replace using the CLOCK algorithm. Assumes that the set
+// is locked.
+template <std::size_t N>
+std::size_t gva_cache::set<N>::victim()
+{
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        if (slots_[i].count_.load(std::memory_order_relaxed) == 0)
+            return i;
+    }
+
+    for (/**/; /**/; hand_ = (hand_ + 1) % N)
+    {
+        slot& s = slots_[hand_];
+        if (!s.referenced_.load(std::memory_order_relaxed))
+        {
+            std::size_t const result = hand_;
+            hand_ = (hand_ + 1) % N;
+            return result;
+        }
+        s.referenced_.store(false, std::memory_order_relaxed);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+gva_cache::table::table(std::size_t num_sets)
+  : mask_(num_sets - 1)
+  , sets_(new util::cache_aligned_data<small_set>[num_sets])
+  , size_(0)
+{
+    HPX_ASSERT((num_sets & mask_) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+gva_cache::gva_cache(std::size_t size)
+  : table_(nullptr)
+{
+    reserve(size);
+}
+
+void gva_cache::reserve(std::size_t size)
+{
+    std::size_t num_sets = 1;
+    while (num_sets * num_ways < size)
+        num_sets <<= 1;
+
+    std::unique_ptr<table> t(new table(num_sets));
+
+    std::lock_guard<mutex_type> l(tables_mtx_);
+    table_.store(t.get(), std::memory_order_release);
+    tables_.push_back(std::move(t));
+}
+
+std::size_t gva_cache::size() const
+{
+    return table_.load(std::memory_order_acquire)->size_.load(
+        std::memory_order_relaxed);
+}
+
+std::size_t gva_cache::capacity() const
+{
+    table const* t = table_.load(std::memory_order_acquire);
+    return (t->mask_ + 1) * num_ways + num_range_entries;
+}
+
+std::size_t gva_cache::set_index(std::uint64_t msb, std::uint64_t key,
+    std::uint64_t tag)
+{
+    std::uint64_t h = msb ^ ((key + tag) * 0x9e3779b97f4a7c15ull);
+    h ^= h >> 31;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 29;
+    return std::size_t(h);
+}
+
+gva_cache::small_set& gva_cache::get_set(table& t,
+    naming::gid_type const& base, std::uint64_t count) const
+{
+    HPX_ASSERT(count <= (std::uint64_t(1) << block_bits));
+
+    std::size_t const index = count == 1 ?
+        set_index(base.get_msb(), base.get_lsb(), 0) :
+        set_index(base.get_msb(), base.get_lsb() >> block_bits, 1);
+
+    return t.sets_[index & t.mask_].data_;
+}
+
+bool gva_cache::lookup(table const& t, std::uint64_t msb, std::uint64_t lsb,
+    naming::gid_type& base, gva& g) const
+{
+    // ranges with a count of one
+    small_set const& s =
+        t.sets_[set_index(msb, lsb, 0) & t.mask_].data_;
+    for (slot const& e : s.slots_)
+    {
+        if (e.load(msb, lsb, base, g))
+            return true;
+    }
+
+    // small ranges start in the block of the GID or in the one before
+    std::uint64_t const block = lsb >> block_bits;
+    for (std::uint64_t b = block; /**/; --b)
+    {
+        small_set const& bs =
+            t.sets_[set_index(msb, b, 1) & t.mask_].data_;
+        for (slot const& e : bs.slots_)
+        {
+            if (e.load(msb, lsb, base, g))
+                return true;
+        }
+
+        if (b == 0 || b + 1 == block)
+            break;
+    }
+
+    // large ranges
+    for (slot const& e : t.ranges_.data_.slots_)
+    {
+        if (e.load(msb, lsb, base, g))
+            return true;
+    }
+
+    return false;
+}
+
+bool gva_cache::get_entry(naming::gid_type const& id, naming::gid_type& base,
+    gva& g)
+{
+    update_on_exit update(statistics_, statistics::method_get_entry);
+
+    naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+    table const* t = table_.load(std::memory_order_acquire);
+    if (lookup(*t, gid.get_msb(), gid.get_lsb(), base, g))
+    {
+        statistics_.got_hit();
+        return true;
+    }
+
+    statistics_.got_miss();
+    return false;
+}
+
+// Return whether a cached range other than the given one overlaps with it.
+// Assumes that update_mtx_ is locked, such that entries can only be removed
+// concurrently.
+bool gva_cache::overlaps(table const& t, naming::gid_type const& base,
+    std::uint64_t count) const
+{
+    std::uint64_t const msb = base.get_msb();
+    std::uint64_t const first = base.get_lsb();
+    std::uint64_t const last = first + (count - 1);
+
+    auto overlaps_set = [&](auto const& s) {
+        for (slot const& e : s.slots_)
+        {
+            std::uint64_t const c = e.count_.load(std::memory_order_relaxed);
+            if (c == 0 ||
+                e.base_msb_.load(std::memory_order_relaxed) != msb)
+            {
+                continue;
+            }
+
+            std::uint64_t const f =
+                e.base_lsb_.load(std::memory_order_relaxed);
+            if (f > last || first > f + (c - 1))
+                continue;
+
+            // updating the same range is fine
+            if (f != first || c != count)
+                return true;
+        }
+        return false;
+    };
+
+    if (count > (std::uint64_t(1) << block_bits))
+    {
+        // a large range may overlap with entries in any of the sets
+        for (std::size_t i = 0; i != t.mask_ + 1; ++i)
+        {
+            if (overlaps_set(t.sets_[i].data_))
+                return true;
+        }
+    }
+    else
+    {
+        // ranges with a count of one
+        for (std::uint64_t lsb = first; /**/; ++lsb)
+        {
+            if (overlaps_set(t.sets_[set_index(msb, lsb, 0) & t.mask_].data_))
+                return true;
+
+            if (lsb == last)
+                break;
+        }
+
+        // small ranges start in the block before the first GID at the
+        // earliest and in the block of the last GID at the latest
+        std::uint64_t const first_block = first >> block_bits;
+        std::uint64_t const last_block = last >> block_bits;
+        for (std::uint64_t b = first_block == 0 ? 0 : first_block - 1;
+             /**/; ++b)
+        {
+            if (overlaps_set(t.sets_[set_index(msb, b, 1) & t.mask_].data_))
+                return true;
+
+            if (b == last_block)
+                break;
+        }
+    }
+
+    return overlaps_set(t.ranges_.data_);
+}
+
+// Assumes that update_mtx_ is locked and that no other range overlaps with
+// the given one.
+template <std::size_t N>
+bool gva_cache::update_set(table& t, set<N>& s, naming::gid_type const& base,
+    std::uint64_t count, gva const& g, statistics::method& m)
+{
+    std::lock_guard<mutex_type> l(s.mtx_);
+
+    std::size_t const i = s.find(base);
+    if (i != N)
+    {
+        HPX_ASSERT(s.slots_[i].count_.load(std::memory_order_relaxed) ==
+            count);
+
+        s.slots_[i].store(base, count, g);
+        statistics_.got_hit();
+        return true;
+    }
+
+    m = statistics::method_insert_entry;
+
+    slot& e = s.slots_[s.victim()];
+    if (e.count_.load(std::memory_order_relaxed) != 0)
+        statistics_.got_eviction();
+    else
+        ++t.size_;
+
+    e.store(base, count, g);
+
+    statistics_.got_miss();
+    statistics_.got_insertion();
+    return true;
+}
+
+bool gva_cache::update_entry(naming::gid_type const& id, std::uint64_t count,
+    gva const& g)
+{
+    HPX_ASSERT(count != 0);
+
+    // this is accounted as an insertion if the range is not cached yet
+    update_on_exit update(statistics_, statistics::method_update_entry);
+
+    naming::gid_type const base = naming::detail::get_stripped_gid(id);
+
+    std::lock_guard<mutex_type> l(update_mtx_);
+
+    // refuse to store ranges overlapping with a cached range, except for
+    // the same range
+    table* t = table_.load(std::memory_order_acquire);
+    if (overlaps(*t, base, count))
+        return false;
+
+    if (count > (std::uint64_t(1) << block_bits))
+    {
+        return update_set(
+            *t, t->ranges_.data_, base, count, g, update.method_);
+    }
+
+    return update_set(
+        *t, get_set(*t, base, count), base, count, g, update.method_);
+}
+
+template <std::size_t N>
+void gva_cache::erase_set(table& t, set<N>& s, naming::gid_type const& base)
+{
+    std::lock_guard<mutex_type> l(s.mtx_);
+
+    std::size_t const i = s.find(base);
+    if (i != N)
+    {
+        s.slots_[i].reset();
+        --t.size_;
+    }
+}
+
+void gva_cache::erase(naming::gid_type const& id)
+{
+    update_on_exit update(statistics_, statistics::method_erase_entry);
+
+    naming::gid_type const base = naming::detail::get_stripped_gid(id);
+
+    table* t = table_.load(std::memory_order_acquire);
+    erase_set(*t, get_set(*t, base, 1), base);
+    erase_set(*t, get_set(*t, base, 2), base);
+    erase_set(*t, t->ranges_.data_, base);
+}
+
+void gva_cache::clear()
+{
+    table* t = table_.load(std::memory_order_acquire);
+
+    auto clear_set = [t](auto& s) {
+        std::lock_guard<mutex_type> l(s.mtx_);
+        for (slot& e : s.slots_)
+        {
+            if (e.count_.load(std::memory_order_relaxed) != 0)
+            {
+                e.reset();
+                --t->size_;
+            }
+        }
+    };
+
+    for (std::size_t i = 0; i != t->mask_ + 1; ++i)
+        clear_set(t->sets_[i].data_);
+
+    clear_set(t->ranges_.data_);
+}
+
+}}
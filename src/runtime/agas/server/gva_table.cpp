@@ -0,0 +1,345 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/server/gva_table.hpp>
+#include <hpx/runtime/naming/name.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace agas { namespace server
+{
+
+constexpr std::size_t gva_table::block_bits;
+constexpr std::size_t gva_table::num_shards;
+
+gva_table::gva_table()
+  : max_count_(0)
+{}
+
+std::size_t gva_table::shard_index(std::uint64_t msb, std::uint64_t block)
+{
+    // consecutive blocks are spread over all shards
+    std::uint64_t h = msb ^ (block * 0x9e3779b97f4a7c15ull);
+    h ^= h >> 31;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 29;
+    return std::size_t(h & (num_shards - 1));
+}
+
+gva_table::shard& gva_table::get_shard(naming::gid_type const& id)
+{
+    return shards_[shard_index(id.get_msb(), id.get_lsb() >> block_bits)]
+        .data_;
+}
+
+gva_table::shard const& gva_table::get_shard(naming::gid_type const& id) const
+{
+    return shards_[shard_index(id.get_msb(), id.get_lsb() >> block_bits)]
+        .data_;
+}
+
+bool gva_table::find(naming::gid_type const& id, naming::gid_type& base,
+    data_type& data) const
+{
+    std::uint64_t const max_count = max_count_.load(std::memory_order_acquire);
+    if (max_count == 0)
+        return false;
+
+    std::uint64_t const msb = id.get_msb();
+    std::uint64_t const lsb = id.get_lsb();
+
+    // the base of any range covering id is in [lowest, lsb]
+    std::uint64_t const lowest = lsb > max_count - 1 ? lsb - (max_count - 1) : 0;
+
+    std::uint64_t const first_block = lowest >> block_bits;
+    std::uint64_t const last_block = lsb >> block_bits;
+
+    if (last_block - first_block < num_shards)
+    {
+        // visit the blocks in descending order, the first range found which
+        // has its base in the visited block is the one we're looking for
+        for (std::uint64_t block = last_block; /**/; --block)
+        {
+            std::uint64_t const block_begin =
+                (std::max)(block << block_bits, lowest);
+
+            shard const& s = shards_[shard_index(msb, block)].data_;
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                map_type::const_iterator it = s.entries_.upper_bound(id);
+                if (it != s.entries_.begin())
+                {
+                    --it;
+                    if (it->first.get_msb() == msb &&
+                        it->first.get_lsb() >= block_begin)
+                    {
+                        base = it->first;
+                        data = it->second;
+                        return true;
+                    }
+                }
+            }
+
+            if (block == first_block)
+                break;
+        }
+        return false;
+    }
+
+    // very large ranges have been bound, look at all shards
+    bool found = false;
+    for (util::cache_aligned_data<shard> const& sd : shards_)
+    {
+        shard const& s = sd.data_;
+
+        std::lock_guard<mutex_type> l(s.mtx_);
+
+        map_type::const_iterator it = s.entries_.upper_bound(id);
+        if (it != s.entries_.begin())
+        {
+            --it;
+            if (it->first.get_msb() == msb && it->first.get_lsb() >= lowest &&
+                (!found || base < it->first))
+            {
+                base = it->first;
+                data = it->second;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+bool gva_table::get(naming::gid_type const& id, data_type& data) const
+{
+    shard const& s = get_shard(id);
+
+    std::lock_guard<mutex_type> l(s.mtx_);
+
+    map_type::const_iterator it = s.entries_.find(id);
+    if (it == s.entries_.end())
+        return false;
+
+    data = it->second;
+    return true;
+}
+
+// The shards holding the given blocks.
+gva_table::shard_set gva_table::get_shards(std::uint64_t msb,
+    std::uint64_t first_block, std::uint64_t last_block)
+{
+    shard_set shards;
+    if (last_block - first_block < num_shards)
+    {
+        for (std::uint64_t block = first_block; /**/; ++block)
+        {
+            shards.set(shard_index(msb, block));
+            if (block == last_block)
+                break;
+        }
+    }
+    else
+    {
+        shards.set();
+    }
+    return shards;
+}
+
+// Lock the given shards in the order of their index to avoid deadlocks
+// between concurrent insertions.
+void gva_table::lock_shards(shard_set const& shards)
+{
+    for (std::size_t i = 0; i != num_shards; ++i)
+    {
+        if (shards.test(i))
+            shards_[i].data_.mtx_.lock();
+    }
+}
+
+void gva_table::unlock_shards(shard_set const& shards)
+{
+    for (std::size_t i = 0; i != num_shards; ++i)
+    {
+        if (shards.test(i))
+            shards_[i].data_.mtx_.unlock();
+    }
+}
+
+struct gva_table::unlock_on_exit
+{
+    ~unlock_on_exit()
+    {
+        table_.unlock_shards(shards_);
+    }
+
+    gva_table& table_;
+    shard_set const& shards_;
+};
+
+bool gva_table::insert(naming::gid_type const& id, data_type const& data)
+{
+    std::uint64_t const count = (std::max)(data.first.count, std::uint64_t(1));
+    std::uint64_t const msb = id.get_msb();
+    std::uint64_t const first = id.get_lsb();
+    std::uint64_t const last = first + (count - 1);
+
+    // Lock all shards which may hold the base of a range overlapping with
+    // the new one. Concurrent insertions of overlapping ranges lock at least
+    // one common shard, one of them will see the other.
+    std::uint64_t lowest = 0;
+    shard_set shards;
+    for (;;)
+    {
+        std::uint64_t const max_count =
+            max_count_.load(std::memory_order_acquire);
+        std::uint64_t const reach = max_count == 0 ? 0 : max_count - 1;
+        lowest = first > reach ? first - reach : 0;
+
+        shards = get_shards(msb, lowest >> block_bits, last >> block_bits);
+        lock_shards(shards);
+
+        // the largest count might have changed in the meantime
+        if (max_count == max_count_.load(std::memory_order_acquire))
+            break;
+
+        unlock_shards(shards);
+    }
+
+    unlock_on_exit on_exit{*this, shards};
+
+    naming::gid_type const lower(msb, lowest);
+    naming::gid_type const upper(msb, last);
+    for (std::size_t i = 0; i != num_shards; ++i)
+    {
+        if (!shards.test(i))
+            continue;
+
+        map_type const& entries = shards_[i].data_.entries_;
+        for (map_type::const_iterator it = entries.lower_bound(lower);
+             it != entries.end() && !(upper < it->first); ++it)
+        {
+            std::uint64_t const c =
+                (std::max)(it->second.first.count, std::uint64_t(1));
+            if (it->first.get_lsb() + (c - 1) >= first)
+                return false;
+        }
+    }
+
+    shard& s = get_shard(id);
+
+    count_map_type::iterator c = s.counts_.emplace(count, 0).first;
+    try
+    {
+        s.entries_.insert(map_type::value_type(id, data));
+    }
+    catch (...)
+    {
+        if (c->second == 0)
+            s.counts_.erase(c);
+        throw;
+    }
+    ++c->second;
+
+    // make lookups aware of the size of the new range, this happens before
+    // the shards are unlocked such that concurrent insertions retry with the
+    // larger count
+    std::uint64_t max_count = max_count_.load(std::memory_order_relaxed);
+    while (max_count < count &&
+        !max_count_.compare_exchange_weak(
+            max_count, count, std::memory_order_acq_rel))
+    {
+    }
+
+    return true;
+}
+
+// Recompute the largest count after the last range with that count was
+// removed. No insertion is in progress while all shards are locked.
+void gva_table::lower_max_count()
+{
+    shard_set shards;
+    shards.set();
+    lock_shards(shards);
+
+    unlock_on_exit on_exit{*this, shards};
+
+    std::uint64_t max_count = 0;
+    for (util::cache_aligned_data<shard> const& sd : shards_)
+    {
+        count_map_type const& counts = sd.data_.counts_;
+        if (!counts.empty())
+            max_count = (std::max)(max_count, counts.rbegin()->first);
+    }
+
+    max_count_.store(max_count, std::memory_order_release);
+}
+
+bool gva_table::update(naming::gid_type const& id, gva const& g,
+    naming::gid_type const& locality)
+{
+    shard& s = get_shard(id);
+
+    std::lock_guard<mutex_type> l(s.mtx_);
+
+    map_type::iterator it = s.entries_.find(id);
+    if (it == s.entries_.end())
+        return false;
+
+    gva& gaddr = it->second.first;
+    gaddr.prefix = g.prefix;
+    gaddr.type = g.type;
+    gaddr.lva(g.lva());
+    gaddr.offset = g.offset;
+    it->second.second = locality;
+
+    return true;
+}
+
+bool gva_table::erase(naming::gid_type const& id, data_type& data)
+{
+    shard& s = get_shard(id);
+
+    bool lower = false;
+    {
+        std::lock_guard<mutex_type> l(s.mtx_);
+
+        map_type::iterator it = s.entries_.find(id);
+        if (it == s.entries_.end())
+            return false;
+
+        data = it->second;
+        s.entries_.erase(it);
+
+        std::uint64_t const count =
+            (std::max)(data.first.count, std::uint64_t(1));
+        count_map_type::iterator c = s.counts_.find(count);
+        HPX_ASSERT(c != s.counts_.end() && c->second != 0);
+        if (--c->second == 0)
+            s.counts_.erase(c);
+
+        // other shards might still hold a range with the largest count
+        lower = count == max_count_.load(std::memory_order_relaxed) &&
+            (s.counts_.empty() || s.counts_.rbegin()->first < count);
+    }
+
+    if (lower)
+        lower_max_count();
+
+    return true;
+}
+
+}}}
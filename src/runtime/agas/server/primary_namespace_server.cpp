@@ -31,7 +31,6 @@
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/timing/scoped_timer.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
-#include <hpx/util/insert_checked.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -234,7 +233,7 @@ primary_namespace::begin_migration(naming::gid_type id)
     std::unique_lock<mutex_type> l(mutex_);
 
     wait_for_migration_locked(l, id, hpx::throws);
-    resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+    resolved_type r = resolve_gid_impl(id, hpx::throws);
     if (get<0>(r) == naming::invalid_gid)
     {
         l.unlock();
@@ -346,40 +345,29 @@ bool primary_namespace::bind_gid(
     naming::gid_type gid = id;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
-
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
-
-    if (it != end)
+    naming::gid_type base;
+    gva_table_data_type data;
+    if (gvas_.find(id, base, data))
     {
         // If we got an exact match, this is a request to update an existing
         // binding (e.g. move semantics).
-        if (it->first == id)
+        if (base == id)
         {
             // non-migratable gids can't be rebound
             if (naming::refers_to_local_lva(gid) &&
                 !naming::refers_to_virtual_memory(gid))
             {
-                l.unlock();
-
                 HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
                     "cannot rebind gids for non-migratable objects");
 
                 return false;
             }
 
-            gva& gaddr = it->second.first;
-            naming::gid_type& loc = it->second.second;
-
             // Check for count mismatch (we can't change block sizes of
             // existing bindings).
-            if (HPX_UNLIKELY(gaddr.count != g.count))
+            if (HPX_UNLIKELY(data.first.count != g.count))
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
-
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
                   , "cannot change block size of existing binding");
@@ -387,8 +375,6 @@ bool primary_namespace::bind_gid(
 
             if (HPX_UNLIKELY(components::component_invalid == g.type))
             {
-                l.unlock();
-
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
                   , hpx::util::format(
@@ -399,8 +385,6 @@ bool primary_namespace::bind_gid(
 
             if (HPX_UNLIKELY(!locality))
             {
-                l.unlock();
-
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
                   , hpx::util::format(
@@ -409,52 +393,23 @@ bool primary_namespace::bind_gid(
                         id, g, locality));
             }
 
-            // Store the new endpoint and offset
-            gaddr.prefix = g.prefix;
-            gaddr.type   = g.type;
-            gaddr.lva(g.lva());
-            gaddr.offset = g.offset;
-            loc = locality;
-
-            l.unlock();
-
-            LAGAS_(info) << hpx::util::format(
-                "primary_namespace::bind_gid, gid({1}), gva({2}), "
-                "locality({3}), response(repeated_request)",
-                id, g, locality);
-
-            return false;
-        }
-
-        // We're about to decrement the iterator it - first, we
-        // check that it's safe to do this.
-        else if (it != begin)
-        {
-            --it;
-
-            // Check that a previous range doesn't cover the new id.
-            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
+            // Store the new endpoint and offset, if the binding was removed
+            // concurrently we insert it anew below.
+            if (gvas_.update(id, g, locality))
             {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
+                LAGAS_(info) << hpx::util::format(
+                    "primary_namespace::bind_gid, gid({1}), gva({2}), "
+                    "locality({3}), response(repeated_request)",
+                    id, g, locality);
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "the new GID is contained in an existing range");
+                return false;
             }
         }
-    }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
 
         // Check that a previous range doesn't cover the new id.
-        if ((it->first + it->second.first.count) > id)
+        else if (HPX_UNLIKELY((base + data.first.count) > id))
         {
             // REVIEW: Is this the right error code to use?
-            l.unlock();
-
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::bind_gid"
               , "the new GID is contained in an existing range");
@@ -476,8 +431,6 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
     {
-        l.unlock();
-
         HPX_THROW_EXCEPTION(internal_server_error
           , "primary_namespace::bind_gid"
           , "MSBs of lower and upper range bound do not match");
@@ -485,8 +438,6 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(components::component_invalid == g.type))
     {
-        l.unlock();
-
         HPX_THROW_EXCEPTION(bad_parameter
           , "primary_namespace::bind_gid"
           , hpx::util::format(
@@ -495,22 +446,18 @@ bool primary_namespace::bind_gid(
                 id, g, locality));
     }
 
-    // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
-            std::make_pair(id, std::make_pair(g, locality))))))
+    // Insert a GID -> GVA entry into the GVA table, this fails if the new
+    // range overlaps with an existing one.
+    if (HPX_UNLIKELY(!gvas_.insert(id, std::make_pair(g, locality))))
     {
-        l.unlock();
-
-        HPX_THROW_EXCEPTION(lock_error
+        HPX_THROW_EXCEPTION(bad_parameter
           , "primary_namespace::bind_gid"
           , hpx::util::format(
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid({1}), gva({2}), locality({3})",
+                "the new range overlaps with an existing range, "
+                "gid({1}), gva({2}), locality({3})",
                 id, g, locality));
     }
 
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
         id, g, locality);
@@ -530,17 +477,20 @@ primary_namespace::resolved_type primary_namespace::resolve_gid(
 
     resolved_type r;
 
+    if (naming::detail::is_migratable(id))
     {
         std::unique_lock<mutex_type> l(mutex_);
 
         // wait for any migration to be completed
-        if (naming::detail::is_migratable(id))
-        {
-            wait_for_migration_locked(l, id, hpx::throws);
-        }
+        wait_for_migration_locked(l, id, hpx::throws);
 
         // now, resolve the id
-        r = resolve_gid_locked(l, id, hpx::throws);
+        r = resolve_gid_impl(id, hpx::throws);
+    }
+    else
+    {
+        // the GVA table has its own locks
+        r = resolve_gid_impl(id, hpx::throws);
     }
 
     if (get<0>(r) == naming::invalid_gid)
@@ -577,34 +527,27 @@ naming::address primary_namespace::unbind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
-
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
-
-    if (it != end)
+    gva_table_data_type data;
+    if (gvas_.get(id, data))
     {
-        if (HPX_UNLIKELY(it->second.first.count != count))
+        if (HPX_UNLIKELY(data.first.count != count))
         {
-            l.unlock();
-
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::unbind_gid"
               , "block sizes must match");
         }
 
-        gva_table_data_type data = it->second;
-
-        gvas_.erase(it);
-
-        l.unlock();
-        LAGAS_(info) << hpx::util::format(
-            "primary_namespace::unbind_gid, gid({1}), count({2}), gva({3}), "
-            "locality_id({4})",
-            id, count, data.first, data.second);
+        // the binding may have been removed concurrently
+        if (gvas_.erase(id, data))
+        {
+            LAGAS_(info) << hpx::util::format(
+                "primary_namespace::unbind_gid, gid({1}), count({2}), "
+                "gva({3}), locality_id({4})",
+                id, count, data.first, data.second);
 
-        gva g = data.first;
-        return naming::address(g.prefix, g.type, g.lva());
+            gva g = data.first;
+            return naming::address(g.prefix, g.type, g.lva());
+        }
     }
 
     // non-migratable gids are not bound
@@ -624,8 +567,6 @@ naming::address primary_namespace::unbind_gid(
         return naming::address(g.prefix, g.type, g.lva());
     }
 
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::unbind_gid, gid({1}), count({2}), "
         "response(no_success)",
@@ -926,7 +867,7 @@ void primary_namespace::resolve_free_list(
         }
 
         // Resolve the query GID.
-        resolved_type r = resolve_gid_locked(l, gid, ec);
+        resolved_type r = resolve_gid_impl(gid, ec);
         if (ec) return;
 
         naming::gid_type& raw = get<0>(r);
@@ -1174,14 +1115,11 @@ void primary_namespace::free_components_sync(
         ec = make_success_code();
 } // }}}
 
-primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-    std::unique_lock<mutex_type>& l
-  , naming::gid_type const& gid
+primary_namespace::resolved_type primary_namespace::resolve_gid_impl(
+    naming::gid_type const& gid
   , error_code& ec
     )
-{ // {{{ resolve_gid_locked implementation
-    HPX_ASSERT_OWNS_LOCK(l);
-
+{ // {{{ resolve_gid_impl implementation
     // handle (non-migratable) components located on this locality first
     if (naming::refers_to_local_lva(gid) &&
         !naming::refers_to_virtual_memory(gid))
@@ -1197,75 +1135,16 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
-
-    if (it != end)
+    // Check for an exact match or for the GID being in a range, ranges never
+    // cross the MSB of their base GID.
+    naming::gid_type base;
+    gva_table_data_type data;
+    if (gvas_.find(id, base, data) && (base + data.first.count) > id)
     {
-        // Check for exact match
-        if (it->first == id)
-        {
-            if (&ec != &throws)
-                ec = make_success_code();
+        if (&ec != &throws)
+            ec = make_success_code();
 
-            gva_table_data_type const& data = it->second;
-            return resolved_type(it->first, data.first, data.second);
-        }
-
-        // We need to decrement the iterator, first we check that it's safe
-        // to do this.
-        else if (it != begin)
-        {
-            --it;
-
-            // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
-            {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, internal_server_error
-                      , "primary_namespace::resolve_gid_locked"
-                      , "MSBs of lower and upper range bound do not match");
-                    return resolved_type(naming::invalid_gid, gva(),
-                        naming::invalid_gid);
-                }
-
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                return resolved_type(it->first, data.first, data.second);
-            }
-        }
-    }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Found the GID in a range
-        gva_table_data_type const& data = it->second;
-        if ((it->first + data.first.count) > id)
-        {
-            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error
-                  , "primary_namespace::resolve_gid_locked"
-                  , "MSBs of lower and upper range bound do not match");
-                return resolved_type(naming::invalid_gid, gva(),
-                    naming::invalid_gid);
-            }
-
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            return resolved_type(it->first, data.first, data.second);
-        }
+        return resolved_type(base, data.first, data.second);
     }
 
     if (&ec != &throws)
@@ -18,11 +18,16 @@
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/util/generate_unique_ids.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #if HPX_DEBUG_WRAPPER_HEAP != 0
 #include <cstring>
 #endif
+#if defined(HPX_WINDOWS)
+#include <malloc.h>
+#endif
 #include <memory>
 #include <mutex>
 #include <new>
@@ -35,6 +40,38 @@ namespace hpx { namespace components { namespace detail
     namespace one_size_heap_allocators
     {
         util::internal_allocator<char> fixed_mallocator::alloc_;
+
+        void* fixed_mallocator::alloc_aligned(
+            std::size_t size, std::size_t alignment)
+        {
+#if defined(HPX_HAVE_INTERNAL_ALLOCATOR)
+            void* p = nullptr;
+            if (HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, posix_memalign)(
+                    &p, alignment, size) != 0)
+            {
+                return nullptr;
+            }
+            return p;
+#elif defined(HPX_WINDOWS)
+            return _aligned_malloc(size, alignment);
+#else
+            void* p = nullptr;
+            if (::posix_memalign(&p, alignment, size) != 0)
+                return nullptr;
+            return p;
+#endif
+        }
+
+        void fixed_mallocator::free_aligned(void* p)
+        {
+#if defined(HPX_HAVE_INTERNAL_ALLOCATOR)
+            HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, free)(p);
+#elif defined(HPX_WINDOWS)
+            _aligned_free(p);
+#else
+            ::free(p);
+#endif
+        }
     }
 
 #if HPX_DEBUG_WRAPPER_HEAP != 0
@@ -76,11 +113,13 @@ namespace hpx { namespace components { namespace detail
         , std::size_t
 #endif
         , heap_parameters parameters)
-      : pool_(nullptr)
-      , first_free_(nullptr)
-      , parameters_(parameters)
-      , free_size_(0)
+      : block_(nullptr)
+      , pool_(nullptr)
+      , parameters_(wrapper_heap_base::fill_block(parameters))
+      , allocated_(0)
+      , freed_(0)
       , base_gid_(naming::invalid_gid)
+      , has_base_gid_(false)
       , class_name_(class_name)
 #if defined(HPX_DEBUG)
       , alloc_count_(0)
@@ -96,11 +135,13 @@ namespace hpx { namespace components { namespace detail
     }
 
     wrapper_heap::wrapper_heap()
-      : pool_(nullptr)
-      , first_free_(nullptr)
+      : block_(nullptr)
+      , pool_(nullptr)
       , parameters_({0, 0, 0})
-      , free_size_(0)
+      , allocated_(0)
+      , freed_(0)
       , base_gid_(naming::invalid_gid)
+      , has_base_gid_(false)
 #if defined(HPX_DEBUG)
       , alloc_count_(0)
       , free_count_(0)
@@ -121,13 +162,14 @@ namespace hpx { namespace components { namespace detail
     std::size_t wrapper_heap::size() const
     {
         util::itt::heap_internal_access hia; HPX_UNUSED(hia);
-        return parameters_.capacity - free_size_;
+        return allocated_.load(std::memory_order_relaxed) -
+            freed_.load(std::memory_order_relaxed);
     }
 
     std::size_t wrapper_heap::free_size() const
     {
         util::itt::heap_internal_access hia; HPX_UNUSED(hia);
-        return free_size_;
+        return parameters_.capacity - size();
     }
 
     bool wrapper_heap::is_empty() const
@@ -139,8 +181,8 @@ namespace hpx { namespace components { namespace detail
     bool wrapper_heap::has_allocatable_slots() const
     {
         util::itt::heap_internal_access hia; HPX_UNUSED(hia);
-        std::size_t const num_bytes = parameters_.capacity * parameters_.element_size;
-        return first_free_ < pool_ + num_bytes;
+        return allocated_.load(std::memory_order_relaxed) <
+            parameters_.capacity;
     }
 
     bool wrapper_heap::alloc(void** result, std::size_t count)
@@ -149,22 +191,22 @@ namespace hpx { namespace components { namespace detail
             heap_alloc_function_, result, count * parameters_.element_size,
             HPX_WRAPPER_HEAP_INITIALIZED_MEMORY);
 
-        scoped_lock l(mtx_);
-
-        if (!ensure_pool(count))
-            return false;
+        // the memory is released only after all elements were handed out,
+        // no need to check the pool here
+        std::size_t n = allocated_.load(std::memory_order_relaxed);
+        do
+        {
+            if (n + count > parameters_.capacity)
+                return false;
+        }
+        while (!allocated_.compare_exchange_weak(
+            n, n + count, std::memory_order_relaxed));
 
 #if defined(HPX_DEBUG)
         alloc_count_ += count;
 #endif
 
-        void* p = first_free_;
-        HPX_ASSERT(p != nullptr);
-
-        first_free_ = first_free_ + count * parameters_.element_size;
-
-        HPX_ASSERT(free_size_ >= count);
-        free_size_ -= count;
+        void* p = pool_ + n * parameters_.element_size;
 
 #if HPX_DEBUG_WRAPPER_HEAP != 0
         // init memory blocks
@@ -175,17 +217,14 @@ namespace hpx { namespace components { namespace detail
         return true;
     }
 
-    void wrapper_heap::free(void *p, std::size_t count)
+    bool wrapper_heap::free(void *p, std::size_t count)
     {
         util::itt::heap_free heap_free(heap_free_function_, p);
 
 #if HPX_DEBUG_WRAPPER_HEAP != 0
         HPX_ASSERT(did_alloc(p));
-#endif
-        scoped_lock l(mtx_);
 
-#if HPX_DEBUG_WRAPPER_HEAP != 0
-        char* p1 = p;
+        char* p1 = static_cast<char*>(p);
         std::size_t const total_num_bytes =
             parameters_.capacity * parameters_.element_size;
         std::size_t const num_bytes = count * parameters_.element_size;
@@ -194,8 +233,7 @@ namespace hpx { namespace components { namespace detail
         HPX_ASSERT(nullptr != pool_ &&
             p1 + num_bytes <=
                 pool_ + total_num_bytes);
-        HPX_ASSERT(first_free_ == nullptr || p1 != first_free_);
-        HPX_ASSERT(free_size_ + count <= parameters_.capacity);
+        HPX_ASSERT(freed_ + count <= allocated_);
         // make sure this has not been freed yet
         HPX_ASSERT(!debug::test_fill_bytes(p1, freed_value,
             num_bytes));
@@ -209,10 +247,16 @@ namespace hpx { namespace components { namespace detail
 #if defined(HPX_DEBUG)
         free_count_ += count;
 #endif
-        free_size_ += count;
 
-        // release the pool if this one was the last allocated item
-        test_release(l);
+        return release_elements(count);
+    }
+
+    bool wrapper_heap::seal()
+    {
+        // mark all elements not handed out yet as freed
+        std::size_t const capacity = parameters_.capacity;
+        std::size_t const allocated = allocated_.exchange(capacity);
+        return release_elements(capacity - allocated);
     }
 
     bool wrapper_heap::did_alloc (void *p) const
@@ -235,41 +279,46 @@ namespace hpx { namespace components { namespace detail
 
         HPX_ASSERT(did_alloc(p));
 
-        scoped_lock l(mtx_);
-
-        if (!base_gid_)
+        if (!has_base_gid_.load(std::memory_order_acquire))
         {
-            naming::gid_type base_gid;
+            scoped_lock l(mtx_);
 
+            if (!base_gid_)
             {
-                // this is the first call to get_gid() for this heap - allocate
-                // a sufficiently large range of global ids
-                util::unlock_guard<scoped_lock> ul(l);
-                base_gid = ids.get_id(parameters_.capacity);
-
-                // register the global ids and the base address of this heap
-                // with the AGAS
-                if (!applier::bind_range_local(base_gid, parameters_.capacity,
-                        naming::address(hpx::get_locality(), type, pool_),
-                        parameters_.element_size))
+                naming::gid_type base_gid;
+
                 {
-                    return naming::invalid_gid;
+                    // this is the first call to get_gid() for this heap -
+                    // allocate a sufficiently large range of global ids
+                    util::unlock_guard<scoped_lock> ul(l);
+                    base_gid = ids.get_id(parameters_.capacity);
+
+                    // register the global ids and the base address of this
+                    // heap with the AGAS
+                    if (!applier::bind_range_local(base_gid,
+                            parameters_.capacity,
+                            naming::address(hpx::get_locality(), type, pool_),
+                            parameters_.element_size))
+                    {
+                        return naming::invalid_gid;
+                    }
                 }
-            }
 
-            // if some other thread has already set the base GID for this
-            // heap, we ignore the result
-            if (!base_gid_)
-            {
-                // this is the first thread succeeding in binding the new gid
-                // range
-                base_gid_ = base_gid;
-            }
-            else
-            {
-                // unbind the range which is not needed anymore
-                util::unlock_guard<scoped_lock> ul(l);
-                applier::unbind_range_local(base_gid, parameters_.capacity);
+                // if some other thread has already set the base GID for this
+                // heap, we ignore the result
+                if (!base_gid_)
+                {
+                    // this is the first thread succeeding in binding the new
+                    // gid range
+                    base_gid_ = base_gid;
+                    has_base_gid_.store(true, std::memory_order_release);
+                }
+                else
+                {
+                    // unbind the range which is not needed anymore
+                    util::unlock_guard<scoped_lock> ul(l);
+                    applier::unbind_range_local(base_gid, parameters_.capacity);
+                }
             }
         }
 
@@ -283,6 +332,22 @@ namespace hpx { namespace components { namespace detail
 
         scoped_lock l(mtx_);
         base_gid_ = g;
+        has_base_gid_.store(bool(g), std::memory_order_release);
+    }
+
+    bool wrapper_heap::release_elements(std::size_t count)
+    {
+        // only the call releasing the last element may release the memory
+        std::size_t const capacity = parameters_.capacity;
+        std::size_t const freed =
+            freed_.fetch_add(count, std::memory_order_acq_rel);
+        HPX_ASSERT(freed + count <= capacity);
+
+        if (freed >= capacity || freed + count != capacity)
+            return false;
+
+        scoped_lock l(mtx_);
+        return test_release(l);
     }
 
     bool wrapper_heap::test_release(scoped_lock& lk)
@@ -290,23 +355,19 @@ namespace hpx { namespace components { namespace detail
         if (pool_ == nullptr)
             return false;
 
-        std::size_t const total_num_bytes =
-            parameters_.capacity * parameters_.element_size;
-
-        if (first_free_ < pool_ + total_num_bytes ||
-            free_size_ < parameters_.capacity)
+        if (freed_.load(std::memory_order_relaxed) < parameters_.capacity)
         {
             return false;
         }
 
-        HPX_ASSERT(free_size_ == parameters_.capacity);
-        HPX_ASSERT(first_free_ == pool_ + total_num_bytes);
+        HPX_ASSERT(allocated_ == parameters_.capacity);
 
         // unbind in AGAS service
         if (base_gid_)
         {
             naming::gid_type base_gid = base_gid_;
             base_gid_ = naming::invalid_gid;
+            has_base_gid_.store(false, std::memory_order_relaxed);
 
             util::unlock_guard<scoped_lock> ull(lk);
             applier::unbind_range_local(base_gid, parameters_.capacity);
@@ -316,48 +377,30 @@ namespace hpx { namespace components { namespace detail
         return true;
     }
 
-    bool wrapper_heap::ensure_pool(std::size_t count)
-    {
-        if (nullptr == pool_)
-        {
-            return false;
-        }
-
-        std::size_t const num_bytes =
-            count * parameters_.element_size;
-        std::size_t const total_num_bytes =
-            parameters_.capacity * parameters_.element_size;
-
-        if (first_free_ + num_bytes > pool_ + total_num_bytes)
-        {
-            return false;
-        }
-        return true;
-    }
-
     bool wrapper_heap::init_pool()
     {
-        HPX_ASSERT(first_free_ == nullptr);
-
-        std::size_t const total_num_bytes =
-            parameters_.capacity * parameters_.element_size;
-        pool_ = static_cast<char *>(allocator_type::alloc(total_num_bytes));
-        if (nullptr == pool_)
+        HPX_ASSERT(pool_ == nullptr);
+
+        // the block is aligned to its size, which allows to find the heap
+        // owning an element from its address
+        std::size_t const block_size =
+            wrapper_heap_base::block_size(parameters_);
+        block_ = static_cast<char*>(
+            allocator_type::alloc_aligned(block_size, block_size));
+        if (nullptr == block_)
         {
             return false;
         }
 
-        first_free_ = (reinterpret_cast<std::size_t>(pool_)
-            % parameters_.element_alignment == 0) ? pool_ :
-            pool_ + parameters_.element_alignment;
+        *reinterpret_cast<wrapper_heap_base**>(block_) = this;
 
-        free_size_ = parameters_.capacity;
+        pool_ = block_ + wrapper_heap_base::block_header_size(parameters_);
 
         LOSH_(info)    //-V128
             << "wrapper_heap ("
             << (!class_name_.empty() ? class_name_.c_str() : "<Unknown>")
             << "): init_pool (" << std::hex << static_cast<void*>(pool_) << ")"
-            << " size: " << total_num_bytes << ".";
+            << " size: " << block_size << ".";
 
         return true;
     }
@@ -371,8 +414,8 @@ namespace hpx { namespace components { namespace detail
                 << (!class_name_.empty() ? class_name_.c_str() : "<Unknown>")
                 << ")"
 #if defined(HPX_DEBUG)
-                << ": releasing heap: alloc count: " << alloc_count_
-                << ", free count: " << free_count_
+                << ": releasing heap: alloc count: " << alloc_count_.load()
+                << ", free count: " << free_count_.load()
 #endif
                 << ".";
 
@@ -391,11 +434,8 @@ namespace hpx { namespace components { namespace detail
                     << " with " << size() << " allocated object(s)!";
             }
 
-            std::size_t const total_num_bytes =
-                parameters_.capacity * parameters_.element_size;
-            allocator_type::free(pool_, total_num_bytes);
-            pool_ = first_free_ = nullptr;
-            free_size_ = 0;
+            allocator_type::free_aligned(block_);
+            block_ = pool_ = nullptr;
         }
     }
 }}}
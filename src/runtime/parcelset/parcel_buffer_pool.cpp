@@ -0,0 +1,50 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace hpx { namespace parcelset
+{
+    namespace detail
+    {
+        std::size_t get_parcel_buffer_pool_stripe(std::size_t num_stripes)
+        {
+            std::size_t num_thread = hpx::get_worker_thread_num();
+            if (num_thread != std::size_t(-1))
+                return num_thread % num_stripes;
+
+            static std::atomic<std::size_t> next_stripe(0);
+            static HPX_NATIVE_TLS std::size_t stripe = std::size_t(-1);
+            if (stripe == std::size_t(-1))
+                stripe = next_stripe++;
+
+            return stripe % num_stripes;
+        }
+    }
+
+    parcel_buffer_pool<char>& get_parcel_data_buffer_pool()
+    {
+        static parcel_buffer_pool<char> pool;
+        return pool;
+    }
+
+    parcel_buffer_pool<serialization::serialization_chunk>&
+    get_parcel_chunk_buffer_pool()
+    {
+        static parcel_buffer_pool<serialization::serialization_chunk> pool;
+        return pool;
+    }
+}}
+
+#endif
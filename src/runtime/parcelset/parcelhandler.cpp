@@ -24,6 +24,7 @@
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/message_handler_fwd.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
 #include <hpx/runtime/parcelset/policies/message_handler.hpp>
 #include <hpx/runtime/parcelset/static_parcelports.hpp>
@@ -1045,6 +1046,32 @@ namespace hpx { namespace parcelset
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the statistics of the buffer pools are reported for both pools
+        // combined
+        std::int64_t get_buffer_pool_hits(bool reset)
+        {
+            return static_cast<std::int64_t>(
+                get_parcel_data_buffer_pool().hits(reset) +
+                get_parcel_chunk_buffer_pool().hits(reset));
+        }
+
+        std::int64_t get_buffer_pool_misses(bool reset)
+        {
+            return static_cast<std::int64_t>(
+                get_parcel_data_buffer_pool().misses(reset) +
+                get_parcel_chunk_buffer_pool().misses(reset));
+        }
+
+        std::int64_t get_buffer_pool_high_water_mark(bool reset)
+        {
+            return static_cast<std::int64_t>(
+                get_parcel_data_buffer_pool().high_water_mark(reset) +
+                get_parcel_chunk_buffer_pool().high_water_mark(reset));
+        }
+    }
+
     void parcelhandler::register_counter_types()
     {
         // register connection specific counters
@@ -1096,6 +1123,36 @@ namespace hpx { namespace parcelset
                   _1, outgoing_routed_count, _2),
               &performance_counters::locality_counter_discoverer,
               ""
+            },
+            { "/parcelport/count/buffer-pool-hits",
+              performance_counters::counter_raw,
+              "returns the number of message buffers which were served from "
+                  "the pool of buffers shared by the parcelports",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &detail::get_buffer_pool_hits, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcelport/count/buffer-pool-misses",
+              performance_counters::counter_raw,
+              "returns the number of message buffers which could not be "
+                  "served from the pool of buffers shared by the parcelports",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &detail::get_buffer_pool_misses, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcelport/data/buffer-pool-high-water-mark",
+              performance_counters::counter_raw,
+              "returns the largest amount of memory held by the pool of "
+                  "buffers shared by the parcelports",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &detail::get_buffer_pool_high_water_mark, _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
             }
         };
         performance_counters::install_counter_types(
@@ -200,6 +200,16 @@ namespace hpx { namespace parcelset
         return count;
     }
 
+    std::int64_t parcelport::get_num_pending_parcels(
+        locality const& dest) const
+    {
+        std::lock_guard<lcos::local::spinlock> l(mtx_);
+        auto it = pending_parcels_.find(dest);
+        if (it == pending_parcels_.end())
+            return 0;
+        return static_cast<std::int64_t>(hpx::util::get<0>(it->second).size());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -34,9 +34,41 @@
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_FUTEX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads { namespace policies
 {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_FUTEX)
+    namespace detail
+    {
+        // Block while the futex word still holds the expected value, or
+        // until the timeout expires.
+        void futex_wait(std::atomic<std::uint32_t>& word,
+            std::uint32_t expected, std::chrono::milliseconds period)
+        {
+            struct timespec timeout;
+            timeout.tv_sec = static_cast<time_t>(period.count() / 1000);
+            timeout.tv_nsec = static_cast<long>((period.count() % 1000) *
+                1000000);
+
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAIT_PRIVATE, expected, &timeout, nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>& word)
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+    }
+#endif
+
     scheduler_base::scheduler_base(std::size_t num_threads,
         char const* description, thread_queue_init_parameters thread_queue_init,
         scheduler_mode mode)
@@ -49,19 +81,22 @@ namespace hpx { namespace threads { namespace policies
       , parent_pool_(nullptr)
       , background_thread_count_(0)
     {
-        set_scheduler_mode(mode);
-
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double max_time = thread_queue_init.max_idle_backoff_time_;
 
-        wait_counts_.resize(num_threads);
+        // the per-thread data is neither copyable nor movable
+        wait_counts_ =
+            std::vector<util::cache_line_data<idle_backoff_data>>(num_threads);
         for (auto && data : wait_counts_)
         {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
+        parked_threads_.data_.store(0, std::memory_order_relaxed);
 #endif
 
+        set_scheduler_mode(mode);
+
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].store(state_initialized);
     }
@@ -72,8 +107,10 @@ namespace hpx { namespace threads { namespace policies
         if (mode_.data_.load(std::memory_order_relaxed) &
                 policies::enable_idle_backoff)
         {
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
+            // Park this thread until new work is scheduled which it can
+            // execute (see do_some_work). The sleep time is still bounded by
+            // an exponentially growing timeout as a safety net, for instance
+            // for work which became stealable without notification.
 
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
@@ -86,8 +123,49 @@ namespace hpx { namespace threads { namespace policies
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
+            // The epoch has to be read before announcing that this thread
+            // is parked, any wake up after this point changes it and makes
+            // the wait below return immediately.
+            std::uint32_t epoch = data.epoch_.load(std::memory_order_acquire);
+            data.parked_.store(true, std::memory_order_seq_cst);
+            parked_threads_.data_.fetch_add(1, std::memory_order_seq_cst);
+
+            // As in an event count, this pairs with the fence in
+            // do_some_work: either the re-check below sees the new work or
+            // the thread scheduling it sees this thread as being parked.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Re-check for work after announcing this thread as parked.
+            // Threads which were scheduled before are visible now, all
+            // others will cause a wake up. Pending background threads don't
+            // count as work others could steal.
+            bool has_work =
+                states_[num_thread].load(std::memory_order_seq_cst) !=
+                    state_running ||
+                get_queue_length(num_thread) != 0;
+            if (!has_work && has_work_stealing())
+            {
+                has_work = get_queue_length(std::size_t(-1)) >
+                    background_thread_count_.load(std::memory_order_relaxed);
+            }
+
+            if (!has_work)
+            {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_FUTEX)
+                detail::futex_wait(data.epoch_, epoch, period);
+#else
+                std::unique_lock<pu_mutex_type> l(data.mtx_);
+                data.cond_.wait_for(l, period, [&]() {
+                    return data.epoch_.load(std::memory_order_acquire) !=
+                        epoch;
+                });
+#endif
+            }
+
+            data.parked_.store(false, std::memory_order_relaxed);
+            parked_threads_.data_.fetch_sub(1, std::memory_order_relaxed);
+
+            if (data.epoch_.load(std::memory_order_relaxed) != epoch)
             {
                 // reset counter if thread was woken up
                 data.wait_count_ = 0;
@@ -98,13 +176,87 @@ namespace hpx { namespace threads { namespace policies
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    // Wake the given thread if it is parked, returns whether it was.
+    bool scheduler_base::unpark(std::size_t num_thread)
+    {
+        idle_backoff_data& data = wait_counts_[num_thread].data_;
+        if (!data.parked_.load(std::memory_order_relaxed) ||
+            !data.parked_.exchange(false, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        data.epoch_.fetch_add(1, std::memory_order_release);
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_FUTEX)
+        detail::futex_wake(data.epoch_);
+#else
+        {
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+        }
+        data.cond_.notify_one();
+#endif
+        return true;
+    }
+
+    void scheduler_base::unpark_all()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_threads_.data_.load(std::memory_order_acquire) == 0)
+            return;
+
+        for (std::size_t i = 0; i != wait_counts_.size(); ++i)
+        {
+            unpark(i);
+        }
+    }
+#endif
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
-    /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    /// possibly idling OS threads. The given thread number refers to the
+    /// queue the work was added to, or is -1 if that is not known.
+    void scheduler_base::do_some_work(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        cond_.notify_all();
+        // Make the new work visible to threads which are about to park
+        // before checking whether any thread is parked (this pairs with the
+        // re-check in idle_callback).
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_threads_.data_.load(std::memory_order_acquire) == 0)
+            return;
+
+        // Unless the new work may be stolen by any thread, only the thread
+        // owning the queue it was added to can run it. If that thread is
+        // not known, wake them all.
+        bool can_steal = has_work_stealing() && has_work_stealing_numa();
+
+        std::size_t num_threads = wait_counts_.size();
+        if (num_thread != std::size_t(-1))
+        {
+            // wake the thread owning the queue the work was added to
+            num_thread %= num_threads;
+            if (unpark(num_thread) || !can_steal)
+                return;
+        }
+        else if (!can_steal)
+        {
+            unpark_all();
+            return;
+        }
+        else
+        {
+            num_thread = 0;
+        }
+
+        // The owner is busy, wake one other thread which may steal the work.
+        for (std::size_t i = 1; i <= num_threads; ++i)
+        {
+            if (unpark((num_thread + i) % num_threads))
+                return;
+        }
+#else
+        (void)num_thread;
 #endif
     }
 
@@ -254,6 +406,11 @@ namespace hpx { namespace threads { namespace policies
         {
             state.store(s);
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // make sure parked threads see the new state
+        unpark_all();
+#endif
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -266,6 +423,11 @@ namespace hpx { namespace threads { namespace policies
                 state.store(s);
             }
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // make sure parked threads see the new state
+        unpark_all();
+#endif
     }
 
     // return whether all states are at least at the given one
@@ -312,7 +474,9 @@ namespace hpx { namespace threads { namespace policies
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(std::size_t(-1));
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        unpark_all();
+#endif
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
@@ -789,6 +789,17 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_num_stolen_to_staged),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            {"/threads/count/stolen-to-pending-remote",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen from "
+                "schedulers running on a different NUMA domain for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_num_stolen_to_pending_remote,
+                    &thread_pool_base::get_num_stolen_to_pending_remote),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous",
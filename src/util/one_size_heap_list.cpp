@@ -15,12 +15,15 @@
 #if defined(HPX_DEBUG)
 #include <hpx/logging.hpp>
 #endif
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
 #include <hpx/runtime/threads/register_thread.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
-#include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -36,9 +39,9 @@ namespace hpx { namespace util
             "free_count({5})",
             name(),
             heap_count_,
-            max_alloc_count_,
-            alloc_count_,
-            free_count_);
+            max_alloc_count_.load(),
+            alloc_count_.load(),
+            free_count_.load());
 
         if (alloc_count_ > free_count_)
         {
@@ -50,109 +53,149 @@ namespace hpx { namespace util
 #endif
     }
 
-    void* one_size_heap_list::alloc(std::size_t count)
+    one_size_heap_list::heap_ptr_type*
+    one_size_heap_list::get_thread_heap() const
     {
-        unique_lock_type guard(mtx_);
+        std::size_t num_thread = hpx::get_worker_thread_num();
+        if (num_thread >= num_thread_heaps_.load(std::memory_order_acquire))
+            return nullptr;
+        return &thread_heaps_[num_thread].data_;
+    }
 
+    one_size_heap_list::heap_ptr_type&
+    one_size_heap_list::get_current_heap(unique_lock_type& l)
+    {
+        HPX_ASSERT(l.owns_lock());
+        HPX_UNUSED(l);
+
+        // the heaps of the worker threads are created on first use as the
+        // number of threads is not known before the runtime is up
+        if (num_thread_heaps_.load(std::memory_order_relaxed) == 0 &&
+            threads::threadmanager_is(state_running))
+        {
+            std::size_t num_threads = hpx::get_os_thread_count();
+            if (num_threads != 0)
+            {
+                thread_heaps_.reset(
+                    new util::cache_aligned_data<heap_ptr_type>[num_threads]);
+                num_thread_heaps_.store(
+                    num_threads, std::memory_order_release);
+            }
+        }
+
+        heap_ptr_type* heap = get_thread_heap();
+        return heap != nullptr ? *heap : shared_heap_;
+    }
+
+    void* one_size_heap_list::alloc(std::size_t count)
+    {
         if (HPX_UNLIKELY(0 == count))
         {
-            guard.unlock();
             HPX_THROW_EXCEPTION(bad_parameter,
                 name() + "::alloc",
                 "cannot allocate 0 objects");
         }
 
-        //std::size_t size = 0;
         void* p = nullptr;
+
+        // Allocate from the heap of this worker thread, this is safe without
+        // locking as the heap is replaced by this thread only.
+        heap_ptr_type* thread_heap = get_thread_heap();
+        if (thread_heap != nullptr && *thread_heap &&
+            (*thread_heap)->alloc(&p, count))
         {
-            if (!heap_list_.empty())
-            {
-                //size = heap_list_.size();
-                for (auto & heap : heap_list_)
-                {
-                    bool allocated = false;
-
-                    {
-                        util::unlock_guard<unique_lock_type> ul(guard);
-                        allocated = heap->alloc(&p, count);
-                    }
-
-                    if (allocated)
-                    {
 #if defined(HPX_DEBUG)
-                        // Allocation succeeded, update statistics.
-                        alloc_count_ += count;
-                        if (alloc_count_ - free_count_ > max_alloc_count_)
-                            max_alloc_count_ = alloc_count_- free_count_;
+            // Allocation succeeded, update statistics.
+            std::size_t alloc_count = alloc_count_ += count;
+            if (alloc_count - free_count_ > max_alloc_count_)
+                max_alloc_count_ = alloc_count - free_count_;
 #endif
-                        return p;
-                    }
+            return p;
+        }
+
+        unique_lock_type guard(mtx_);
 
+        // acquiring the lock might have suspended this thread, look up the
+        // current heap again
+        heap_ptr_type& current = get_current_heap(guard);
+        if (current && current->alloc(&p, count))
+        {
 #if defined(HPX_DEBUG)
-                    LOSH_(info) << hpx::util::format(
-                        "{1}::alloc: failed to allocate from heap[{2}] "
-                        "(heap[{2}] has allocated {3} objects and has "
-                        "space for {4} more objects)",
-                        name(),
-                        heap->heap_count(),
-                        heap->size(),
-                        heap->free_size());
+            alloc_count_ += count;
 #endif
-                }
-            }
+            return p;
         }
 
         // Create new heap.
-        bool did_create = false;
-        {
 #if defined(HPX_DEBUG)
-            heap_list_.push_front(create_heap_(
-                class_name_.c_str(), heap_count_ + 1, parameters_));
+        heap_list_.push_front(create_heap_(
+            class_name_.c_str(), heap_count_ + 1, parameters_));
 #else
-            heap_list_.push_front(create_heap_(
-                class_name_.c_str(), 0, parameters_));
+        heap_list_.push_front(create_heap_(
+            class_name_.c_str(), 0, parameters_));
 #endif
 
-            iterator itnew = heap_list_.begin();
-            typename list_type::value_type heap = *itnew;
-            bool result = false;
-
-            {
-                util::unlock_guard<unique_lock_type> ul(guard);
-                result = heap->alloc((void**)&p, count);
-            }
+        heap_ptr_type heap = heap_list_.front();
+        if (HPX_UNLIKELY(!heap->alloc(&p, count) || nullptr == p))
+        {
+            // out of memory
+            heap_list_.pop_front();
+            guard.unlock();
+            HPX_THROW_EXCEPTION(out_of_memory,
+                name() + "::alloc",
+                hpx::util::format(
+                    "new heap failed to allocate {1} objects",
+                    count));
+        }
 
-            if (HPX_UNLIKELY(!result || nullptr == p))
-            {
-                // out of memory
-                guard.unlock();
-                HPX_THROW_EXCEPTION(out_of_memory,
-                    name() + "::alloc",
-                    hpx::util::format(
-                        "new heap failed to allocate {1} objects",
-                        count));
-            }
+        heap_blocks_[wrapper_heap_base::block_of(p, block_size_)] = heap;
 
 #if defined(HPX_DEBUG)
-            alloc_count_ += count;
-            ++heap_count_;
+        alloc_count_ += count;
+        ++heap_count_;
 
-            LOSH_(info) << hpx::util::format(
-                "{1}::alloc: creating new heap[{2}], size is now {3}",
-                name(),
-                heap_count_,
-                heap_list_.size());
+        LOSH_(info) << hpx::util::format(
+            "{1}::alloc: creating new heap[{2}], size is now {3}",
+            name(),
+            heap_count_,
+            heap_list_.size());
 #endif
-            did_create = true;
-        }
 
-        if (did_create)
-            return p;
+        // nothing will be allocated from the previous heap anymore, it
+        // releases its memory as soon as all of its elements are freed
+        heap_ptr_type retired = std::move(current);
+        current = std::move(heap);
 
         guard.unlock();
 
-        // Try again, we just got a new heap, so we should be good.
-        return alloc(count);
+        if (retired && retired->seal())
+            remove_heap(retired.get());
+
+        return p;
+    }
+
+    void one_size_heap_list::remove_heap(wrapper_heap_base* heap)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // the heap has released its block already, look it up by value
+        for (auto it = heap_blocks_.begin(); it != heap_blocks_.end(); ++it)
+        {
+            if (it->second.get() == heap)
+            {
+                heap_blocks_.erase(it);
+                break;
+            }
+        }
+
+        for (iterator it = heap_list_.begin(); it != heap_list_.end(); ++it)
+        {
+            if (it->get() == heap)
+            {
+                heap_list_.erase(it);
+                return;
+            }
+        }
     }
 
     bool one_size_heap_list::reschedule(void* p, std::size_t count)
@@ -169,8 +212,6 @@ namespace hpx { namespace util
 
     void one_size_heap_list::free(void* p, std::size_t count)
     {
-        unique_lock_type ul(mtx_);
-
         if (nullptr == p || !threads::threadmanager_is(state_running))
             return;
 
@@ -179,52 +220,53 @@ namespace hpx { namespace util
         if (reschedule(p, count))
             return;
 
-        // Find the heap which allocated this pointer.
-        for (auto & heap : heap_list_)
+#if defined(HPX_DEBUG)
+        // The owning heap is found from the block header without any
+        // checks, verify the pointer against the known heaps first.
+        if (HPX_UNLIKELY(!find_heap(p)))
         {
-            bool did_allocate = false;
+            HPX_THROW_EXCEPTION(bad_parameter,
+                name() + "::free",
+                hpx::util::format(
+                    "pointer {1} was not allocated by this {2}",
+                    p, name()));
+        }
+#endif
 
-            {
-                util::unlock_guard<unique_lock_type> ull(ul);
-                did_allocate = heap->did_alloc(p);
-                if (did_allocate)
-                    heap->free(p, count);
-            }
+        // Find the heap which allocated this pointer.
+        wrapper_heap_base* heap = get_heap(p);
+        HPX_ASSERT(heap->did_alloc(p));
 
-            if (did_allocate)
-            {
 #if defined(HPX_DEBUG)
-                free_count_ += count;
+        free_count_ += count;
 #endif
-                return;
-            }
-        }
 
-        ul.unlock();
-
-        HPX_THROW_EXCEPTION(bad_parameter,
-            name() + "::free",
-            hpx::util::format(
-                "pointer {1} was not allocated by this {2}",
-                p, name()));
+        // drop the heap once it has released its memory
+        if (heap->free(p, count))
+            remove_heap(heap);
     }
 
-    bool one_size_heap_list::did_alloc(void* p) const
+    one_size_heap_list::heap_ptr_type one_size_heap_list::find_heap(
+        void* p) const
     {
-        unique_lock_type ul(mtx_);
-        for (typename list_type::value_type const& heap : heap_list_)
-        {
-            bool did_allocate = false;
+        if (nullptr == p)
+            return heap_ptr_type();
 
-            {
-                util::unlock_guard<unique_lock_type> ull(ul);
-                did_allocate = heap->did_alloc(p);
-            }
+        // The block header of an arbitrary address must not be read, only
+        // blocks of heaps which are still alive are considered.
+        std::lock_guard<mutex_type> l(mtx_);
 
-            if (did_allocate)
-                return true;
-        }
-        return false;
+        auto it =
+            heap_blocks_.find(wrapper_heap_base::block_of(p, block_size_));
+        if (it == heap_blocks_.end() || !it->second->did_alloc(p))
+            return heap_ptr_type();
+
+        return it->second;
+    }
+
+    bool one_size_heap_list::did_alloc(void* p) const
+    {
+        return bool(find_heap(p));
     }
 
     std::string one_size_heap_list::name() const
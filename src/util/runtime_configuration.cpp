@@ -11,6 +11,7 @@
 #include <hpx/assertion.hpp>
 #include <hpx/basic_execution/register_locks.hpp>
 #include <hpx/concurrency/itt_notify.hpp>
+#include <hpx/coroutines/detail/stack_cache.hpp>
 #include <hpx/filesystem.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/stringize.hpp>
@@ -244,6 +245,10 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
 #endif
+            "cache_high_watermark = ${HPX_STACK_CACHE_HIGH_WATERMARK:1024}",
+            "cache_low_watermark = ${HPX_STACK_CACHE_LOW_WATERMARK:256}",
+            "decommit_delay = ${HPX_STACK_DECOMMIT_DELAY:100}",
+            "use_huge_pages = ${HPX_STACK_USE_HUGE_PAGES:0}",
 
             "[hpx.threadpools]",
 #if defined(HPX_HAVE_IO_POOL)
@@ -333,6 +338,10 @@ namespace hpx { namespace util
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "refcnt_requests_flush_interval = "
+            "${HPX_AGAS_REFCNT_REQUESTS_FLUSH_INTERVAL:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(
+                    HPX_INITIAL_AGAS_REFCNT_REQUESTS_FLUSH_INTERVAL)) "}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -601,6 +610,7 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+        init_stack_cache();
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -662,6 +672,7 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+        init_stack_cache();
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -875,6 +886,20 @@ namespace hpx { namespace util
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t
+    runtime_configuration::get_agas_refcnt_requests_flush_interval() const
+    {
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "refcnt_requests_flush_interval",
+                    HPX_INITIAL_AGAS_REFCNT_REQUESTS_FLUSH_INTERVAL);
+            }
+        }
+        return HPX_INITIAL_AGAS_REFCNT_REQUESTS_FLUSH_INTERVAL;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -1084,6 +1109,29 @@ namespace hpx { namespace util
     }
 #endif
 
+    void runtime_configuration::init_stack_cache() const
+    {
+        namespace posix = threads::coroutines::detail::posix;
+
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                posix::stack_cache_high_watermark =
+                    hpx::util::get_entry_as<std::size_t>(
+                        *sec, "cache_high_watermark", "1024");
+                posix::stack_cache_low_watermark = (std::min)(
+                    posix::stack_cache_high_watermark,
+                    hpx::util::get_entry_as<std::size_t>(
+                        *sec, "cache_low_watermark", "256"));
+                posix::stack_decommit_delay =
+                    hpx::util::get_entry_as<std::int64_t>(
+                        *sec, "decommit_delay", "100");
+                posix::use_huge_pages = hpx::util::get_entry_as<int>(
+                    *sec, "use_huge_pages", "0") != 0;
+            }
+        }
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -11,6 +11,7 @@
 #include <hpx/include/parallel_executor_parameters.hpp>
 #include <hpx/timing.hpp>
 
+#include <hpx/parallel/executors/fork_join_executor.hpp>
 #include <hpx/parallel/executors/parallel_executor_aggregated.hpp>
 
 #include "worker_timed.hpp"
@@ -31,6 +32,7 @@ int chunk_size = 0;
 int num_overlapping_loops = 0;
 bool disable_stealing = false;
 bool fast_idle_mode = false;
+bool hierarchical_stealing = false;
 unsigned int seed = std::random_device{}();
 std::mt19937 gen(seed);
 
@@ -444,6 +446,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     num_overlapping_loops = vm["overlapping_loops"].as<int>();
     disable_stealing = vm.count("disable_stealing");
     fast_idle_mode = vm.count("fast_idle_mode");
+    hierarchical_stealing = vm.count("hierarchical_stealing");
 
     // verify that input is within domain of program
     if (test_count == 0 || test_count < 0)
@@ -466,6 +469,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
             hpx::threads::add_scheduler_mode(
                 hpx::threads::policies::fast_idle_mode);
         }
+        if (hierarchical_stealing)
+        {
+            hpx::threads::add_scheduler_mode(
+                hpx::threads::policies::enable_stealing_hierarchical);
+        }
 
         // results
         std::uint64_t par_time_foreach;
@@ -488,6 +496,18 @@ int hpx_main(hpx::program_options::variables_map& vm)
             task_time_forloop = averageout_task_forloop(vector_size, par);
             seq_time_forloop = averageout_sequential_forloop(vector_size);
         }
+        else if (vm.count("fork_join") != 0)
+        {
+            hpx::parallel::execution::fork_join_executor par;
+
+            par_time_foreach = averageout_parallel_foreach(vector_size, par);
+            task_time_foreach = averageout_task_foreach(vector_size, par);
+            seq_time_foreach = averageout_sequential_foreach(vector_size);
+
+            par_time_forloop = averageout_parallel_forloop(vector_size, par);
+            task_time_forloop = averageout_task_forloop(vector_size, par);
+            seq_time_forloop = averageout_sequential_forloop(vector_size);
+        }
         else
         {
             hpx::parallel::execution::parallel_executor par;
@@ -511,6 +531,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
             hpx::threads::remove_scheduler_mode(
                 hpx::threads::policies::fast_idle_mode);
         }
+        if (hierarchical_stealing)
+        {
+            hpx::threads::remove_scheduler_mode(
+                hpx::threads::policies::enable_stealing_hierarchical);
+        }
 
         if (csvoutput)
         {
@@ -621,11 +646,17 @@ int main(int argc, char* argv[])
         ("aggregated"
         ,"use aggregated executor")
 
+        ("fork_join"
+        ,"use fork-join executor")
+
         ("disable_stealing"
         ,"disable thread stealing")
 
         ("fast_idle_mode"
         ,"enable fast idle mode")
+
+        ("hierarchical_stealing"
+        ,"enable hierarchical (topology aware) thread stealing")
         ;
 
     return hpx::init(cmdline, argc, argv, cfg);
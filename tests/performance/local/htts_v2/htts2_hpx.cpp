@@ -207,14 +207,16 @@ struct hpx_driver : htts2::driver
                 << "OS-threads (Independent Variable),"
                 << "Tasks per OS-thread (Control Variable) [tasks/OS-threads],"
                 << "Payload Duration (Control Variable) [nanoseconds],"
-                << "Total Walltime [nanoseconds]"
+                << "Total Walltime [nanoseconds],"
+                << "Scheduler (Control Variable)"
                 << "\n";
 
-        hpx::util::format_to(std::cout, "{},{},{},{:.14g}\n",
+        hpx::util::format_to(std::cout, "{},{},{},{:.14g},{}\n",
             this->osthreads_,
             this->tasks_,
             this->payload_duration_,
-            results
+            results,
+            hpx::get_config_entry("hpx.scheduler", "local-priority-fifo")
         );
     }
 
@@ -9,6 +9,7 @@
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/timing.hpp>
 
 #include <cstddef>
 #include <complex>
@@ -23,10 +24,19 @@ namespace pingpong
         {
             return std::complex<double>(13.3,-23.8);
         }
+
+        // all requests ask for the same size, the array is created once
+        hpx::serialization::serialize_buffer<char> get_array(std::size_t nbytes)
+        {
+            static hpx::serialization::serialize_buffer<char> const array(
+                nbytes);
+            return array;
+        }
     }
 }
 
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action);
+HPX_PLAIN_ACTION(pingpong::server::get_array, pingpong_get_array_action);
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action);
 
 
@@ -34,6 +44,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 {
    //Commandline specific code
     std::size_t const n = vm["nparcels"].as<std::size_t>();
+    std::size_t const nbytes = vm["nbytes"].as<std::size_t>();
 
     if (0 == hpx::get_locality_id())
     {
@@ -50,6 +61,27 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::vector<hpx::naming::id_type> dummy = hpx::find_remote_localities();
     hpx::naming::id_type other_locality = dummy[0];
 
+    // transfer arrays of the given size one after the other
+    if (nbytes != 0)
+    {
+        pingpong_get_array_action array_act;
+        hpx::util::high_resolution_timer t;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            hpx::async(array_act, other_locality, nbytes).get();
+        }
+        double const elapsed = t.elapsed();
+
+        if (0 == hpx::get_locality_id())
+        {
+            hpx::cout << "Received " << n << " arrays of " << nbytes
+                      << " bytes in " << elapsed << " [s], "
+                      << (double(n) * nbytes) / (elapsed * 1024 * 1024)
+                      << " [MB/s]\n" << hpx::flush;
+        }
+        return hpx::finalize();
+    }
+
 
     for(std::size_t i=0; i<n; ++i)
     {
@@ -82,6 +114,9 @@ int main(int argc, char* argv[])
         ("nparcels,n",
          hpx::program_options::value<std::size_t>()->default_value(100),
          "the number of parcels to create")
+        ("nbytes",
+         hpx::program_options::value<std::size_t>()->default_value(0),
+         "transfer arrays of the given size instead (default: 0)")
         ;
     // Initialize and run HPX
     std::vector<std::string> cfg;
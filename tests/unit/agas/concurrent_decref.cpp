@@ -0,0 +1,197 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the credits of many references destroyed concurrently by
+// several threads are neither lost nor returned twice while the pending
+// decrements are batched by the AGAS client.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tests/unit/agas/components/simple_refcnt_checker.hpp>
+#include <tests/unit/agas/components/managed_refcnt_checker.hpp>
+
+using hpx::program_options::variables_map;
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+
+using hpx::init;
+using hpx::finalize;
+using hpx::find_here;
+
+using hpx::naming::id_type;
+using hpx::naming::detail::split_credits_for_gid;
+
+using hpx::agas::garbage_collect;
+
+using hpx::test::simple_refcnt_monitor;
+using hpx::test::managed_refcnt_monitor;
+
+using hpx::util::report_errors;
+
+using hpx::cout;
+using hpx::flush;
+
+///////////////////////////////////////////////////////////////////////////////
+inline id_type split_credits(id_type const& id)
+{
+    return id_type(
+        split_credits_for_gid(const_cast<id_type&>(id).get_gid()),
+        id_type::managed);
+}
+
+void release(std::vector<id_type> ids)
+{
+    // destroy the references one by one, each of them sends a decref
+    while (!ids.empty())
+        ids.pop_back();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <
+    typename Client
+>
+void hpx_test_main(
+    variables_map& vm
+    )
+{
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+    std::size_t const num_objects = vm["objects"].as<std::size_t>();
+    std::size_t const num_copies = vm["copies"].as<std::size_t>();
+    std::size_t const num_tasks = 4 * hpx::get_os_thread_count();
+
+    std::vector<Client> monitors;
+    monitors.reserve(num_objects);
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        monitors.emplace_back(find_here());
+    }
+
+    {
+        // Split off a number of references to each of the components and
+        // destroy them concurrently.
+        std::vector<std::vector<id_type> > ids(num_tasks);
+        for (std::size_t i = 0; i != num_objects; ++i)
+        {
+            id_type const& id = monitors[i].get_id();
+            for (std::size_t j = 0; j != num_copies; ++j)
+            {
+                ids[(i + j) % num_tasks].push_back(split_credits(id));
+            }
+        }
+
+        std::vector<hpx::future<void> > tasks;
+        tasks.reserve(num_tasks);
+        for (std::vector<id_type>& v : ids)
+        {
+            tasks.push_back(hpx::async(&release, std::move(v)));
+        }
+        hpx::wait_all(tasks);
+    }
+
+    // Flush pending reference counting operations.
+    garbage_collect();
+    garbage_collect();
+
+    // All components are still referenced by the monitors.
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(delay));
+    for (Client& monitor : monitors)
+    {
+        HPX_TEST_EQ(false, monitor.is_ready());
+    }
+
+    {
+        // Detach the last references to the components.
+        std::vector<id_type> ids;
+        ids.reserve(num_objects);
+        for (Client& monitor : monitors)
+        {
+            ids.push_back(monitor.detach().get());
+        }
+
+        for (Client& monitor : monitors)
+        {
+            HPX_TEST_EQ(false, monitor.is_ready());
+        }
+    }
+
+    // Flush pending reference counting operations.
+    garbage_collect();
+    garbage_collect();
+
+    // All credits have been returned, the components should be deleted.
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(delay));
+    for (Client& monitor : monitors)
+    {
+        HPX_TEST_EQ(true, monitor.is_ready());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(
+    variables_map& vm
+    )
+{
+    {
+        cout << std::string(80, '#') << "\n"
+             << "simple component test\n"
+             << std::string(80, '#') << "\n" << flush;
+
+        hpx_test_main<simple_refcnt_monitor>(vm);
+
+        cout << std::string(80, '#') << "\n"
+             << "managed component test\n"
+             << std::string(80, '#') << "\n" << flush;
+
+        hpx_test_main<managed_refcnt_monitor>(vm);
+    }
+
+    finalize();
+    return report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(
+    int argc
+  , char* argv[]
+    )
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "delay"
+        , value<std::uint64_t>()->default_value(500)
+        , "number of milliseconds to wait for object destruction")
+        ( "objects"
+        , value<std::size_t>()->default_value(64)
+        , "number of components to create")
+        ( "copies"
+        , value<std::size_t>()->default_value(16)
+        , "number of references to destroy for each component")
+        ;
+
+    // We need to explicitly enable the test components used by this test.
+    // Batch enough decrements for the requests of several threads to be
+    // pending at the same time.
+    std::vector<std::string> const cfg = {
+        "hpx.components.simple_refcnt_checker.enabled! = 1",
+        "hpx.components.managed_refcnt_checker.enabled! = 1",
+        "hpx.agas.max_pending_refcnt_requests! = 64"
+    };
+
+    // Initialize and run HPX.
+    return init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/gva_cache.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using hpx::agas::gva;
+using hpx::agas::gva_cache;
+using hpx::naming::gid_type;
+
+std::uint64_t const msb = 0x1234;
+gid_type const locality(0x1, 0x0);
+
+gid_type id(std::uint64_t lsb)
+{
+    return gid_type(msb, lsb);
+}
+
+gva address(std::uint64_t count, std::uint64_t lva)
+{
+    return gva(locality, hpx::components::component_invalid, count, lva);
+}
+
+// Look up the given id, expecting the range starting at base to be cached.
+bool hit(gva_cache& cache, std::uint64_t lsb, std::uint64_t base, gva const& g)
+{
+    gid_type b;
+    gva r;
+    return cache.get_entry(id(lsb), b, r) && b == id(base) && r == g;
+}
+
+bool miss(gva_cache& cache, std::uint64_t lsb)
+{
+    gid_type b;
+    gva r;
+    return !cache.get_entry(id(lsb), b, r);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lookup()
+{
+    gva_cache cache(64);
+    gva_cache::statistics& stats = cache.get_statistics();
+
+    HPX_TEST(miss(cache, 100));
+    HPX_TEST_EQ(stats.misses(true), 1u);
+
+    // a single GID, a small range crossing a block boundary and a large range
+    gva const single = address(1, 0x1000);
+    gva const small = address(10, 0x2000);
+    gva const large = address(1000, 0x3000);
+
+    HPX_TEST(cache.update_entry(id(100), 1, single));
+    HPX_TEST(cache.update_entry(id(124), 10, small));
+    HPX_TEST(cache.update_entry(id(1000), 1000, large));
+    HPX_TEST_EQ(cache.size(), std::size_t(3));
+    HPX_TEST_EQ(stats.insertions(true), 3u);
+
+    // each insertion is preceded by a miss
+    HPX_TEST_EQ(stats.misses(true), 3u);
+
+    HPX_TEST(hit(cache, 100, 100, single));
+    HPX_TEST(miss(cache, 99));
+    HPX_TEST(miss(cache, 101));
+
+    HPX_TEST(hit(cache, 124, 124, small));
+    HPX_TEST(hit(cache, 128, 124, small));
+    HPX_TEST(hit(cache, 133, 124, small));
+    HPX_TEST(miss(cache, 123));
+    HPX_TEST(miss(cache, 134));
+
+    HPX_TEST(hit(cache, 1000, 1000, large));
+    HPX_TEST(hit(cache, 1500, 1000, large));
+    HPX_TEST(hit(cache, 1999, 1000, large));
+    HPX_TEST(miss(cache, 999));
+    HPX_TEST(miss(cache, 2000));
+
+    // ids with a different msb do not match
+    gid_type b;
+    gva r;
+    HPX_TEST(!cache.get_entry(gid_type(msb + 1, 100), b, r));
+
+    HPX_TEST_EQ(stats.hits(true), 7u);
+    HPX_TEST_EQ(stats.misses(true), 7u);
+
+    // updating a cached range replaces its address
+    gva const moved = address(10, 0x4000);
+    HPX_TEST(cache.update_entry(id(124), 10, moved));
+    HPX_TEST(hit(cache, 130, 124, moved));
+    HPX_TEST_EQ(cache.size(), std::size_t(3));
+    HPX_TEST_EQ(stats.insertions(true), 0u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_overlap()
+{
+    gva_cache cache(64);
+
+    gva const single = address(1, 0x1000);
+    gva const small = address(10, 0x2000);
+    gva const large = address(1000, 0x3000);
+
+    HPX_TEST(cache.update_entry(id(100), 1, single));
+    HPX_TEST(cache.update_entry(id(124), 10, small));
+    HPX_TEST(cache.update_entry(id(1000), 1000, large));
+
+    // single GIDs inside of cached ranges, the latter in the block following
+    // the one of the base of the small range
+    HPX_TEST(!cache.update_entry(id(130), 1, single));
+    HPX_TEST(!cache.update_entry(id(1999), 1, single));
+
+    // small ranges covering a single GID, overlapping a small range with a
+    // different base or count, or overlapping a large range
+    HPX_TEST(!cache.update_entry(id(95), 10, small));
+    HPX_TEST(!cache.update_entry(id(120), 5, small));
+    HPX_TEST(!cache.update_entry(id(124), 5, small));
+    HPX_TEST(!cache.update_entry(id(990), 20, small));
+
+    // large ranges covering any of the cached ranges
+    HPX_TEST(!cache.update_entry(id(0), 101, large));
+    HPX_TEST(!cache.update_entry(id(133), 500, large));
+    HPX_TEST(!cache.update_entry(id(1000), 2000, large));
+
+    // the cached entries are still intact
+    HPX_TEST_EQ(cache.size(), std::size_t(3));
+    HPX_TEST(hit(cache, 100, 100, single));
+    HPX_TEST(hit(cache, 130, 124, small));
+    HPX_TEST(hit(cache, 1999, 1000, large));
+
+    // adjacent ranges do not overlap
+    HPX_TEST(cache.update_entry(id(101), 23, small));
+    HPX_TEST(cache.update_entry(id(134), 1, single));
+    HPX_TEST(cache.update_entry(id(2000), 1000, large));
+    HPX_TEST_EQ(cache.size(), std::size_t(6));
+
+    // the range may be inserted once the overlapping entry is removed
+    cache.erase(id(100));
+    HPX_TEST(miss(cache, 100));
+    HPX_TEST(cache.update_entry(id(0), 100, large));
+    HPX_TEST(!cache.update_entry(id(0), 101, large));
+    HPX_TEST(hit(cache, 99, 0, large));
+
+    cache.clear();
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+    HPX_TEST(miss(cache, 130));
+    HPX_TEST(miss(cache, 1500));
+    HPX_TEST(cache.update_entry(id(0), 101, large));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eviction()
+{
+    // a single set holding num_ways entries
+    gva_cache cache(0);
+    gva_cache::statistics& stats = cache.get_statistics();
+
+    std::size_t const num_ways = gva_cache::num_ways;
+    std::size_t const num_range_entries = gva_cache::num_range_entries;
+
+    std::size_t const n = num_ways + 1;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST(cache.update_entry(id(64 * i), 1, address(1, i)));
+    }
+    HPX_TEST_EQ(cache.size(), num_ways);
+    HPX_TEST_EQ(stats.insertions(true), std::uint64_t(n));
+    HPX_TEST_EQ(stats.evictions(true), 1u);
+
+    std::size_t cached = 0;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        if (hit(cache, 64 * i, 64 * i, address(1, i)))
+            ++cached;
+    }
+    HPX_TEST_EQ(cached, num_ways);
+
+    // the same holds for the large ranges
+    std::size_t const m = num_range_entries + 1;
+    for (std::size_t i = 0; i != m; ++i)
+    {
+        std::uint64_t const base = 0x10000 + 1000 * i;
+        HPX_TEST(cache.update_entry(id(base), 1000, address(1000, i)));
+    }
+    HPX_TEST_EQ(cache.size(), num_ways + num_range_entries);
+    HPX_TEST_EQ(stats.evictions(true), 1u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_statistics()
+{
+    gva_cache cache(64);
+    gva_cache::statistics& stats = cache.get_statistics();
+
+    // each call is accounted for either as an insertion or as an update
+    HPX_TEST(cache.update_entry(id(100), 1, address(1, 0)));
+    HPX_TEST_EQ(stats.get_insert_entry_count(true), 1u);
+    HPX_TEST_EQ(stats.get_update_entry_count(true), 0u);
+
+    HPX_TEST(cache.update_entry(id(100), 1, address(1, 1)));
+    HPX_TEST(!cache.update_entry(id(96), 10, address(10, 2)));
+    HPX_TEST_EQ(stats.get_insert_entry_count(true), 0u);
+    HPX_TEST_EQ(stats.get_update_entry_count(true), 2u);
+
+    HPX_TEST(hit(cache, 100, 100, address(1, 1)));
+    HPX_TEST(miss(cache, 101));
+    HPX_TEST_EQ(stats.get_get_entry_count(true), 2u);
+
+    cache.erase(id(100));
+    HPX_TEST_EQ(stats.get_erase_entry_count(true), 1u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_lookup();
+    test_overlap();
+    test_eviction();
+    test_statistics();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/server/gva_table.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstdint>
+#include <utility>
+
+using hpx::agas::gva;
+using hpx::agas::server::gva_table;
+using hpx::naming::gid_type;
+
+std::uint64_t const msb = 0x5678;
+gid_type const locality(0x1, 0x0);
+
+std::uint64_t const block_size = std::uint64_t(1) << gva_table::block_bits;
+std::uint64_t const num_shards = gva_table::num_shards;
+
+gid_type id(std::uint64_t lsb)
+{
+    return gid_type(msb, lsb);
+}
+
+bool bind(gva_table& table, std::uint64_t base, std::uint64_t count,
+    std::uint64_t lva = 0)
+{
+    gva const g(locality, hpx::components::component_invalid, count, lva);
+    return table.insert(id(base), std::make_pair(g, locality));
+}
+
+// Resolve the given id the way the primary namespace does, expecting it to
+// be covered by the range starting at base.
+bool resolves_to(gva_table const& table, std::uint64_t lsb, std::uint64_t base)
+{
+    gid_type b;
+    gva_table::data_type data;
+    return table.find(id(lsb), b, data) && b == id(base) &&
+        data.first.count > lsb - base;
+}
+
+bool unresolved(gva_table const& table, std::uint64_t lsb)
+{
+    gid_type b;
+    gva_table::data_type data;
+    return !table.find(id(lsb), b, data) || !(b + data.first.count > id(lsb));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_resolve()
+{
+    gva_table table;
+    HPX_TEST(unresolved(table, 0));
+
+    // ranges crossing one and several block (and with that shard) boundaries
+    std::uint64_t const a = block_size - 6;
+    std::uint64_t const b = 3 * block_size - 1;
+    std::uint64_t const b_count = 2 * block_size + 2;
+
+    HPX_TEST(bind(table, a, 20));
+    HPX_TEST(bind(table, b, b_count));
+
+    HPX_TEST(unresolved(table, a - 1));
+    HPX_TEST(resolves_to(table, a, a));
+    HPX_TEST(resolves_to(table, block_size - 1, a));
+    HPX_TEST(resolves_to(table, block_size, a));
+    HPX_TEST(resolves_to(table, a + 19, a));
+    HPX_TEST(unresolved(table, a + 20));
+
+    HPX_TEST(unresolved(table, b - 1));
+    HPX_TEST(resolves_to(table, b, b));
+    HPX_TEST(resolves_to(table, b + 1, b));
+    HPX_TEST(resolves_to(table, 4 * block_size + 17, b));
+    HPX_TEST(resolves_to(table, b + b_count - 1, b));
+    HPX_TEST(unresolved(table, b + b_count));
+
+    // ids with a different msb are not covered
+    gid_type base;
+    gva_table::data_type data;
+    HPX_TEST(!table.find(gid_type(msb + 1, a), base, data));
+
+    // a range spanning more blocks than there are shards makes lookups visit
+    // all shards
+    std::uint64_t const c = std::uint64_t(1) << 30;
+    std::uint64_t const c_count = (num_shards + 2) * block_size;
+    HPX_TEST(bind(table, c, c_count));
+
+    HPX_TEST(unresolved(table, c - 1));
+    HPX_TEST(resolves_to(table, c, c));
+    HPX_TEST(resolves_to(table, c + num_shards * block_size + 5, c));
+    HPX_TEST(resolves_to(table, c + c_count - 1, c));
+    HPX_TEST(unresolved(table, c + c_count));
+
+    HPX_TEST(resolves_to(table, a + 19, a));
+    HPX_TEST(unresolved(table, a + 20));
+    HPX_TEST(resolves_to(table, b + b_count - 1, b));
+    HPX_TEST(unresolved(table, b + b_count));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_overlap()
+{
+    gva_table table;
+
+    std::uint64_t const a = block_size - 6;
+    std::uint64_t const b = 3 * block_size - 1;
+    std::uint64_t const b_count = 2 * block_size + 2;
+
+    HPX_TEST(bind(table, a, 20));
+    HPX_TEST(bind(table, b, b_count));
+
+    // the same base GID, with the same or a different count
+    HPX_TEST(!bind(table, a, 20));
+    HPX_TEST(!bind(table, b, 1));
+
+    // ranges starting inside of a bound range
+    HPX_TEST(!bind(table, block_size, 1));
+    HPX_TEST(!bind(table, a + 19, 100));
+    HPX_TEST(!bind(table, b + b_count - 1, 5));
+
+    // ranges covering the base of a bound range, from the same or from
+    // preceding blocks
+    HPX_TEST(!bind(table, a - 10, 11));
+    HPX_TEST(!bind(table, a + 20, b - (a + 20) + 1));
+    HPX_TEST(!bind(table, 0, 10 * block_size));
+
+    // the rejected binds did not modify the table
+    HPX_TEST(unresolved(table, a - 1));
+    HPX_TEST(unresolved(table, a + 20));
+    HPX_TEST(unresolved(table, b - 1));
+
+    // adjacent ranges do not overlap
+    HPX_TEST(bind(table, a - 10, 10));
+    HPX_TEST(bind(table, a + 20, b - (a + 20)));
+    HPX_TEST(bind(table, b + b_count, 1));
+
+    HPX_TEST(resolves_to(table, a - 1, a - 10));
+    HPX_TEST(resolves_to(table, a + 20, a + 20));
+    HPX_TEST(resolves_to(table, b - 1, a + 20));
+    HPX_TEST(resolves_to(table, b, b));
+    HPX_TEST(resolves_to(table, b + b_count, b + b_count));
+
+    // overlaps with a range spanning more blocks than there are shards
+    std::uint64_t const c = std::uint64_t(1) << 30;
+    std::uint64_t const c_count = (num_shards + 2) * block_size;
+    HPX_TEST(bind(table, c, c_count));
+
+    HPX_TEST(!bind(table, c + c_count - 1, 1));
+    HPX_TEST(!bind(table, c + (num_shards + 1) * block_size, block_size));
+    HPX_TEST(!bind(table, c - block_size, block_size + 1));
+    HPX_TEST(bind(table, c + c_count, 1));
+
+    // the remaining ranges are still found once the large range is gone
+    gva_table::data_type removed;
+    HPX_TEST(table.erase(id(c), removed));
+    HPX_TEST(unresolved(table, c + block_size));
+    HPX_TEST(resolves_to(table, c + c_count, c + c_count));
+    HPX_TEST(resolves_to(table, b + b_count - 1, b));
+    HPX_TEST(bind(table, c + block_size, block_size));
+    HPX_TEST(resolves_to(table, c + 2 * block_size - 1, c + block_size));
+
+    // a range may be bound once the overlapping range is gone
+    gva_table::data_type data;
+    HPX_TEST(table.erase(id(a), data));
+    HPX_TEST_EQ(data.first.count, 20u);
+    HPX_TEST(unresolved(table, a));
+    HPX_TEST(bind(table, block_size, 1));
+    HPX_TEST(resolves_to(table, block_size, block_size));
+    HPX_TEST(unresolved(table, a));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update()
+{
+    gva_table table;
+
+    std::uint64_t const b = 3 * block_size - 1;
+    std::uint64_t const b_count = 2 * block_size + 2;
+    HPX_TEST(bind(table, b, b_count, 0x1000));
+
+    // the address is replaced, the count stays the same
+    gva const g(locality, hpx::components::component_invalid, 1, 0x2000);
+    HPX_TEST(table.update(id(b), g, locality));
+    HPX_TEST(!table.update(id(b + 1), g, locality));
+
+    gva_table::data_type data;
+    HPX_TEST(table.get(id(b), data));
+    HPX_TEST_EQ(data.first.lva(), 0x2000u);
+    HPX_TEST_EQ(data.first.count, b_count);
+    HPX_TEST(!table.get(id(b + 1), data));
+
+    HPX_TEST(resolves_to(table, b + b_count - 1, b));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_resolve();
+    test_overlap();
+    test_update();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,206 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that each worker thread allocates component instances from heaps of
+// its own and that the heap owning an element is found from its address.
+
+#include <hpx/functional/bind.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/runtime/components/server/wrapper_heap.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/synchronization/latch.hpp>
+#include <hpx/testing.hpp>
+#include <hpx/util/one_size_heap_list.hpp>
+#include <hpx/util/wrapper_heap_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef hpx::components::detail::fixed_wrapper_heap<server_type> heap_type;
+typedef hpx::components::detail::one_size_heap_allocators::fixed_mallocator
+    allocator_type;
+
+using hpx::util::wrapper_heap_base;
+
+///////////////////////////////////////////////////////////////////////////////
+// the 16 elements and the header need 1040 bytes, the heaps grow their
+// capacity to fill the block of 2048 bytes
+wrapper_heap_base::heap_parameters const parameters = {16, 16, 64};
+
+std::size_t const capacity = 31;
+std::size_t const num_elements = 5 * capacity + 3;
+
+void allocate(hpx::util::one_size_heap_list* heaps, std::size_t num_thread,
+    std::vector<void*>* elements, hpx::lcos::local::latch* l)
+{
+    // the static scheduler does not move this thread to another worker
+    HPX_TEST_EQ(hpx::get_worker_thread_num(), num_thread);
+
+    for (std::size_t i = 0; i != num_elements; ++i)
+        elements->push_back(heaps->alloc());
+
+    l->count_down(1);
+}
+
+void test_fill_block()
+{
+    wrapper_heap_base::heap_parameters const filled =
+        wrapper_heap_base::fill_block(parameters);
+
+    HPX_TEST_EQ(filled.capacity, capacity);
+    HPX_TEST_EQ(filled.element_alignment, parameters.element_alignment);
+    HPX_TEST_EQ(filled.element_size, parameters.element_size);
+
+    HPX_TEST_EQ(wrapper_heap_base::block_size(parameters), std::size_t(2048));
+    HPX_TEST_EQ(wrapper_heap_base::block_size(filled), std::size_t(2048));
+
+    // a filled block can't be filled any further
+    HPX_TEST_EQ(wrapper_heap_base::fill_block(filled).capacity, capacity);
+}
+
+void test_thread_heaps()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    std::size_t const block_size = wrapper_heap_base::block_size(parameters);
+
+    hpx::util::one_size_heap_list heaps(
+        "test_thread_heaps", parameters, (heap_type*) nullptr);
+
+    std::vector<std::vector<void*>> elements(num_threads);
+    {
+        hpx::lcos::local::latch l(num_threads + 1);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            hpx::threads::register_work(
+                hpx::util::bind(&allocate, &heaps, i, &elements[i], &l),
+                "allocate", hpx::threads::pending,
+                hpx::threads::thread_priority_normal,
+                hpx::threads::thread_schedule_hint(std::int16_t(i)));
+        }
+        l.count_down_and_wait();
+    }
+
+    // every thread allocates from blocks of its own
+    std::set<void*> all_elements;
+    std::set<std::uintptr_t> all_blocks;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        std::set<std::uintptr_t> blocks;
+        for (void* p : elements[i])
+        {
+            HPX_TEST(heaps.did_alloc(p));
+            HPX_TEST(wrapper_heap_base::owner(p, block_size)->did_alloc(p));
+
+            all_elements.insert(p);
+            blocks.insert(wrapper_heap_base::block_of(p, block_size));
+        }
+
+        HPX_TEST_EQ(blocks.size(), (num_elements + capacity - 1) / capacity);
+        for (std::uintptr_t block : blocks)
+        {
+            HPX_TEST(all_blocks.insert(block).second);
+        }
+    }
+    HPX_TEST_EQ(all_elements.size(), num_threads * num_elements);
+
+    // the exhausted heaps release their memory once all elements are freed,
+    // the current heap of each thread stays alive
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        for (void* p : elements[i])
+            heaps.free(p);
+    }
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        std::size_t alive = 0;
+        for (void* p : elements[i])
+        {
+            if (heaps.did_alloc(p))
+                ++alive;
+        }
+        HPX_TEST_EQ(alive, num_elements % capacity);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_owner_lookup()
+{
+    std::size_t const block_size = wrapper_heap_base::block_size(parameters);
+
+    hpx::util::one_size_heap_list heaps(
+        "test_owner_lookup", parameters, (heap_type*) nullptr);
+
+    void* p = heaps.alloc();
+    HPX_TEST(heaps.did_alloc(p));
+
+    // the block header is not an element
+    void* block =
+        reinterpret_cast<void*>(wrapper_heap_base::block_of(p, block_size));
+    HPX_TEST(!heaps.did_alloc(block));
+
+    // pointers not allocated by the heap list are rejected without reading
+    // from their (supposed) block header
+    int local = 0;
+    HPX_TEST(!heaps.did_alloc(nullptr));
+    HPX_TEST(!heaps.did_alloc(&local));
+
+    std::unique_ptr<char[]> memory(new char[block_size]);
+    HPX_TEST(!heaps.did_alloc(memory.get()));
+
+    char* foreign = static_cast<char*>(
+        allocator_type::alloc_aligned(block_size, block_size));
+    HPX_TEST(foreign != nullptr);
+    std::memset(foreign, 0xff, block_size);
+
+    void* foreign_element =
+        foreign + wrapper_heap_base::block_header_size(parameters);
+    HPX_TEST(!heaps.did_alloc(foreign_element));
+
+    // the same applies to retrieving the global id of an element
+    server_type::heap_type component_heaps;
+    HPX_TEST(component_heaps.get_gid(&local) == hpx::naming::invalid_gid);
+    HPX_TEST(
+        component_heaps.get_gid(foreign_element) == hpx::naming::invalid_gid);
+
+    allocator_type::free_aligned(foreign);
+
+    heaps.free(p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_fill_block();
+    test_thread_heaps();
+    test_owner_lookup();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.scheduler=static"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,208 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the parameters derived by adaptive parcel coalescing from synthetic
+// times between parcels.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/plugins/parcel/coalescing_parameters.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/statistics/histogram.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::plugins::parcel::detail::coalescing_parameters;
+using hpx::plugins::parcel::detail::histogram_collector_type;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_messages = 50;
+std::size_t const interval = 1000;          // [us]
+std::size_t const max_latency = 100;        // [us], set in main
+
+// bins of 1us covering the latency budget, the samples are in [ns]
+histogram_collector_type make_histogram()
+{
+    return histogram_collector_type(
+        hpx::util::tag::histogram::num_bins = 100.,
+        hpx::util::tag::histogram::min_range = 0.,
+        hpx::util::tag::histogram::max_range = double(max_latency * 1000));
+}
+
+void add_samples(histogram_collector_type& h, std::size_t count,
+    double time_between_parcels)
+{
+    for (std::size_t i = 0; i != count; ++i)
+        h(time_between_parcels);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_latency_budget()
+{
+    coalescing_parameters p(num_messages, interval);
+    HPX_TEST(p.adaptive());
+    HPX_TEST_EQ(p.max_latency(), max_latency);
+    HPX_TEST_EQ(p.batch_size(), num_messages);
+    HPX_TEST_EQ(p.flush_interval(), max_latency);
+
+    histogram_collector_type h = make_histogram();
+
+    // a parcel every 20us, at most 5 fit into the latency budget
+    add_samples(h, 20, 20000.);
+    p.adjust(h, 0);
+
+    HPX_TEST_EQ(p.batch_size(), std::size_t(4));
+    HPX_TEST_LT(p.batch_size(), num_messages);
+    HPX_TEST_LTE(p.flush_interval(), max_latency);
+    HPX_TEST_LTE(p.batch_size() * 20, p.flush_interval());
+
+    // only the parcels arrived since the last adjustment are considered
+    add_samples(h, 20, 50000.);
+    p.adjust(h, 0);
+
+    HPX_TEST_EQ(p.batch_size(), std::size_t(1));
+    HPX_TEST_LTE(p.flush_interval(), max_latency);
+
+    add_samples(h, 20, 10000.);
+    p.adjust(h, 0);
+
+    HPX_TEST_EQ(p.batch_size(), std::size_t(9));
+    HPX_TEST_LTE(p.flush_interval(), max_latency);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_backlog()
+{
+    coalescing_parameters p(num_messages, interval);
+    histogram_collector_type h = make_histogram();
+
+    add_samples(h, 20, 20000.);
+    p.adjust(h, 0);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(4));
+
+    std::size_t const flush_interval = p.flush_interval();
+
+    // a backlog not exceeding the batch size doesn't change anything
+    p.adjust(h, 4);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(4));
+
+    // the batch size doubles as long as the backlog exceeds it
+    p.adjust(h, 5);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(8));
+
+    p.adjust(h, 100);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(16));
+
+    p.adjust(h, 100);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(32));
+
+    // without new parcels the flush interval is left alone
+    HPX_TEST_EQ(p.flush_interval(), flush_interval);
+
+    // the estimate based on newly arrived parcels applies again once the
+    // backlog is gone
+    add_samples(h, 20, 20000.);
+    p.adjust(h, 0);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(4));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clamps()
+{
+    coalescing_parameters p(num_messages, interval);
+    histogram_collector_type h = make_histogram();
+
+    // far more parcels arrive within the latency budget than may be
+    // coalesced
+    add_samples(h, 20, 100.);
+    p.adjust(h, 0);
+    HPX_TEST_EQ(p.batch_size(), num_messages);
+    HPX_TEST_LTE(std::size_t(1), p.flush_interval());
+    HPX_TEST_LTE(p.flush_interval(), max_latency);
+
+    p.adjust(h, 1000);
+    HPX_TEST_EQ(p.batch_size(), num_messages);
+
+    // parcels arrive less often than the latency budget allows to wait
+    add_samples(h, 20, 1e9);
+    p.adjust(h, 0);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(1));
+    HPX_TEST_LTE(std::size_t(1), p.flush_interval());
+    HPX_TEST_LTE(p.flush_interval(), max_latency);
+
+    // the configured values remain upper bounds
+    p.set_num_messages(2);
+    add_samples(h, 20, 100.);
+    p.adjust(h, 0);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(2));
+
+    p.set_max_latency(10);
+    HPX_TEST_LTE(p.flush_interval(), std::size_t(10));
+    add_samples(h, 20, 5000.);
+    p.adjust(h, 1000);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(2));
+    HPX_TEST_LTE(p.flush_interval(), std::size_t(10));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_static()
+{
+    hpx::set_config_entry(
+        "hpx.plugins.coalescing_message_handler.adaptive", "0");
+
+    coalescing_parameters p(num_messages, interval);
+    HPX_TEST(!p.adaptive());
+    HPX_TEST_EQ(p.batch_size(), num_messages);
+    HPX_TEST_EQ(p.flush_interval(), interval);
+
+    histogram_collector_type h = make_histogram();
+
+    add_samples(h, 20, 20000.);
+    p.adjust(h, 0);
+    HPX_TEST_EQ(p.batch_size(), num_messages);
+    HPX_TEST_EQ(p.flush_interval(), interval);
+
+    add_samples(h, 20, 1e9);
+    p.adjust(h, 1000);
+    HPX_TEST_EQ(p.batch_size(), num_messages);
+    HPX_TEST_EQ(p.flush_interval(), interval);
+
+    // the latency budget doesn't apply either
+    p.set_max_latency(10);
+    HPX_TEST_EQ(p.flush_interval(), interval);
+
+    p.set_num_messages(20);
+    p.set_interval(500);
+    HPX_TEST_EQ(p.batch_size(), std::size_t(20));
+    HPX_TEST_EQ(p.flush_interval(), std::size_t(500));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_latency_budget();
+    test_backlog();
+    test_clamps();
+    test_static();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.plugins.coalescing_message_handler.adaptive=1",
+        "hpx.plugins.coalescing_message_handler.max_latency=" +
+            std::to_string(max_latency),
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,110 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer_pool.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+typedef hpx::parcelset::parcel_buffer_pool<char> pool_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    pool_type pool;
+
+    std::vector<char> buffer = pool.acquire(1000);
+    HPX_TEST_EQ(buffer.size(), std::size_t(1000));
+    HPX_TEST(buffer.capacity() >= std::size_t(1024));
+    HPX_TEST_EQ(pool.hits(false), std::uint64_t(0));
+    HPX_TEST_EQ(pool.misses(false), std::uint64_t(1));
+
+    char const* data = buffer.data();
+    pool.release(std::move(buffer));
+    HPX_TEST_EQ(pool.high_water_mark(false), std::uint64_t(1024));
+
+    // any size mapped to the same size class gets the released buffer
+    std::vector<char> reused = pool.acquire(600);
+    HPX_TEST_EQ(reused.size(), std::size_t(600));
+    HPX_TEST(reused.data() == data);
+    HPX_TEST_EQ(pool.hits(true), std::uint64_t(1));
+    HPX_TEST_EQ(pool.hits(false), std::uint64_t(0));
+
+    // a larger size class does not
+    std::vector<char> larger = pool.acquire(2000);
+    HPX_TEST(larger.data() != data);
+    HPX_TEST_EQ(pool.misses(true), std::uint64_t(2));
+
+    // the returned memory is value initialized
+    for (char c : reused)
+        HPX_TEST_EQ(c, 0);
+}
+
+void test_limits()
+{
+    pool_type pool;
+
+    // empty and huge buffers are not cached
+    HPX_TEST(pool.acquire(0).empty());
+    pool.release(pool.acquire(std::size_t(4) << 20));
+    HPX_TEST_EQ(pool.high_water_mark(false), std::uint64_t(0));
+
+    // the number of cached buffers is limited
+    std::vector<std::vector<char>> buffers;
+    for (std::size_t i = 0; i != 2 * pool_type::max_cached_buffers; ++i)
+        buffers.push_back(pool.acquire(256));
+    for (auto& buffer : buffers)
+        pool.release(std::move(buffer));
+
+    HPX_TEST_EQ(pool.high_water_mark(true),
+        std::uint64_t(pool_type::max_cached_buffers * 256));
+
+    pool.clear();
+    HPX_TEST_EQ(pool.high_water_mark(false),
+        std::uint64_t(pool_type::max_cached_buffers * 256));
+    HPX_TEST_EQ(pool.high_water_mark(true), std::uint64_t(
+        pool_type::max_cached_buffers * 256));
+    HPX_TEST_EQ(pool.high_water_mark(false), std::uint64_t(0));
+}
+
+void test_concurrent()
+{
+    pool_type pool;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([&pool, t]() {
+            for (std::size_t i = 0; i != 10000; ++i)
+            {
+                std::size_t size = 1 + (i * 37 + t) % 5000;
+                std::vector<char> buffer = pool.acquire(size);
+                HPX_TEST_EQ(buffer.size(), size);
+                buffer.back() = char(t);
+                pool.release(std::move(buffer));
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    HPX_TEST_EQ(pool.hits(false) + pool.misses(false), std::uint64_t(40000));
+    HPX_TEST(pool.hits(false) > pool.misses(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_reuse();
+    test_limits();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
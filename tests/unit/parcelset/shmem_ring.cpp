@@ -0,0 +1,131 @@
+//  Copyright (c) 2019 Ste||ar Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/testing.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::ring;
+using hpx::parcelset::policies::shmem::ring_control;
+using hpx::parcelset::policies::shmem::segment;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_slots(segment& owner, segment& peer)
+{
+    HPX_TEST_EQ(peer.num_slots(), owner.num_slots());
+    HPX_TEST_EQ(peer.ring_size(), owner.ring_size());
+
+    std::vector<std::size_t> slots;
+    for (std::size_t i = 0; i != owner.num_slots(); ++i)
+    {
+        std::size_t slot = peer.claim_slot();
+        HPX_TEST_NEQ(slot, std::size_t(-1));
+        slots.push_back(slot);
+    }
+
+    // all slots are taken now
+    HPX_TEST_EQ(peer.claim_slot(), std::size_t(-1));
+
+    // a closed slot becomes available only after the owner recycled it
+    peer.release_slot(slots[0]);
+    HPX_TEST_EQ(peer.claim_slot(), std::size_t(-1));
+    HPX_TEST_EQ(owner.get_ring(slots[0]).control().state_.data_.load(),
+        std::uint32_t(ring_control::slot_closed));
+
+    owner.recycle_slot(slots[0]);
+    HPX_TEST_EQ(peer.claim_slot(), slots[0]);
+
+    for (std::size_t slot : slots)
+    {
+        peer.release_slot(slot);
+        owner.recycle_slot(slot);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stream(segment& owner, segment& peer)
+{
+    std::size_t slot = peer.claim_slot();
+    HPX_TEST_NEQ(slot, std::size_t(-1));
+
+    ring producer = peer.get_ring(slot);
+    ring consumer = owner.get_ring(slot);
+
+    // stream a message many times the size of the ring, forcing partial
+    // writes and wrap-around
+    std::vector<int> sent(10 * owner.ring_size() / sizeof(int) + 7);
+    std::iota(sent.begin(), sent.end(), 0);
+    std::vector<int> received(sent.size());
+
+    std::thread t([&]()
+    {
+        char const* data = reinterpret_cast<char const*>(sent.data());
+        std::size_t size = sent.size() * sizeof(int);
+        std::size_t offset = 0;
+        while (offset != size)
+        {
+            // use odd sizes to exercise unaligned wrap-around
+            std::size_t count = (std::min)(size - offset, std::size_t(1013));
+            offset += producer.write(data + offset, count);
+        }
+    });
+
+    char* data = reinterpret_cast<char*>(received.data());
+    std::size_t size = received.size() * sizeof(int);
+    std::size_t offset = 0;
+    while (offset != size)
+    {
+        offset += consumer.read(data + offset, size - offset);
+    }
+
+    t.join();
+
+    HPX_TEST(consumer.empty());
+    HPX_TEST(sent == received);
+
+    peer.release_slot(slot);
+    owner.recycle_slot(slot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::string name = "/hpx.shmem.test." + std::to_string(::getpid());
+
+    {
+        segment owner;
+        owner.create(name, 4, 4096);
+        HPX_TEST(static_cast<bool>(owner));
+
+        segment peer;
+        peer.open(name);
+        HPX_TEST(static_cast<bool>(peer));
+
+        test_slots(owner, peer);
+        test_stream(owner, peer);
+    }
+
+    // the owner removes the segment on destruction
+    {
+        hpx::error_code ec(hpx::lightweight);
+        segment peer;
+        peer.open(name, ec);
+        HPX_TEST(ec);
+        HPX_TEST(!peer);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -81,6 +81,9 @@ int main(int argc, char* argv[])
             hpx::resource::scheduling_policy::abp_priority_fifo,
             hpx::resource::scheduling_policy::abp_priority_lifo,
 #endif
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+            hpx::resource::scheduling_policy::local_priority_chase_lev,
+#endif
 #if defined(HPX_HAVE_SHARED_PRIORITY_SCHEDULER)
             hpx::resource::scheduling_policy::shared_priority,
 #endif
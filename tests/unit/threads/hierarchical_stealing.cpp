@@ -0,0 +1,152 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that work placed on a single worker thread is stolen by the others
+// if hierarchical work stealing is enabled.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/thread_pool_helpers.hpp>
+#include <hpx/runtime/threads/policies/scheduler_base.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_pool_base.hpp>
+#include <hpx/testing.hpp>
+#include <hpx/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// This is only a safeguard against hanging if no work is stolen, no timing
+// is verified.
+double const timeout = 60.0;
+
+struct shared_state
+{
+    explicit shared_state(std::size_t count)
+      : count_(count)
+      , workers_(0)
+    {
+    }
+
+    std::size_t num_workers() const
+    {
+        std::uint64_t workers = workers_.load();
+
+        std::size_t result = 0;
+        for (/**/; workers != 0; workers &= workers - 1)
+            ++result;
+        return result;
+    }
+
+    std::atomic<std::size_t> count_;
+    std::atomic<std::uint64_t> workers_;
+    hpx::lcos::local::promise<void> promise_;
+    hpx::util::high_resolution_timer timer_;
+};
+
+// Each task blocks its worker thread until tasks have run on at least two
+// of them. All tasks are placed on the same worker thread, all but the
+// first can run only if another worker thread steals them.
+void run_task(std::shared_ptr<shared_state> s)
+{
+    s->workers_.fetch_or(std::uint64_t(1) << hpx::get_worker_thread_num());
+
+    while (s->num_workers() < 2 && s->timer_.elapsed() < timeout)
+    {
+    }
+
+    if (--s->count_ == 0)
+        s->promise_.set_value();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stealing(std::size_t num_tasks)
+{
+    auto s = std::make_shared<shared_state>(num_tasks);
+    hpx::future<void> f = s->promise_.get_future();
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::threads::register_work(hpx::util::bind(&run_task, s),
+            "run_task", hpx::threads::pending,
+            hpx::threads::thread_priority_normal,
+            hpx::threads::thread_schedule_hint(std::int16_t(0)));
+    }
+
+    f.get();
+    HPX_TEST_LTE(std::size_t(2), s->num_workers());
+}
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+std::int64_t get_counter_sum(std::string const& name, std::size_t num_threads)
+{
+    using namespace hpx::performance_counters;
+
+    std::vector<performance_counter> counters = discover_counters(name);
+    HPX_TEST_EQ(counters.size(), num_threads);
+
+    std::int64_t sum = 0;
+    for (performance_counter const& c : counters)
+    {
+        sum += c.get_value<std::int64_t>(hpx::launch::sync);
+    }
+    return sum;
+}
+#endif
+
+int hpx_main(int argc, char* argv[])
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    HPX_TEST_LTE(std::size_t(2), num_threads);
+
+    hpx::threads::add_scheduler_mode(
+        hpx::threads::policies::scheduler_mode(
+            hpx::threads::policies::enable_stealing |
+            hpx::threads::policies::enable_stealing_hierarchical));
+
+    hpx::threads::policies::scheduler_base* sched =
+        hpx::resource::get_thread_pool(0).get_scheduler();
+    HPX_TEST(sched->has_work_stealing());
+    HPX_TEST(sched->has_work_stealing_hierarchical());
+
+    test_stealing(num_threads);
+    test_stealing(16 * num_threads);
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    // the steal counters are available for each worker thread, threads
+    // stolen from other NUMA domains are counted separately
+    std::string const counter_prefix = "/threads{locality#0/worker-thread#*}";
+
+    HPX_TEST_LT(std::int64_t(0),
+        get_counter_sum(
+            counter_prefix + "/count/stolen-from-pending", num_threads));
+    HPX_TEST_LT(std::int64_t(0),
+        get_counter_sum(
+            counter_prefix + "/count/stolen-to-pending", num_threads));
+    HPX_TEST_LTE(std::int64_t(0),
+        get_counter_sum(
+            counter_prefix + "/count/stolen-to-pending-remote", num_threads));
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.scheduler=local-priority-fifo",
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,164 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that work scheduled on a scheduler without work stealing wakes up
+// the parked worker thread owning the queue it was added to instead of
+// waiting for the idle backoff time to expire.
+//
+// Each round waits until the worker threads are parked before scheduling
+// new work for them. A worker is only woken up if the scheduler notifies
+// it, otherwise its backoff time keeps doubling from round to round until
+// the work isn't run anymore before the timeout below expires.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/runtime/thread_pool_helpers.hpp>
+#include <hpx/runtime/threads/policies/scheduler_base.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_pool_base.hpp>
+#include <hpx/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_rounds = 32;
+
+// This is only a safeguard against hanging if a wake up is lost, no timing
+// is verified.
+std::chrono::seconds const timeout(60);
+
+struct handshake
+{
+    explicit handshake(std::size_t count)
+      : count_(count)
+    {
+    }
+
+    void count_down()
+    {
+        if (--count_ == 0)
+            promise_.set_value();
+    }
+
+    std::atomic<std::size_t> count_;
+    hpx::lcos::local::promise<void> promise_;
+};
+
+void count_down(std::shared_ptr<handshake> h)
+{
+    h->count_down();
+}
+
+bool wait(std::shared_ptr<handshake> const& h)
+{
+    hpx::future<void> f = h->promise_.get_future();
+    return f.wait_for(timeout) == hpx::lcos::future_status::ready;
+}
+
+// wait for all worker threads but the current one to be parked
+void wait_for_parked_threads(hpx::threads::policies::scheduler_base* sched)
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    std::size_t const this_thread = hpx::get_worker_thread_num();
+
+    for (std::size_t j = 0; j != num_threads; ++j)
+    {
+        while (j != this_thread && !sched->is_parked(j))
+        {
+            hpx::this_thread::yield();
+        }
+    }
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    hpx::threads::policies::scheduler_base* sched =
+        hpx::resource::get_thread_pool(0).get_scheduler();
+
+    HPX_TEST(sched->get_scheduler_mode() &
+        hpx::threads::policies::enable_idle_backoff);
+
+    // work explicitly placed on each of the other worker threads
+    for (std::size_t i = 0; i != num_rounds; ++i)
+    {
+        wait_for_parked_threads(sched);
+
+        std::size_t const this_thread = hpx::get_worker_thread_num();
+        auto h = std::make_shared<handshake>(num_threads - 1);
+        for (std::size_t j = 0; j != num_threads; ++j)
+        {
+            if (j == this_thread)
+                continue;
+
+            hpx::threads::register_work(
+                hpx::util::bind(&count_down, h), "count_down",
+                hpx::threads::pending, hpx::threads::thread_priority_normal,
+                hpx::threads::thread_schedule_hint(std::int16_t(j)));
+        }
+
+        if (!wait(h))
+        {
+            HPX_TEST_MSG(false, "parked worker thread wasn't woken up");
+            break;
+        }
+    }
+
+    // work placed on the queues by the scheduler itself
+    for (std::size_t i = 0; i != num_rounds; ++i)
+    {
+        wait_for_parked_threads(sched);
+
+        auto h = std::make_shared<handshake>(num_threads);
+        for (std::size_t j = 0; j != num_threads; ++j)
+        {
+            hpx::apply(&count_down, h);
+        }
+
+        if (!wait(h))
+        {
+            HPX_TEST_MSG(false, "parked worker thread wasn't woken up");
+            break;
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    for (std::string const scheduler : {"static", "static-priority"})
+    {
+        // the backoff time is large enough for the timeout above to expire
+        // long before a worker thread wakes up on its own in the last round
+        std::vector<std::string> const cfg = {
+            "hpx.scheduler=" + scheduler,
+            "hpx.max_idle_loop_count=100",
+            "hpx.max_idle_backoff_time=" +
+                std::to_string(std::uint64_t(1) << num_rounds),
+        };
+
+        HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    }
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -102,5 +102,14 @@ int main(int argc, char* argv[])
     }
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_chase_lev>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+#endif
+
     return hpx::util::report_errors();
 }